@@ -314,6 +314,11 @@ if(OT_TIME_SYNC)
     target_compile_definitions(ot-config INTERFACE "OPENTHREAD_CONFIG_TIME_SYNC_ENABLE=1")
 endif()
 
+option(OT_TIMER_PAIRING_HEAP "enable pairing heap timer scheduler backend")
+if(OT_TIMER_PAIRING_HEAP)
+    target_compile_definitions(ot-config INTERFACE "OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE=1")
+endif()
+
 option(OT_TREL "enable TREL radio link for Thread over Infrastructure feature")
 if (OT_TREL)
     target_compile_definitions(ot-config INTERFACE "OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE=1")
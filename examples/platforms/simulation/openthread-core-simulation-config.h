@@ -199,4 +199,44 @@
 #define OPENTHREAD_CONFIG_CLI_UART_RX_BUFFER_SIZE 640
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_AES_HARDWARE_ACCELERATION_ENABLE
+ *
+ * Define as 1 to encrypt AES blocks using the CPU AES instructions when available.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_AES_HARDWARE_ACCELERATION_ENABLE
+#define OPENTHREAD_CONFIG_AES_HARDWARE_ACCELERATION_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_HDLC_FCS_SLICE_BY_8_ENABLE
+ *
+ * Define as 1 to compute the HDLC FCS eight bytes at a time (slice-by-8) when encoding or decoding a block of data.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_HDLC_FCS_SLICE_BY_8_ENABLE
+#define OPENTHREAD_CONFIG_HDLC_FCS_SLICE_BY_8_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE
+ *
+ * The number of slots in the hash table used by each CoAP agent to look up resources by Uri-Path.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE
+#define OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE 64
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE
+ *
+ * The number of slots in the hash table used to look up the UDP socket of a received datagram by destination port.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE
+#define OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE 32
+#endif
+
 #endif // OPENTHREAD_CORE_SIMULATION_CONFIG_H_
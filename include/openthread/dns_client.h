@@ -540,6 +540,52 @@ otError otDnsServiceResponseGetHostAddress(const otDnsServiceResponse *aResponse
                                            otIp6Address *              aAddress,
                                            uint32_t *                  aTtl);
 
+/**
+ * This structure represents the DNS client response cache counters.
+ *
+ */
+typedef struct otDnsCacheCounters
+{
+    uint32_t mHits;      ///< Number of queries answered from the cache.
+    uint32_t mMisses;    ///< Number of queries sent to the server since no fresh response was cached.
+    uint32_t mEvictions; ///< Number of responses removed from the cache before expiring (capacity or buffer shortage).
+} otDnsCacheCounters;
+
+/**
+ * This function gets the DNS client response cache counters.
+ *
+ * This function requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the DNS client cache counters.
+ *
+ */
+const otDnsCacheCounters *otDnsClientGetCacheCounters(otInstance *aInstance);
+
+/**
+ * This function resets the DNS client response cache counters.
+ *
+ * This function requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ *
+ */
+void otDnsClientResetCacheCounters(otInstance *aInstance);
+
+/**
+ * This function removes all responses from the DNS client response cache.
+ *
+ * The cache is also cleared automatically when the device leaves its Thread network or the network changes (partition,
+ * mesh-local prefix or extended PAN ID).
+ *
+ * This function requires `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE`.
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ *
+ */
+void otDnsClientClearCache(otInstance *aInstance);
+
 /**
  * @}
  *
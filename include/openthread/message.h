@@ -86,6 +86,39 @@ typedef struct otBufferInfo
     uint16_t mApplicationCoapBuffers;  ///< The number of buffers in the application CoAP send queue.
 } otBufferInfo;
 
+#define OT_MESSAGE_NUM_PRIORITIES 4 ///< Number of priority levels in `otMessageBufferStats`.
+#define OT_MESSAGE_NUM_TYPES 5      ///< Number of message types in `otMessageBufferStats`.
+
+/**
+ * This structure represents the message buffer usage of the message pool or of a category of messages.
+ *
+ */
+typedef struct otMessageBufferUsage
+{
+    uint16_t mUsedBuffers;       ///< The number of buffers in use.
+    uint16_t mMaxUsedBuffers;    ///< The max number of buffers in use at the same time.
+    uint32_t mFailedAllocations; ///< The number of buffer allocations that failed.
+} otMessageBufferUsage;
+
+/**
+ * This structure represents the message buffer statistics.
+ *
+ * A buffer is counted under the priority level and the type of the message it was allocated for. The priority levels
+ * are low, normal, high and network control (used internally, e.g., by MLE). The message types are IPv6, 6LoWPAN,
+ * child supervision, MAC empty data, and other.
+ *
+ * The buffer usage is only tracked when the built-in message buffer pool is used, i.e., not with heap or platform
+ * message management.
+ *
+ */
+typedef struct otMessageBufferStats
+{
+    otMessageBufferUsage mTotal;                                      ///< The usage of the whole buffer pool.
+    otMessageBufferUsage mPriorityUsage[OT_MESSAGE_NUM_PRIORITIES];   ///< The usage per message priority level.
+    otMessageBufferUsage mTypeUsage[OT_MESSAGE_NUM_TYPES];            ///< The usage per message type.
+    uint16_t             mReservedBuffers[OT_MESSAGE_NUM_PRIORITIES]; ///< Buffers reserved for a level or higher.
+} otMessageBufferStats;
+
 /**
  * This enumeration defines the OpenThread message priority levels.
  *
@@ -368,6 +401,26 @@ otMessage *otMessageQueueGetNext(otMessageQueue *aQueue, const otMessage *aMessa
  */
 void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo);
 
+/**
+ * Get the message buffer statistics.
+ *
+ * @param[in]   aInstance  A pointer to the OpenThread instance.
+ * @param[out]  aStats     A pointer where the message buffer statistics are written.
+ *
+ */
+void otMessageGetBufferStats(otInstance *aInstance, otMessageBufferStats *aStats);
+
+/**
+ * Reset the message buffer statistics.
+ *
+ * This function clears the failed allocation counters and sets the max number of used buffers to the number of
+ * buffers currently in use.
+ *
+ * @param[in]  aInstance  A pointer to the OpenThread instance.
+ *
+ */
+void otMessageResetBufferStats(otInstance *aInstance);
+
 /**
  * @}
  *
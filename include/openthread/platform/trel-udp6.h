@@ -102,8 +102,9 @@ void otPlatTrelUdp6SubscribeMulticastAddress(otInstance *aInstance, const otIp6A
  * @param[in] aLength          Packet length (number of bytes).
  * @param[in] aDestAddress     The destination IPv6 address (can be a unicast or a multicast IPv6 address).
  *
- * @retval OT_ERROR_NONE    The tx request was handled successfully.
- * @retval OT_ERROR_ABORT   The interface is not ready and tx was aborted
+ * @retval OT_ERROR_NONE     The tx request was handled successfully.
+ * @retval OT_ERROR_ABORT    The interface is not ready and tx was aborted
+ * @retval OT_ERROR_NO_BUFS  The interface cannot accept more packets for now (e.g., its tx queue is full).
  *
  */
 otError otPlatTrelUdp6SendTo(otInstance *        aInstance,
@@ -152,6 +152,20 @@ typedef struct otIpCounters
     uint32_t mRxFailure; ///< The number of IPv6 packets failed to receive.
 } otIpCounters;
 
+/**
+ * This structure represents the 6LoWPAN reassembly counters.
+ *
+ */
+typedef struct otReassemblyCounters
+{
+    uint32_t mReassembled;        ///< The number of datagrams reassembled from 6LoWPAN fragments.
+    uint32_t mTimeouts;           ///< The number of reassemblies dropped because a fragment did not arrive in time.
+    uint32_t mEvictions;          ///< The number of reassemblies evicted to make room for another datagram.
+    uint32_t mDuplicateFragments; ///< The number of fragments dropped because they were already received.
+    uint32_t mOverlapFragments;   ///< The number of fragments dropped because they partially overlap received data.
+    uint32_t mUnmatchedFragments; ///< The number of next fragments dropped because no reassembly matched them.
+} otReassemblyCounters;
+
 /**
  * This structure represents the Thread MLE counters.
  *
@@ -810,6 +824,24 @@ const otIpCounters *otThreadGetIp6Counters(otInstance *aInstance);
  */
 void otThreadResetIp6Counters(otInstance *aInstance);
 
+/**
+ * Get the 6LoWPAN reassembly counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the 6LoWPAN reassembly counters.
+ *
+ */
+const otReassemblyCounters *otThreadGetReassemblyCounters(otInstance *aInstance);
+
+/**
+ * Reset the 6LoWPAN reassembly counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetReassemblyCounters(otInstance *aInstance);
+
 /**
  * Get the Thread MLE counters.
  *
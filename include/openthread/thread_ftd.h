@@ -109,6 +109,27 @@ typedef struct otCacheEntryInfo
     uint16_t          mRetryDelay;         ///< Retry delay in seconds (applicable if in query-retry state).
 } otCacheEntryInfo;
 
+/**
+ * This structure represents the EID cache counters.
+ *
+ */
+typedef struct otEidCacheCounters
+{
+    uint32_t mHits;      ///< Number of EID lookups that found a resolved (cached or snooped) entry.
+    uint32_t mMisses;    ///< Number of EID lookups that did not find a resolved entry.
+    uint32_t mEvictions; ///< Number of entries evicted to make room for a new entry.
+} otEidCacheCounters;
+
+/**
+ * This structure represents the router forwarding information base (FIB) counters.
+ *
+ */
+typedef struct otRouterFibCounters
+{
+    uint32_t mLookups;  ///< Number of next hop and cost lookups served from the FIB.
+    uint32_t mRebuilds; ///< Number of times the FIB was recomputed from the router table.
+} otRouterFibCounters;
+
 /**
  * This type represents an iterator used for iterating through the EID cache table entries.
  *
@@ -552,6 +573,42 @@ otError otThreadGetRouterInfo(otInstance *aInstance, uint16_t aRouterId, otRoute
  */
 otError otThreadGetNextCacheEntry(otInstance *aInstance, otCacheEntryInfo *aEntryInfo, otCacheEntryIterator *aIterator);
 
+/**
+ * This function gets the EID cache counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the EID cache counters.
+ *
+ */
+const otEidCacheCounters *otThreadGetEidCacheCounters(otInstance *aInstance);
+
+/**
+ * This function resets the EID cache counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetEidCacheCounters(otInstance *aInstance);
+
+/**
+ * This function gets the router forwarding information base (FIB) counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the router FIB counters.
+ *
+ */
+const otRouterFibCounters *otThreadGetRouterFibCounters(otInstance *aInstance);
+
+/**
+ * This function resets the router forwarding information base (FIB) counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otThreadResetRouterFibCounters(otInstance *aInstance);
+
 /**
  * Get the Thread PSKc
  *
@@ -116,6 +116,18 @@ otError otUdpSendDatagram(otInstance *aInstance, otMessage *aMessage, otMessageI
  */
 typedef void (*otUdpReceive)(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
+/**
+ * This structure represents the receive counters of a UDP socket.
+ *
+ * The counters are reset when the socket is opened.
+ *
+ */
+typedef struct otUdpSocketCounters
+{
+    uint32_t mRxDatagrams; ///< The number of datagrams delivered to the socket.
+    uint32_t mRxDropped;   ///< The number of datagrams to the socket's port dropped as the address or peer mismatched.
+} otUdpSocketCounters;
+
 /**
  * This structure represents a UDP socket.
  *
@@ -127,6 +139,7 @@ typedef struct otUdpSocket
     otUdpReceive        mHandler;  ///< A function pointer to the application callback.
     void *              mContext;  ///< A pointer to application-specific context.
     void *              mHandle;   ///< A handle to platform's UDP.
+    otUdpSocketCounters mCounters; ///< The receive counters (read-only).
     struct otUdpSocket *mNext;     ///< A pointer to the next UDP socket (internal use only).
 } otUdpSocket;
 
@@ -640,26 +640,76 @@ exit:
 
 otError Interpreter::ProcessBufferInfo(uint8_t aArgsLength, char *aArgs[])
 {
-    OT_UNUSED_VARIABLE(aArgsLength);
-    OT_UNUSED_VARIABLE(aArgs);
+    otError error = OT_ERROR_NONE;
 
-    otBufferInfo bufferInfo;
+    if (aArgsLength == 0)
+    {
+        otBufferInfo bufferInfo;
 
-    otMessageGetBufferInfo(mInstance, &bufferInfo);
+        otMessageGetBufferInfo(mInstance, &bufferInfo);
 
-    OutputLine("total: %d", bufferInfo.mTotalBuffers);
-    OutputLine("free: %d", bufferInfo.mFreeBuffers);
-    OutputLine("6lo send: %d %d", bufferInfo.m6loSendMessages, bufferInfo.m6loSendBuffers);
-    OutputLine("6lo reas: %d %d", bufferInfo.m6loReassemblyMessages, bufferInfo.m6loReassemblyBuffers);
-    OutputLine("ip6: %d %d", bufferInfo.mIp6Messages, bufferInfo.mIp6Buffers);
-    OutputLine("mpl: %d %d", bufferInfo.mMplMessages, bufferInfo.mMplBuffers);
-    OutputLine("mle: %d %d", bufferInfo.mMleMessages, bufferInfo.mMleBuffers);
-    OutputLine("arp: %d %d", bufferInfo.mArpMessages, bufferInfo.mArpBuffers);
-    OutputLine("coap: %d %d", bufferInfo.mCoapMessages, bufferInfo.mCoapBuffers);
-    OutputLine("coap secure: %d %d", bufferInfo.mCoapSecureMessages, bufferInfo.mCoapSecureBuffers);
-    OutputLine("application coap: %d %d", bufferInfo.mApplicationCoapMessages, bufferInfo.mApplicationCoapBuffers);
+        OutputLine("total: %d", bufferInfo.mTotalBuffers);
+        OutputLine("free: %d", bufferInfo.mFreeBuffers);
+        OutputLine("6lo send: %d %d", bufferInfo.m6loSendMessages, bufferInfo.m6loSendBuffers);
+        OutputLine("6lo reas: %d %d", bufferInfo.m6loReassemblyMessages, bufferInfo.m6loReassemblyBuffers);
+        OutputLine("ip6: %d %d", bufferInfo.mIp6Messages, bufferInfo.mIp6Buffers);
+        OutputLine("mpl: %d %d", bufferInfo.mMplMessages, bufferInfo.mMplBuffers);
+        OutputLine("mle: %d %d", bufferInfo.mMleMessages, bufferInfo.mMleBuffers);
+        OutputLine("arp: %d %d", bufferInfo.mArpMessages, bufferInfo.mArpBuffers);
+        OutputLine("coap: %d %d", bufferInfo.mCoapMessages, bufferInfo.mCoapBuffers);
+        OutputLine("coap secure: %d %d", bufferInfo.mCoapSecureMessages, bufferInfo.mCoapSecureBuffers);
+        OutputLine("application coap: %d %d", bufferInfo.mApplicationCoapMessages,
+                   bufferInfo.mApplicationCoapBuffers);
+    }
+    else if (strcmp(aArgs[0], "stats") == 0)
+    {
+        static const char *const kPriorityNames[OT_MESSAGE_NUM_PRIORITIES] = {"low", "normal", "high", "net"};
+        static const char *const kTypeNames[OT_MESSAGE_NUM_TYPES] = {"ip6", "6lo", "supervision", "mac empty data",
+                                                                     "other"};
 
-    return OT_ERROR_NONE;
+        otMessageBufferStats stats;
+
+        otMessageGetBufferStats(mInstance, &stats);
+
+        OutputBufferUsage(0, "total", stats.mTotal);
+
+        OutputLine("priority:");
+
+        for (uint8_t priority = 0; priority < OT_MESSAGE_NUM_PRIORITIES; priority++)
+        {
+            OutputBufferUsage(kIndentSize, kPriorityNames[priority], stats.mPriorityUsage[priority]);
+        }
+
+        OutputLine("type:");
+
+        for (uint8_t type = 0; type < OT_MESSAGE_NUM_TYPES; type++)
+        {
+            OutputBufferUsage(kIndentSize, kTypeNames[type], stats.mTypeUsage[type]);
+        }
+
+        OutputLine("reserved:");
+
+        for (uint8_t priority = OT_MESSAGE_PRIORITY_NORMAL; priority < OT_MESSAGE_NUM_PRIORITIES; priority++)
+        {
+            OutputLine(kIndentSize, "%s: %d", kPriorityNames[priority], stats.mReservedBuffers[priority]);
+        }
+    }
+    else if (strcmp(aArgs[0], "reset") == 0)
+    {
+        otMessageResetBufferStats(mInstance);
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+    return error;
+}
+
+void Interpreter::OutputBufferUsage(uint8_t aIndentSize, const char *aName, const otMessageBufferUsage &aUsage)
+{
+    OutputLine(aIndentSize, "%s: used %d, max %d, failed %u", aName, aUsage.mUsedBuffers, aUsage.mMaxUsedBuffers,
+               aUsage.mFailedAllocations);
 }
 
 otError Interpreter::ProcessCcaThreshold(uint8_t aArgsLength, char *aArgs[])
@@ -1202,6 +1252,7 @@ otError Interpreter::ProcessCounters(uint8_t aArgsLength, char *aArgs[])
     {
         OutputLine("mac");
         OutputLine("mle");
+        OutputLine("reassembly");
     }
     else if (strcmp(aArgs[0], "mac") == 0)
     {
@@ -1275,6 +1326,28 @@ otError Interpreter::ProcessCounters(uint8_t aArgsLength, char *aArgs[])
             ExitNow(error = OT_ERROR_INVALID_ARGS);
         }
     }
+    else if (strcmp(aArgs[0], "reassembly") == 0)
+    {
+        if (aArgsLength == 1)
+        {
+            const otReassemblyCounters *reassemblyCounters = otThreadGetReassemblyCounters(mInstance);
+
+            OutputLine("Reassembled: %d", reassemblyCounters->mReassembled);
+            OutputLine("Timeouts: %d", reassemblyCounters->mTimeouts);
+            OutputLine("Evictions: %d", reassemblyCounters->mEvictions);
+            OutputLine("Duplicate Fragments: %d", reassemblyCounters->mDuplicateFragments);
+            OutputLine("Overlap Fragments: %d", reassemblyCounters->mOverlapFragments);
+            OutputLine("Unmatched Fragments: %d", reassemblyCounters->mUnmatchedFragments);
+        }
+        else if ((aArgsLength == 2) && (strcmp(aArgs[1], "reset") == 0))
+        {
+            otThreadResetReassemblyCounters(mInstance);
+        }
+        else
+        {
+            ExitNow(error = OT_ERROR_INVALID_ARGS);
+        }
+    }
     else
     {
         ExitNow(error = OT_ERROR_INVALID_ARGS);
@@ -1497,6 +1570,31 @@ otError Interpreter::ProcessDns(uint8_t aArgsLength, char *aArgs[])
         error = OT_ERROR_PENDING;
     }
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    else if (strcmp(aArgs[0], "cache") == 0)
+    {
+        if (aArgsLength == 1)
+        {
+            const otDnsCacheCounters *counters = otDnsClientGetCacheCounters(mInstance);
+
+            OutputLine("Hits: %u", counters->mHits);
+            OutputLine("Misses: %u", counters->mMisses);
+            OutputLine("Evictions: %u", counters->mEvictions);
+        }
+        else if ((aArgsLength == 2) && (strcmp(aArgs[1], "clear") == 0))
+        {
+            otDnsClientClearCache(mInstance);
+        }
+        else if ((aArgsLength == 2) && (strcmp(aArgs[1], "reset") == 0))
+        {
+            otDnsClientResetCacheCounters(mInstance);
+        }
+        else
+        {
+            ExitNow(error = OT_ERROR_INVALID_ARGS);
+        }
+    }
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE
     else
     {
@@ -1711,22 +1809,45 @@ void Interpreter::OutputEidCacheEntry(const otCacheEntryInfo &aEntry)
 
 otError Interpreter::ProcessEidCache(uint8_t aArgsLength, char *aArgs[])
 {
-    OT_UNUSED_VARIABLE(aArgsLength);
-    OT_UNUSED_VARIABLE(aArgs);
+    otError error = OT_ERROR_NONE;
 
-    otCacheEntryIterator iterator;
-    otCacheEntryInfo     entry;
+    if (aArgsLength == 0)
+    {
+        otCacheEntryIterator iterator;
+        otCacheEntryInfo     entry;
 
-    memset(&iterator, 0, sizeof(iterator));
+        memset(&iterator, 0, sizeof(iterator));
 
-    for (uint8_t i = 0;; i++)
+        while (otThreadGetNextCacheEntry(mInstance, &entry, &iterator) == OT_ERROR_NONE)
+        {
+            OutputEidCacheEntry(entry);
+        }
+    }
+    else if (strcmp(aArgs[0], "counters") == 0)
+    {
+        if (aArgsLength == 1)
+        {
+            const otEidCacheCounters *counters = otThreadGetEidCacheCounters(mInstance);
+
+            OutputLine("hits: %u", counters->mHits);
+            OutputLine("misses: %u", counters->mMisses);
+            OutputLine("evictions: %u", counters->mEvictions);
+        }
+        else if ((aArgsLength == 2) && (strcmp(aArgs[1], "reset") == 0))
+        {
+            otThreadResetEidCacheCounters(mInstance);
+        }
+        else
+        {
+            error = OT_ERROR_INVALID_ARGS;
+        }
+    }
+    else
     {
-        SuccessOrExit(otThreadGetNextCacheEntry(mInstance, &entry, &iterator));
-        OutputEidCacheEntry(entry);
+        error = OT_ERROR_INVALID_COMMAND;
     }
 
-exit:
-    return OT_ERROR_NONE;
+    return error;
 }
 #endif
 
@@ -3916,6 +4037,29 @@ otError Interpreter::ProcessRouter(uint8_t aArgsLength, char *aArgs[])
         ExitNow();
     }
 
+    if (strcmp(aArgs[0], "fib") == 0)
+    {
+        VerifyOrExit(aArgsLength >= 2 && strcmp(aArgs[1], "counters") == 0, error = OT_ERROR_INVALID_COMMAND);
+
+        if (aArgsLength == 2)
+        {
+            const otRouterFibCounters *counters = otThreadGetRouterFibCounters(mInstance);
+
+            OutputLine("lookups: %u", counters->mLookups);
+            OutputLine("rebuilds: %u", counters->mRebuilds);
+        }
+        else if ((aArgsLength == 3) && (strcmp(aArgs[2], "reset") == 0))
+        {
+            otThreadResetRouterFibCounters(mInstance);
+        }
+        else
+        {
+            error = OT_ERROR_INVALID_ARGS;
+        }
+
+        ExitNow();
+    }
+
     SuccessOrExit(error = ParseAsUint16(aArgs[0], routerId));
     SuccessOrExit(error = otThreadGetRouterInfo(mInstance, routerId, &routerInfo));
 
@@ -331,6 +331,7 @@ private:
     otError ProcessHelp(uint8_t aArgsLength, char *aArgs[]);
     otError ProcessCcaThreshold(uint8_t aArgsLength, char *aArgs[]);
     otError ProcessBufferInfo(uint8_t aArgsLength, char *aArgs[]);
+    void    OutputBufferUsage(uint8_t aIndentSize, const char *aName, const otMessageBufferUsage &aUsage);
     otError ProcessChannel(uint8_t aArgsLength, char *aArgs[]);
 #if OPENTHREAD_CONFIG_BORDER_AGENT_ENABLE
     otError ProcessBorderAgent(uint8_t aArgsLength, char *aArgs[]);
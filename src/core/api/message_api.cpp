@@ -228,4 +228,18 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
     aBufferInfo->mApplicationCoapBuffers  = 0;
 #endif
 }
+
+void otMessageGetBufferStats(otInstance *aInstance, otMessageBufferStats *aStats)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    *aStats = instance.Get<MessagePool>().GetBufferStats();
+}
+
+void otMessageResetBufferStats(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<MessagePool>().ResetBufferStats();
+}
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
@@ -515,6 +515,20 @@ void otThreadResetIp6Counters(otInstance *aInstance)
     instance.Get<MeshForwarder>().ResetCounters();
 }
 
+const otReassemblyCounters *otThreadGetReassemblyCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<MeshForwarder>().GetReassemblyCounters();
+}
+
+void otThreadResetReassemblyCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<MeshForwarder>().ResetReassemblyCounters();
+}
+
 const otMleCounters *otThreadGetMleCounters(otInstance *aInstance)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -50,6 +50,9 @@ CoapBase::CoapBase(Instance &aInstance, Sender aSender)
     : InstanceLocator(aInstance)
     , mMessageId(Random::NonCrypto::GetUint16())
     , mRetransmissionTimer(aInstance, Coap::HandleRetransmissionTimer, this)
+#if OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE > 0
+    , mNumUnindexedResources(0)
+#endif
     , mContext(nullptr)
     , mInterceptor(nullptr)
     , mResponsesQueue(aInstance)
@@ -60,6 +63,9 @@ CoapBase::CoapBase(Instance &aInstance, Sender aSender)
     , mLastResponse(nullptr)
 #endif
 {
+#if OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE > 0
+    memset(mResourceIndex, 0, sizeof(mResourceIndex));
+#endif
 }
 
 void CoapBase::ClearRequestsAndResponses(void)
@@ -106,15 +112,145 @@ void CoapBase::RemoveBlockWiseResource(ResourceBlockWise &aResource)
 
 void CoapBase::AddResource(Resource &aResource)
 {
-    IgnoreError(mResources.Add(aResource));
+    SuccessOrExit(mResources.Add(aResource));
+
+#if OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE > 0
+    AddToResourceIndex(aResource);
+#endif
+
+exit:
+    return;
 }
 
 void CoapBase::RemoveResource(Resource &aResource)
 {
-    IgnoreError(mResources.Remove(aResource));
+    if (mResources.Remove(aResource) == kErrorNone)
+    {
+#if OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE > 0
+        RemoveFromResourceIndex(aResource);
+#endif
+    }
+
     aResource.SetNext(nullptr);
 }
 
+const Resource *CoapBase::FindResource(const char *aUriPath) const
+{
+    const Resource *resource;
+
+#if OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE > 0
+    uint16_t slot = GetResourceIndexSlot(aUriPath);
+
+    for (uint16_t i = 0; (i < kResourceIndexSize) && (mResourceIndex[slot] != nullptr); i++)
+    {
+        resource = mResourceIndex[slot];
+        VerifyOrExit(strcmp(resource->GetUriPath(), aUriPath) != 0);
+        slot = (slot + 1) % kResourceIndexSize;
+    }
+
+    VerifyOrExit(mNumUnindexedResources > 0, resource = nullptr);
+#endif
+
+    for (resource = mResources.GetHead(); resource != nullptr; resource = resource->GetNext())
+    {
+        if (strcmp(resource->GetUriPath(), aUriPath) == 0)
+        {
+            break;
+        }
+    }
+
+#if OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE > 0
+exit:
+#endif
+    return resource;
+}
+
+#if OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE > 0
+
+void CoapBase::AddToResourceIndex(const Resource &aResource)
+{
+    uint16_t slot = GetResourceIndexSlot(aResource.GetUriPath());
+
+    for (uint16_t i = 0; i < kResourceIndexSize; i++)
+    {
+        if (mResourceIndex[slot] == nullptr)
+        {
+            mResourceIndex[slot] = &aResource;
+            ExitNow();
+        }
+
+        if (strcmp(mResourceIndex[slot]->GetUriPath(), aResource.GetUriPath()) == 0)
+        {
+            // The most recently added resource handles the Uri-Path, as it comes first in `mResources`.
+            mResourceIndex[slot] = &aResource;
+            mNumUnindexedResources++;
+            ExitNow();
+        }
+
+        slot = (slot + 1) % kResourceIndexSize;
+    }
+
+    mNumUnindexedResources++;
+
+exit:
+    return;
+}
+
+void CoapBase::RemoveFromResourceIndex(const Resource &aResource)
+{
+    uint16_t slot = GetResourceIndexSlot(aResource.GetUriPath());
+    uint16_t next;
+
+    for (uint16_t i = 0; (i < kResourceIndexSize) && (mResourceIndex[slot] != &aResource); i++)
+    {
+        VerifyOrExit(mResourceIndex[slot] != nullptr, mNumUnindexedResources--);
+        slot = (slot + 1) % kResourceIndexSize;
+    }
+
+    VerifyOrExit(mResourceIndex[slot] == &aResource, mNumUnindexedResources--);
+
+    // Backward shift deletion: move up the following entries of the probe run which would no longer be reachable
+    // from their home slot through the emptied one.
+    mResourceIndex[slot] = nullptr;
+
+    next = slot;
+
+    while (true)
+    {
+        uint16_t home;
+
+        next = (next + 1) % kResourceIndexSize;
+        VerifyOrExit(mResourceIndex[next] != nullptr);
+
+        home = GetResourceIndexSlot(mResourceIndex[next]->GetUriPath());
+
+        if ((next > slot) ? ((home <= slot) || (home > next)) : ((home <= slot) && (home > next)))
+        {
+            mResourceIndex[slot] = mResourceIndex[next];
+            mResourceIndex[next] = nullptr;
+            slot                 = next;
+        }
+    }
+
+exit:
+    return;
+}
+
+uint16_t CoapBase::GetResourceIndexSlot(const char *aUriPath)
+{
+    uint32_t hash = 2166136261u;
+
+    // FNV-1a
+    while (*aUriPath != '\0')
+    {
+        hash = (hash ^ static_cast<uint8_t>(*aUriPath++)) * 16777619u;
+    }
+
+    return static_cast<uint16_t>(hash % kResourceIndexSize);
+}
+
+#endif // OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE > 0
+
 void CoapBase::SetDefaultHandler(RequestHandler aHandler, void *aContext)
 {
     mDefaultHandler        = aHandler;
@@ -447,7 +583,12 @@ void CoapBase::HandleRetransmissionTimer(void)
             metadata.mRetransmissionsRemaining--;
             metadata.mRetransmissionTimeout *= 2;
             metadata.mNextTimerShot = now + metadata.mRetransmissionTimeout;
-            metadata.UpdateIn(*message);
+
+            if (metadata.UpdateIn(*message) != kErrorNone)
+            {
+                FinalizeCoapTransaction(*message, metadata, nullptr, nullptr, kErrorNoBufs);
+                continue;
+            }
 
             // Retransmit
             if (!metadata.mAcknowledged)
@@ -946,7 +1087,7 @@ void CoapBase::SendCopy(const Message &aMessage, const Ip6::MessageInfo &aMessag
     Message *messageCopy = nullptr;
 
     // Create a message copy for lower layers.
-    messageCopy = aMessage.Clone(aMessage.GetLength() - sizeof(Metadata));
+    messageCopy = aMessage.CloneSharingBuffers(aMessage.GetLength() - sizeof(Metadata));
     VerifyOrExit(messageCopy != nullptr, error = kErrorNoBufs);
 
     SuccessOrExit(error = Send(*messageCopy, aMessageInfo));
@@ -1086,8 +1227,10 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
                 // notification.
                 if (metadata.mConfirmable)
                 {
+                    // If the acknowledgment cannot be saved, the request
+                    // is retransmitted again (which is harmless).
                     metadata.mAcknowledged = true;
-                    metadata.UpdateIn(*request);
+                    IgnoreError(metadata.UpdateIn(*request));
                 }
 
                 // Remove the message if response is not expected, otherwise await
@@ -1112,7 +1255,7 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
 
                 // Consider the message acknowledged at this point.
                 metadata.mAcknowledged = true;
-                metadata.UpdateIn(*request);
+                IgnoreError(metadata.UpdateIn(*request));
             }
             else
 #endif
@@ -1380,9 +1523,10 @@ void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo
     SuccessOrExit(error = aMessage.ReadUriPathOptions(uriPath));
 #endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
 
-    for (const Resource *resource = mResources.GetHead(); resource; resource = resource->GetNext())
     {
-        if (strcmp(resource->mUriPath, uriPath) == 0)
+        const Resource *resource = FindResource(uriPath);
+
+        if (resource != nullptr)
         {
             resource->HandleRequest(aMessage, aMessageInfo);
             error = kErrorNone;
@@ -1419,9 +1563,16 @@ void CoapBase::Metadata::ReadFrom(const Message &aMessage)
     IgnoreError(aMessage.Read(length - sizeof(*this), *this));
 }
 
-void CoapBase::Metadata::UpdateIn(Message &aMessage) const
+Error CoapBase::Metadata::UpdateIn(Message &aMessage) const
 {
+    Error error;
+
+    // A retransmitted copy may still share the message buffers.
+    SuccessOrExit(error = aMessage.UnshareBuffers());
     aMessage.Write(aMessage.GetLength() - sizeof(*this), *this);
+
+exit:
+    return error;
 }
 
 ResponsesQueue::ResponsesQueue(Instance &aInstance)
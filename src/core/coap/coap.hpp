@@ -697,7 +697,7 @@ private:
     {
         Error AppendTo(Message &aMessage) const { return aMessage.Append(*this); }
         void  ReadFrom(const Message &aMessage);
-        void  UpdateIn(Message &aMessage) const;
+        Error UpdateIn(Message &aMessage) const;
 
         Ip6::Address    mSourceAddress;            // IPv6 address of the message source.
         Ip6::Address    mDestinationAddress;       // IPv6 address of the message destination.
@@ -758,6 +758,13 @@ private:
     void ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     void ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
+    const Resource *FindResource(const char *aUriPath) const;
+#if OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE > 0
+    void            AddToResourceIndex(const Resource &aResource);
+    void            RemoveFromResourceIndex(const Resource &aResource);
+    static uint16_t GetResourceIndexSlot(const char *aUriPath);
+#endif
+
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
     Error SendNextBlock1Request(Message &               aRequest,
                                 Message &               aMessage,
@@ -780,6 +787,17 @@ private:
     TimerMilliContext mRetransmissionTimer;
 
     LinkedList<Resource> mResources;
+#if OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE > 0
+    enum : uint16_t
+    {
+        kResourceIndexSize = OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE,
+    };
+
+    // Open addressing hash table of `mResources` keyed by Uri-Path. Resources which could not be indexed (table full
+    // or shadowed by a more recently added resource with the same Uri-Path) are counted and only found by list walk.
+    const Resource *mResourceIndex[kResourceIndexSize];
+    uint16_t        mNumUnindexedResources;
+#endif
 
     void *         mContext;
     Interceptor    mInterceptor;
@@ -435,6 +435,18 @@ exit:
     return message;
 }
 
+Message *Message::CloneSharingBuffers(uint16_t aLength) const
+{
+    Message *message = static_cast<Message *>(ot::Message::CloneSharingBuffers(aLength));
+
+    VerifyOrExit(message != nullptr);
+
+    message->GetHelpData() = GetHelpData();
+
+exit:
+    return message;
+}
+
 #if OPENTHREAD_CONFIG_COAP_API_ENABLE
 const char *Message::CodeToString(void) const
 {
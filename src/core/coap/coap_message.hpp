@@ -831,6 +831,17 @@ public:
      */
     Message *Clone(void) const { return Clone(GetLength()); }
 
+    /**
+     * This method creates a copy of the message which shares the message buffers with the original one (see
+     * `ot::Message::CloneSharingBuffers()`).
+     *
+     * @param[in] aLength  Number of payload bytes to copy.
+     *
+     * @returns A pointer to the message or nullptr if insufficient message buffers are available.
+     *
+     */
+    Message *CloneSharingBuffers(uint16_t aLength) const;
+
     /**
      * This method returns the minimal reserved bytes required for CoAP message.
      *
@@ -232,26 +232,37 @@ enum : uint8_t
 
 static void DumpLine(otLogLevel aLogLevel, otLogRegion aLogRegion, const uint8_t *aBytes, const size_t aLength)
 {
-    ot::String<kStringLineLength> string("|");
+    static const char kHexChars[] = "0123456789ABCDEF";
+
+    // The line is formatted directly instead of through `String::Append()` to avoid one `vsnprintf()` per byte.
+    char  line[kStringLineLength];
+    char *cur = line;
+
+    *cur++ = '|';
 
     for (uint8_t i = 0; i < kDumpBytesPerLine; i++)
     {
+        *cur++ = ' ';
+
         if (i < aLength)
         {
-            IgnoreError(string.Append(" %02X", aBytes[i]));
+            *cur++ = kHexChars[aBytes[i] >> 4];
+            *cur++ = kHexChars[aBytes[i] & 0x0f];
         }
         else
         {
-            IgnoreError(string.Append(" .."));
+            *cur++ = '.';
+            *cur++ = '.';
         }
 
         if (!((i + 1) % 8))
         {
-            IgnoreError(string.Append(" |"));
+            *cur++ = ' ';
+            *cur++ = '|';
         }
     }
 
-    IgnoreError(string.Append(" "));
+    *cur++ = ' ';
 
     for (uint8_t i = 0; i < kDumpBytesPerLine; i++)
     {
@@ -267,10 +278,12 @@ static void DumpLine(otLogLevel aLogLevel, otLogRegion aLogRegion, const uint8_t
             }
         }
 
-        IgnoreError(string.Append("%c", c));
+        *cur++ = c;
     }
 
-    otLogDump(aLogLevel, aLogRegion, "%s", string.AsCString());
+    *cur = '\0';
+
+    otLogDump(aLogLevel, aLogRegion, "%s", line);
 }
 
 void otDump(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aId, const void *aBuf, const size_t aLength)
@@ -47,6 +47,11 @@
 #error "OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE conflicts with OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT."
 #endif
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE && \
+    (OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE || OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT)
+#error "OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE requires the built-in message buffer pool."
+#endif
+
 #if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE && !OPENTHREAD_CONFIG_DTLS_ENABLE
 #error "OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE is strongly discouraged when OPENTHREAD_CONFIG_DTLS_ENABLE is off."
 #endif
@@ -62,6 +67,11 @@ MessagePool::MessagePool(Instance &aInstance)
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     otPlatMessagePoolInit(&GetInstance(), kNumBuffers, sizeof(Buffer));
 #endif
+
+    memset(&mBufferStats, 0, sizeof(mBufferStats));
+    mBufferStats.mReservedBuffers[Message::kPriorityNormal] = kReservedBuffersNormal;
+    mBufferStats.mReservedBuffers[Message::kPriorityHigh]   = kReservedBuffersHigh;
+    mBufferStats.mReservedBuffers[Message::kPriorityNet]    = kReservedBuffersNet;
 }
 
 Message *MessagePool::New(Message::Type aType, uint16_t aReserveHeader, Message::Priority aPriority)
@@ -69,7 +79,7 @@ Message *MessagePool::New(Message::Type aType, uint16_t aReserveHeader, Message:
     Error    error = kErrorNone;
     Message *message;
 
-    VerifyOrExit((message = static_cast<Message *>(NewBuffer(aPriority))) != nullptr);
+    VerifyOrExit((message = static_cast<Message *>(NewBuffer(aType, aPriority))) != nullptr);
 
     memset(message, 0, sizeof(*message));
     message->SetMessagePool(this);
@@ -109,11 +119,11 @@ void MessagePool::Free(Message *aMessage)
     FreeBuffers(static_cast<Buffer *>(aMessage));
 }
 
-Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
+Buffer *MessagePool::NewBuffer(Message::Type aType, Message::Priority aPriority)
 {
     Buffer *buffer = nullptr;
 
-    while ((
+    while (!HasFreeBuffers(aPriority) || (
 #if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
                buffer = static_cast<Buffer *>(Instance::HeapCAlloc(1, sizeof(Buffer)))
 #elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
@@ -128,6 +138,10 @@ Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
 
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     mNumFreeBuffers--;
+    UpdateStatsOnNewBuffer(*buffer, aType, aPriority);
+#endif
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+    GetBufferRefCount(*buffer) = 1;
 #endif
 
     buffer->SetNextBuffer(nullptr);
@@ -136,6 +150,10 @@ exit:
     if (buffer == nullptr)
     {
         otLogInfoMem("No available message buffer");
+
+        mBufferStats.mTotal.mFailedAllocations++;
+        mBufferStats.mPriorityUsage[aPriority].mFailedAllocations++;
+        mBufferStats.mTypeUsage[aType].mFailedAllocations++;
     }
 
     return buffer;
@@ -146,11 +164,21 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
     while (aBuffer != nullptr)
     {
         Buffer *next = aBuffer->GetNextBuffer();
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+        // A shared buffer (along with all the buffers following it)
+        // is still used by another message.
+        if (IsBufferShared(*aBuffer))
+        {
+            GetBufferRefCount(*aBuffer)--;
+            break;
+        }
+#endif
 #if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
         Instance::HeapFree(aBuffer);
 #elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
         otPlatMessagePoolFree(&GetInstance(), aBuffer);
 #else
+        UpdateStatsOnFreeBuffer(*aBuffer);
         mBufferPool.Free(*aBuffer);
         mNumFreeBuffers++;
 #endif
@@ -158,9 +186,135 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
     }
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+Error MessagePool::ShareBuffers(Buffer &aBuffer)
+{
+    // Shares `aBuffer` and all the buffers following it with one more
+    // message. No buffer is reserved to copy them, so copying a shared
+    // buffer later can fail (see `Message::UnshareBuffersBefore()`).
+
+    Error error = kErrorNone;
+
+    VerifyOrExit(GetBufferRefCount(aBuffer) < kMaxBufferRefCount, error = kErrorNoBufs);
+    GetBufferRefCount(aBuffer)++;
+
+exit:
+    return error;
+}
+#endif
+
+bool MessagePool::HasFreeBuffers(Message::Priority aPriority) const
+{
+    uint16_t numUnavailable = GetUnavailableBufferCount(aPriority);
+
+    return (numUnavailable == 0) || (GetFreeBufferCount() > numUnavailable);
+}
+
+uint16_t MessagePool::GetUnavailableBufferCount(Message::Priority aPriority)
+{
+    // Returns the number of buffers reserved for the priority levels
+    // higher than `aPriority`.
+
+    uint16_t count = 0;
+
+    switch (aPriority)
+    {
+    case Message::kPriorityLow:
+        count += kReservedBuffersNormal;
+        OT_FALL_THROUGH;
+
+    case Message::kPriorityNormal:
+        count += kReservedBuffersHigh;
+        OT_FALL_THROUGH;
+
+    case Message::kPriorityHigh:
+        count += kReservedBuffersNet;
+        OT_FALL_THROUGH;
+
+    case Message::kPriorityNet:
+        break;
+    }
+
+    return count;
+}
+
+#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+void MessagePool::UpdateStatsOnNewBuffer(const Buffer &aBuffer, Message::Type aType, Message::Priority aPriority)
+{
+    mBufferCategories[mBufferPool.GetIndexOf(aBuffer)] =
+        static_cast<uint8_t>((aType << kCategoryTypeShift) | static_cast<uint8_t>(aPriority));
+
+    AddUsedBuffer(mBufferStats.mTotal);
+    AddUsedBuffer(mBufferStats.mPriorityUsage[aPriority]);
+    AddUsedBuffer(mBufferStats.mTypeUsage[aType]);
+}
+
+void MessagePool::UpdateStatsOnFreeBuffer(const Buffer &aBuffer)
+{
+    uint8_t category = mBufferCategories[mBufferPool.GetIndexOf(aBuffer)];
+
+    mBufferStats.mTotal.mUsedBuffers--;
+    mBufferStats.mPriorityUsage[category & kCategoryPriority].mUsedBuffers--;
+    mBufferStats.mTypeUsage[category >> kCategoryTypeShift].mUsedBuffers--;
+}
+
+void MessagePool::AddUsedBuffer(otMessageBufferUsage &aUsage)
+{
+    aUsage.mUsedBuffers++;
+
+    if (aUsage.mMaxUsedBuffers < aUsage.mUsedBuffers)
+    {
+        aUsage.mMaxUsedBuffers = aUsage.mUsedBuffers;
+    }
+}
+#endif // !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+
+void MessagePool::ResetBufferStats(void)
+{
+    ResetBufferUsage(mBufferStats.mTotal);
+
+    for (otMessageBufferUsage &usage : mBufferStats.mPriorityUsage)
+    {
+        ResetBufferUsage(usage);
+    }
+
+    for (otMessageBufferUsage &usage : mBufferStats.mTypeUsage)
+    {
+        ResetBufferUsage(usage);
+    }
+}
+
+void MessagePool::ResetBufferUsage(otMessageBufferUsage &aUsage)
+{
+    aUsage.mMaxUsedBuffers    = aUsage.mUsedBuffers;
+    aUsage.mFailedAllocations = 0;
+}
+
 Error MessagePool::ReclaimBuffers(Message::Priority aPriority)
 {
-    return Get<MeshForwarder>().EvictMessage(aPriority);
+#if OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE && OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    // Cached DNS responses can always be fetched again, so they are
+    // given up before any queued message.
+    if (Get<Dns::Client>().EvictCacheEntry() == kErrorNone)
+    {
+        return kErrorNone;
+    }
+#endif
+
+    // A partially reassembled datagram is worthless until all of its
+    // fragments arrive, so a lower priority one is dropped before a
+    // complete message waiting to be sent.
+    if (Get<MeshForwarder>().EvictReassembly(aPriority) == kErrorNone)
+    {
+        return kErrorNone;
+    }
+
+    // When the pool is not empty, only the reservation of the higher
+    // priority levels blocks the allocation. Evicting a message of the
+    // same (or higher) priority would then take buffers away from a
+    // message the reservation is meant to protect, so only lower
+    // priority messages are evicted.
+    return Get<MeshForwarder>().EvictMessage(aPriority, GetFreeBufferCount() > 0);
 }
 
 uint16_t MessagePool::GetFreeBufferCount(void) const
@@ -209,19 +363,35 @@ Error Message::ResizeMessage(uint16_t aLength)
     Buffer * curBuffer = this;
     Buffer * lastBuffer;
     uint16_t curLength = kHeadBufferDataSize;
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+    bool isShared = false;
+#endif
 
     while (curLength < aLength)
     {
         if (curBuffer->GetNextBuffer() == nullptr)
         {
-            curBuffer->SetNextBuffer(GetMessagePool()->NewBuffer(GetPriority()));
+            curBuffer->SetNextBuffer(GetMessagePool()->NewBuffer(GetType(), GetPriority()));
             VerifyOrExit(curBuffer->GetNextBuffer() != nullptr, error = kErrorNoBufs);
         }
 
         curBuffer = curBuffer->GetNextBuffer();
         curLength += kBufferDataSize;
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+        isShared = isShared || GetMessagePool()->IsBufferShared(*curBuffer);
+#endif
     }
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+    // The remaining buffers cannot be unlinked from a buffer which is
+    // shared with another message (or follows a shared one). They are
+    // still used by the other message and are kept (unused) until the
+    // message is freed or grows into them again.
+
+    VerifyOrExit(!isShared);
+#endif
+
     // remove buffers
     lastBuffer = curBuffer;
     curBuffer  = curBuffer->GetNextBuffer();
@@ -269,7 +439,19 @@ Error Message::SetLength(uint16_t aLength)
 
     VerifyOrExit(totalLengthRequest >= GetReserved(), error = kErrorInvalidArgs);
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+    // The new bytes are written by the caller next. Any shared buffer
+    // holding them is copied first, so that new buffers are never
+    // added to a buffer chain shared with another message.
+
+    if (aLength > GetLength())
+    {
+        SuccessOrExit(error = UnshareBuffersBefore(totalLengthRequest));
+    }
+#endif
+
     SuccessOrExit(error = ResizeMessage(totalLengthRequest));
+
     GetMetadata().mLength = aLength;
 
     // Correct offset in case shorter length is set.
@@ -417,7 +599,8 @@ Error Message::PrependBytes(const void *aBuf, uint16_t aLength)
 
     while (aLength > GetReserved())
     {
-        VerifyOrExit((newBuffer = GetMessagePool()->NewBuffer(GetPriority())) != nullptr, error = kErrorNoBufs);
+        newBuffer = GetMessagePool()->NewBuffer(GetType(), GetPriority());
+        VerifyOrExit(newBuffer != nullptr, error = kErrorNoBufs);
 
         newBuffer->SetNextBuffer(GetNextBuffer());
         SetNextBuffer(newBuffer);
@@ -432,6 +615,10 @@ Error Message::PrependBytes(const void *aBuf, uint16_t aLength)
         SetReserved(GetReserved() + kBufferDataSize);
     }
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+    SuccessOrExit(error = UnshareBuffersBefore(GetReserved()));
+#endif
+
     SetReserved(GetReserved() - aLength);
     GetMetadata().mLength += aLength;
     SetOffset(GetOffset() + aLength);
@@ -617,6 +804,19 @@ void Message::WriteBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength)
 
     OT_ASSERT(aOffset + aLength <= GetLength());
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+    {
+        // The caller makes sure shared buffers can be written (see
+        // `UnshareBuffers()`). They are never written in place, as
+        // this would change the other message too.
+
+        Error error = UnshareBuffersBefore(GetReserved() + aOffset + aLength);
+
+        OT_ASSERT(error == kErrorNone);
+        VerifyOrExit(error == kErrorNone);
+    }
+#endif
+
     GetFirstChunk(aOffset, aLength, chunk);
 
     while (chunk.GetLength() > 0)
@@ -625,6 +825,11 @@ void Message::WriteBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength)
         bufPtr += chunk.GetLength();
         GetNextChunk(aLength, chunk);
     }
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+exit:
+    return;
+#endif
 }
 
 uint16_t Message::CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, uint16_t aLength, Message &aMessage) const
@@ -652,21 +857,39 @@ uint16_t Message::CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, ui
     return bytesCopied;
 }
 
-Message *Message::Clone(uint16_t aLength) const
+Message *Message::Clone(uint16_t aLength, bool aShareBuffers) const
 {
     Error    error = kErrorNone;
     Message *messageCopy;
     uint16_t offset;
 
-    VerifyOrExit((messageCopy = GetMessagePool()->New(GetType(), GetReserved(), GetPriority())) != nullptr,
-                 error = kErrorNoBufs);
-    SuccessOrExit(error = messageCopy->SetLength(aLength));
-    CopyTo(0, 0, aLength, *messageCopy);
+    VerifyOrExit((messageCopy = GetMessagePool()->New(GetType(), 0, GetPriority())) != nullptr, error = kErrorNoBufs);
+    messageCopy->SetReserved(GetReserved());
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+    if (aShareBuffers && (aLength <= GetLength()) && (messageCopy->ShareBuffers(*this) == kErrorNone))
+    {
+        messageCopy->GetMetadata().mLength = aLength;
+    }
+    else
+#endif
+    {
+        OT_UNUSED_VARIABLE(aShareBuffers);
+
+        SuccessOrExit(error = messageCopy->SetLength(aLength));
+        CopyTo(0, 0, aLength, *messageCopy);
+    }
 
     // Copy selected message information.
     offset = GetOffset() < aLength ? GetOffset() : aLength;
     messageCopy->SetOffset(offset);
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+    // The lower layers update the headers (before the offset) of a
+    // sent message, so the buffers holding them are not shared.
+    SuccessOrExit(error = messageCopy->UnshareBuffersBefore(GetReserved() + offset));
+#endif
+
     messageCopy->SetSubType(GetSubType());
     messageCopy->SetLinkSecurityEnabled(IsLinkSecurityEnabled());
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
@@ -678,6 +901,111 @@ exit:
     return messageCopy;
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+
+Error Message::ShareBuffers(const Message &aMessage)
+{
+    // This method makes this (empty) message use the buffers of
+    // `aMessage`. The first buffer (which also holds the message
+    // metadata) is copied and the rest of the buffers are shared.
+
+    Error   error   = kErrorNone;
+    Buffer *buffers = const_cast<Buffer *>(aMessage.GetNextBuffer());
+
+    OT_ASSERT(GetNextBuffer() == nullptr);
+
+    if (buffers != nullptr)
+    {
+        SuccessOrExit(error = GetMessagePool()->ShareBuffers(*buffers));
+    }
+
+    memcpy(GetFirstData(), aMessage.GetFirstData(), kHeadBufferDataSize);
+    SetNextBuffer(buffers);
+
+exit:
+    return error;
+}
+
+Error Message::UnshareBuffersBefore(uint16_t aEndOffset)
+{
+    // This method ensures that none of the buffers holding the bytes
+    // before `aEndOffset` (which includes the reserved header bytes)
+    // is shared with another message, so they can be written. A
+    // shared buffer is replaced with a copy. Since all the buffers
+    // following a shared buffer are also used by the other message,
+    // they are copied as well (up to the one holding `aEndOffset`).
+    // The last copy then shares the rest of the buffers.
+    //
+    // If a copy cannot be allocated, the message is left unchanged.
+
+    Error        error  = kErrorNone;
+    MessagePool *pool   = GetMessagePool();
+    Buffer *     prev   = this;
+    Buffer *     shared = GetNextBuffer();
+    Buffer *     copies = nullptr;
+    Buffer *     last   = nullptr;
+    Buffer *     rest;
+    uint16_t     offset = kHeadBufferDataSize;
+
+    while ((shared != nullptr) && (offset < aEndOffset) && !pool->IsBufferShared(*shared))
+    {
+        prev   = shared;
+        shared = shared->GetNextBuffer();
+        offset += kBufferDataSize;
+    }
+
+    VerifyOrExit((shared != nullptr) && (offset < aEndOffset));
+
+    rest = shared;
+
+    // A `rest` buffer which cannot be shared once more is copied too.
+    while ((rest != nullptr) &&
+           ((offset < aEndOffset) || (pool->GetBufferRefCount(*rest) == MessagePool::kMaxBufferRefCount)))
+    {
+        Buffer *newBuffer = pool->NewBuffer(GetType(), GetPriority());
+
+        if (newBuffer == nullptr)
+        {
+            pool->FreeBuffers(copies);
+            ExitNow(error = kErrorNoBufs);
+        }
+
+        memcpy(newBuffer->GetData(), rest->GetData(), kBufferDataSize);
+
+        if (last == nullptr)
+        {
+            copies = newBuffer;
+        }
+        else
+        {
+            last->SetNextBuffer(newBuffer);
+        }
+
+        last = newBuffer;
+        rest = rest->GetNextBuffer();
+        offset += kBufferDataSize;
+    }
+
+    // The message now refers to the `rest` buffers through the last
+    // copy, and no longer to the `shared` buffer. Releasing `shared`
+    // also frees the copied buffers in case the other message was
+    // freed (e.g. evicted to allocate the copies) in the meantime.
+
+    if (rest != nullptr)
+    {
+        pool->GetBufferRefCount(*rest)++;
+    }
+
+    last->SetNextBuffer(rest);
+    prev->SetNextBuffer(copies);
+    pool->FreeBuffers(shared);
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+
 bool Message::GetChildMask(uint16_t aChildIndex) const
 {
     return GetMetadata().mChildMask.Get(aChildIndex);
@@ -685,17 +1013,29 @@ bool Message::GetChildMask(uint16_t aChildIndex) const
 
 void Message::ClearChildMask(uint16_t aChildIndex)
 {
+    VerifyOrExit(GetMetadata().mChildMask.Get(aChildIndex));
+
     GetMetadata().mChildMask.Set(aChildIndex, false);
+    GetMetadata().mNumChildrenInMask--;
+
+exit:
+    return;
 }
 
 void Message::SetChildMask(uint16_t aChildIndex)
 {
+    VerifyOrExit(!GetMetadata().mChildMask.Get(aChildIndex));
+
     GetMetadata().mChildMask.Set(aChildIndex, true);
+    GetMetadata().mNumChildrenInMask++;
+
+exit:
+    return;
 }
 
 bool Message::IsChildPending(void) const
 {
-    return GetMetadata().mChildMask.HasAny();
+    return (GetMetadata().mNumChildrenInMask != 0);
 }
 
 void Message::SetLinkInfo(const ThreadLinkInfo &aLinkInfo)
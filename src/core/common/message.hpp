@@ -171,9 +171,10 @@ struct MessageMetadata
     LqiAverager mLqiAverager; ///< The averager maintaining the Link quality indicator (LQI) average.
 #endif
 
-    ChildMask mChildMask; ///< A ChildMask to indicate which sleepy children need to receive this.
-    uint16_t  mMeshDest;  ///< Used for unicast non-link-local messages.
-    uint8_t   mTimeout;   ///< Seconds remaining before dropping the message.
+    ChildMask mChildMask;         ///< A ChildMask to indicate which sleepy children need to receive this.
+    uint16_t  mNumChildrenInMask; ///< Number of children set in `mChildMask`.
+    uint16_t  mMeshDest;          ///< Used for unicast non-link-local messages.
+    uint8_t   mTimeout;           ///< Seconds remaining before dropping the message.
     union
     {
         uint16_t mPanId;   ///< Used for MLE Discover Request and Response messages.
@@ -805,6 +806,9 @@ public:
      * This method will not resize the message. The given data to write (with @p aLength bytes) MUST fit within the
      * existing message buffer (from the given offset @p aOffset up to the message's length).
      *
+     * The written bytes MUST NOT be in buffers shared with another message (see `CloneSharingBuffers()`), unless the
+     * shared buffers can be copied. `UnshareBuffers()` can be used to first copy them.
+     *
      * @param[in]  aOffset  Byte offset within the message to begin writing.
      * @param[in]  aBuf     A pointer to a data buffer.
      * @param[in]  aLength  Number of bytes to write.
@@ -860,7 +864,39 @@ public:
      * @returns A pointer to the message or nullptr if insufficient message buffers are available.
      *
      */
-    Message *Clone(uint16_t aLength) const;
+    Message *Clone(uint16_t aLength) const { return Clone(aLength, /* aShareBuffers */ false); }
+
+    /**
+     * This method creates a copy of the message which shares the message buffers with the original one.
+     *
+     * This method is intended for a copy which is only sent (e.g. a retransmission) while the original message is
+     * kept. It behaves as `Clone()`, but when `OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE` is enabled and
+     * @p aLength is not larger than the message length, only the first buffer and the buffers holding the bytes before
+     * the message offset (e.g. the headers) are copied. The remaining buffers are shared between the two messages.
+     *
+     * A shared buffer is copied when either message changes its length or prepends bytes, which fails if no buffer is
+     * available. Bytes in shared buffers MUST NOT be written otherwise (see `UnshareBuffers()`).
+     *
+     * @param[in] aLength  Number of payload bytes to copy.
+     *
+     * @returns A pointer to the message or nullptr if insufficient message buffers are available.
+     *
+     */
+    Message *CloneSharingBuffers(uint16_t aLength) const { return Clone(aLength, /* aShareBuffers */ true); }
+
+    /**
+     * This method copies the message buffers which are shared with another message (see `CloneSharingBuffers()`), so
+     * that the message content can be written.
+     *
+     * @retval kErrorNone    The message buffers are no longer shared.
+     * @retval kErrorNoBufs  Insufficient message buffers are available to copy the shared buffers.
+     *
+     */
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+    Error UnshareBuffers(void) { return UnshareBuffersBefore(GetReserved() + GetLength()); }
+#else
+    Error UnshareBuffers(void) { return kErrorNone; }
+#endif
 
     /**
      * This method creates a copy of the message.
@@ -1374,6 +1410,13 @@ private:
     void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &chunk) const;
     void GetNextChunk(uint16_t &aLength, Chunk &aChunk) const;
 
+    Message *Clone(uint16_t aLength, bool aShareBuffers) const;
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+    Error ShareBuffers(const Message &aMessage);
+    Error UnshareBuffersBefore(uint16_t aEndOffset);
+#endif
+
     void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, WritableChunk &aChunk)
     {
         const_cast<const Message *>(this)->GetFirstChunk(aOffset, aLength, static_cast<Chunk &>(aChunk));
@@ -1640,15 +1683,75 @@ public:
      */
     uint16_t GetTotalBufferCount(void) const;
 
+    /**
+     * This method returns the message buffer statistics.
+     *
+     * @returns The message buffer statistics.
+     *
+     */
+    const otMessageBufferStats &GetBufferStats(void) const { return mBufferStats; }
+
+    /**
+     * This method resets the message buffer statistics.
+     *
+     * The failed allocation counters are cleared and the max number of used buffers is set to the number of buffers
+     * currently in use.
+     *
+     */
+    void ResetBufferStats(void);
+
 private:
-    Buffer *NewBuffer(Message::Priority aPriority);
-    void    FreeBuffers(Buffer *aBuffer);
-    Error   ReclaimBuffers(Message::Priority aPriority);
+    static_assert(Message::kNumPriorities == OT_MESSAGE_NUM_PRIORITIES, "OT_MESSAGE_NUM_PRIORITIES is incorrect");
+    static_assert(Message::kTypeOther + 1 == OT_MESSAGE_NUM_TYPES, "OT_MESSAGE_NUM_TYPES is incorrect");
+
+    static constexpr uint16_t kReservedBuffersNormal = OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NORMAL;
+    static constexpr uint16_t kReservedBuffersHigh   = OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH;
+    static constexpr uint16_t kReservedBuffersNet    = OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NET;
+
+    static_assert(kReservedBuffersNormal + kReservedBuffersHigh + kReservedBuffersNet < kNumBuffers,
+                  "Reserved message buffers exceed OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS");
+
+    Buffer *        NewBuffer(Message::Type aType, Message::Priority aPriority);
+    void            FreeBuffers(Buffer *aBuffer);
+    Error           ReclaimBuffers(Message::Priority aPriority);
+    bool            HasFreeBuffers(Message::Priority aPriority) const;
+    static uint16_t GetUnavailableBufferCount(Message::Priority aPriority);
+    static void     ResetBufferUsage(otMessageBufferUsage &aUsage);
+
+#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    enum : uint8_t
+    {
+        kCategoryTypeShift = 2,
+        kCategoryPriority  = (1 << kCategoryTypeShift) - 1,
+    };
+
+    void        UpdateStatsOnNewBuffer(const Buffer &aBuffer, Message::Type aType, Message::Priority aPriority);
+    void        UpdateStatsOnFreeBuffer(const Buffer &aBuffer);
+    static void AddUsedBuffer(otMessageBufferUsage &aUsage);
+#endif
+
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+    enum : uint8_t
+    {
+        kMaxBufferRefCount = 0xff,
+    };
+
+    Error    ShareBuffers(Buffer &aBuffer);
+    bool     IsBufferShared(const Buffer &aBuffer) { return GetBufferRefCount(aBuffer) > 1; }
+    uint8_t &GetBufferRefCount(const Buffer &aBuffer) { return mBufferRefCounts[mBufferPool.GetIndexOf(aBuffer)]; }
+#endif
 
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     uint16_t                  mNumFreeBuffers;
     Pool<Buffer, kNumBuffers> mBufferPool;
 #endif
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+    uint8_t mBufferRefCounts[kNumBuffers]; // Number of messages/buffers referring to each buffer in `mBufferPool`.
+#endif
+#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    uint8_t mBufferCategories[kNumBuffers]; // Message type and priority each buffer in `mBufferPool` is counted under.
+#endif
+    otMessageBufferStats mBufferStats;
 };
 
 /**
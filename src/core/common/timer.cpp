@@ -98,6 +98,152 @@ void TimerMilli::Stop(void)
     Get<TimerMilliScheduler>().Remove(*this);
 }
 
+#if OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+
+void TimerScheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    Time now(aAlarmApi.AlarmGetNow());
+
+    Remove(aTimer, aAlarmApi);
+
+    aTimer.mNext  = nullptr;
+    aTimer.mPrev  = nullptr;
+    aTimer.mChild = nullptr;
+
+    mHeapRoot = Meld(mHeapRoot, &aTimer, now);
+
+    if (mHeapRoot == &aTimer)
+    {
+        SetAlarm(aAlarmApi);
+    }
+}
+
+void TimerScheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    Time now(aAlarmApi.AlarmGetNow());
+
+    VerifyOrExit(aTimer.IsRunning());
+
+    if (mHeapRoot == &aTimer)
+    {
+        mHeapRoot = MergePairs(aTimer.mChild, now);
+        SetAlarm(aAlarmApi);
+    }
+    else
+    {
+        Timer *root = mHeapRoot;
+        Timer *subHeap;
+
+        // Unlink `aTimer` (along with its sub-heap) from its parent or previous sibling.
+
+        if (aTimer.mPrev->mChild == &aTimer)
+        {
+            aTimer.mPrev->mChild = aTimer.mNext;
+        }
+        else
+        {
+            aTimer.mPrev->mNext = aTimer.mNext;
+        }
+
+        if (aTimer.mNext != nullptr)
+        {
+            aTimer.mNext->mPrev = aTimer.mPrev;
+        }
+
+        subHeap = MergePairs(aTimer.mChild, now);
+
+        if (subHeap != nullptr)
+        {
+            mHeapRoot = Meld(mHeapRoot, subHeap, now);
+
+            if (mHeapRoot != root)
+            {
+                SetAlarm(aAlarmApi);
+            }
+        }
+    }
+
+    aTimer.mChild = nullptr;
+    aTimer.mPrev  = nullptr;
+    aTimer.SetNext(&aTimer);
+
+exit:
+    return;
+}
+
+Timer *TimerScheduler::Meld(Timer *aFirst, Timer *aSecond, Time aNow)
+{
+    // Melds two heaps (`aFirst` and `aSecond` are their roots) and
+    // returns the root of the resulting heap. On a tie, `aFirst`
+    // remains the root.
+
+    Timer *root  = aFirst;
+    Timer *child = aSecond;
+
+    VerifyOrExit(aFirst != nullptr, root = aSecond);
+    VerifyOrExit(aSecond != nullptr);
+
+    if (aSecond->DoesFireBefore(*aFirst, aNow))
+    {
+        root  = aSecond;
+        child = aFirst;
+    }
+
+    child->mPrev = root;
+    child->mNext = root->mChild;
+
+    if (root->mChild != nullptr)
+    {
+        root->mChild->mPrev = child;
+    }
+
+    root->mChild = child;
+
+exit:
+    if (root != nullptr)
+    {
+        root->mNext = nullptr;
+        root->mPrev = nullptr;
+    }
+
+    return root;
+}
+
+Timer *TimerScheduler::MergePairs(Timer *aFirst, Time aNow)
+{
+    // Performs the standard two-pass pairing of a list of sibling
+    // heaps (starting from `aFirst`) and returns the root of the
+    // resulting heap. The first pass melds siblings in pairs from
+    // left to right, chaining the results in reverse order (through
+    // `mNext`). The second pass melds them from right to left.
+
+    Timer *pairs = nullptr;
+    Timer *root  = nullptr;
+
+    while (aFirst != nullptr)
+    {
+        Timer *second = aFirst->mNext;
+        Timer *next   = (second != nullptr) ? second->mNext : nullptr;
+        Timer *merged = Meld(aFirst, second, aNow);
+
+        merged->mNext = pairs;
+        pairs         = merged;
+        aFirst        = next;
+    }
+
+    while (pairs != nullptr)
+    {
+        Timer *next = pairs->mNext;
+
+        root  = Meld(root, pairs, aNow);
+        pairs = next;
+    }
+
+    return root;
+}
+
+#else // OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+
 void TimerScheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
 {
     Timer *prev = nullptr;
@@ -144,15 +290,18 @@ exit:
     return;
 }
 
+#endif // OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+
 void TimerScheduler::SetAlarm(const AlarmApi &aAlarmApi)
 {
-    if (mTimerList.IsEmpty())
+    Timer *timer = GetHead();
+
+    if (timer == nullptr)
     {
         aAlarmApi.AlarmStop(&GetInstance());
     }
     else
     {
-        Timer *  timer = mTimerList.GetHead();
         Time     now(aAlarmApi.AlarmGetNow());
         uint32_t remaining;
 
@@ -164,7 +313,7 @@ void TimerScheduler::SetAlarm(const AlarmApi &aAlarmApi)
 
 void TimerScheduler::ProcessTimers(const AlarmApi &aAlarmApi)
 {
-    Timer *timer = mTimerList.GetHead();
+    Timer *timer = GetHead();
 
     if (timer)
     {
@@ -99,6 +99,10 @@ public:
         , mHandler(aHandler)
         , mFireTime()
         , mNext(this)
+#if OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+        , mChild(nullptr)
+        , mPrev(nullptr)
+#endif
     {
     }
 
@@ -136,7 +140,11 @@ protected:
 
     Handler mHandler;
     Time    mFireTime;
-    Timer * mNext;
+    Timer * mNext; // Next timer in list, or next sibling when in pairing heap.
+#if OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+    Timer *mChild; // Leftmost child in pairing heap.
+    Timer *mPrev;  // Parent (when leftmost child) or previous sibling in pairing heap.
+#endif
 };
 
 /**
@@ -273,6 +281,9 @@ protected:
      */
     explicit TimerScheduler(Instance &aInstance)
         : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+        , mHeapRoot(nullptr)
+#endif
     {
     }
 
@@ -310,7 +321,18 @@ protected:
      */
     void SetAlarm(const AlarmApi &aAlarmApi);
 
+#if OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+    Timer *GetHead(void) { return mHeapRoot; }
+
+    static Timer *Meld(Timer *aFirst, Timer *aSecond, Time aNow);
+    static Timer *MergePairs(Timer *aFirst, Time aNow);
+
+    Timer *mHeapRoot;
+#else
+    Timer *GetHead(void) { return mTimerList.GetHead(); }
+
     LinkedList<Timer> mTimerList;
+#endif
 };
 
 /**
@@ -47,6 +47,19 @@
 #define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE
+ *
+ * The number of slots in the hash table used by each CoAP agent to look up resources by Uri-Path.
+ *
+ * It should be larger than the number of resources added to an agent (TMF adds around 40 on a Border Router). Define
+ * as 0 to find resources by walking the resource list instead.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE
+#define OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_API_ENABLE
  *
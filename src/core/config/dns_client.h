@@ -132,4 +132,55 @@
 #define OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_RECURSION_DESIRED_FLAG 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+ *
+ * Define to 1 to enable the DNS client response cache.
+ *
+ * When enabled, responses are kept (in message buffers) and later queries for the same name and record type are
+ * answered from the cache (invoking the callback before the query method returns) until the TTL of the response
+ * expires. Cached responses are released first when the message pool runs out of buffers.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES
+ *
+ * Specifies the maximum number of responses kept in the DNS client cache.
+ *
+ * When the cache is full, the least recently used response is evicted.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL
+ *
+ * Specifies the maximum time (in seconds) a negative response (name does not exist or has no matching records) is
+ * kept in the DNS client cache.
+ *
+ * A shorter TTL is used when given in an authority record of the response.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL 30
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL
+ *
+ * Specifies the maximum time (in seconds) a response is kept in the DNS client cache, whatever the TTL of its records.
+ *
+ * It must not be longer than `TimerMilli::kMaxDelay` (about 24 days).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL 86400
+#endif
+
 #endif // CONFIG_DNS_CLIENT_H_
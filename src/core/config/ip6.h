@@ -75,6 +75,19 @@
 #define OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH 1280
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE
+ *
+ * The number of slots in the hash table used to look up the UDP socket of a received datagram by destination port.
+ *
+ * It should be larger than the number of open UDP sockets. Define as 0 to find sockets by walking the socket list
+ * instead.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE
+#define OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_ENABLE_IP6_FRAGMENTATION
  *
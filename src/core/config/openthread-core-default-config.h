@@ -166,6 +166,56 @@
 #define OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE (sizeof(void *) * 32)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+ *
+ * Define as 1 to let the message copies sent for MPL and CoAP retransmissions share the message buffers (other than
+ * the first one) with the original message instead of copying them (see `Message::CloneSharingBuffers()`). A shared
+ * buffer is copied when either message changes its content.
+ *
+ * The buffers are reference counted by the message pool, so this is only supported with the built-in buffer pool,
+ * i.e., when neither OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE nor OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT is
+ * enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE \
+    (!OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE && !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT)
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NORMAL
+ *
+ * The number of message buffers reserved for messages with normal or higher priority level. Low priority messages
+ * cannot use these buffers.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NORMAL
+#define OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NORMAL 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH
+ *
+ * The number of message buffers reserved for messages with high or network control priority level. Low and normal
+ * priority messages cannot use these buffers.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH
+#define OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NET
+ *
+ * The number of message buffers reserved for messages with network control priority level (e.g., MLE messages).
+ * Messages with any other priority level cannot use these buffers.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NET
+#define OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NET 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DEFAULT_TRANSMIT_POWER
  *
@@ -192,6 +242,21 @@
 #define OPENTHREAD_CONFIG_DROP_MESSAGE_ON_FRAGMENT_TX_FAILURE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_INDIRECT_MESSAGE_INDEX_ENTRIES
+ *
+ * The number of entries in the per-child indexes of messages queued for indirect transmission to sleepy children.
+ *
+ * An entry is used for every (message, child) pair, i.e., a multicast message queued for N sleepy children uses N
+ * entries. When no entry is available, the messages of the affected child are found by searching the send queue until
+ * all of its queued messages are sent or removed.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_INDIRECT_MESSAGE_INDEX_ENTRIES
+#define OPENTHREAD_CONFIG_INDIRECT_MESSAGE_INDEX_ENTRIES \
+    (OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS + OPENTHREAD_CONFIG_MLE_MAX_CHILDREN)
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT
  *
@@ -202,6 +267,18 @@
 #define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES
+ *
+ * The maximum number of 6LoWPAN datagrams that can be reassembled at the same time.
+ *
+ * When all entries are in use, a new first fragment evicts the reassembly with the shortest remaining lifetime.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_JOINER_UDP_PORT
  *
@@ -345,6 +422,18 @@
 #define OPENTHREAD_CONFIG_ENABLE_DEBUG_UART 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_HDLC_FCS_SLICE_BY_8_ENABLE
+ *
+ * Define as 1 to compute the HDLC FCS eight bytes at a time (slice-by-8) when encoding or decoding a block of data.
+ *
+ * This adds 3.5 KB of constant lookup tables and is intended for hosts driving a fast link to the RCP.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_HDLC_FCS_SLICE_BY_8_ENABLE
+#define OPENTHREAD_CONFIG_HDLC_FCS_SLICE_BY_8_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH
  *
@@ -503,4 +592,86 @@
 #define OPENTHREAD_CONFIG_NEIGHBOR_DISCOVERY_AGENT_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+ *
+ * Define as 1 to use a pairing heap (instead of a sorted linked list) in the timer scheduler.
+ *
+ * The pairing heap provides O(1) timer start and amortized O(log n) timer stop/expiry, at the cost of two additional
+ * pointers per timer. It is intended for devices running a large number of timers (e.g., border routers).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_PAIRING_HEAP_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_LOOKUP_CACHE_MAX_PREFIXES
+ *
+ * The maximum number of Prefix TLVs held in the Leader Network Data lookup cache.
+ *
+ * The lookup cache is rebuilt from the Network Data TLVs when the Network Data version changes and is used by context
+ * and route lookups done per packet. Lookups fall back to parsing the Network Data TLVs when it contains more Prefix
+ * TLVs than the cache can hold.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_LOOKUP_CACHE_MAX_PREFIXES
+#define OPENTHREAD_CONFIG_NETDATA_LOOKUP_CACHE_MAX_PREFIXES 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_LOOKUP_CACHE_MAX_ROUTES
+ *
+ * The maximum number of route entries (external and default routes across all prefixes) held in the Leader Network
+ * Data lookup cache.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_LOOKUP_CACHE_MAX_ROUTES
+#define OPENTHREAD_CONFIG_NETDATA_LOOKUP_CACHE_MAX_ROUTES 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_SIZE
+ *
+ * The number of derived MLE/MAC key pairs (each for a given Key Sequence) cached by the Key Manager.
+ *
+ * Keys are derived using HMAC-SHA256 from the Thread Master Key. The cache avoids re-deriving keys for the previous,
+ * current, and next Key Sequence on key rotation and when receiving MLE messages from neighbors on an adjacent Key
+ * Sequence. The cache is cleared when the Master Key changes.
+ *
+ * Must be between 1 and 255 (the entry holding the current Key Sequence keys is always needed).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_SIZE
+#define OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_SIZE 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_AES_HARDWARE_ACCELERATION_ENABLE
+ *
+ * Define as 1 to encrypt AES blocks using the CPU AES instructions when available.
+ *
+ * Supported are AES-NI on x86-64 and the ARMv8 Cryptography Extension on AArch64 Linux (when building with the crypto
+ * extension enabled). Support is detected at run time and mbedtls is used when the instructions are not available.
+ * This is intended for hosts doing link security in software (e.g., POSIX with a transparent RCP, or simulation).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_AES_HARDWARE_ACCELERATION_ENABLE
+#define OPENTHREAD_CONFIG_AES_HARDWARE_ACCELERATION_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE
+ *
+ * The number of expanded AES-128 key schedules cached by the `KeyManager` of each OpenThread instance.
+ *
+ * A new `AesCcm` is used for every secured frame or MLE message, and the cache avoids expanding the same MAC or MLE
+ * key again each time. Each entry uses `sizeof(mbedtls_aes_context)` plus 16 bytes. The cache is wiped when the
+ * Thread Master Key changes and when the `KeyManager` is stopped. Set to 0 to disable the cache.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE
+#define OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE 0
+#endif
+
 #endif // OPENTHREAD_CORE_DEFAULT_CONFIG_H_
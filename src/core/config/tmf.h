@@ -45,6 +45,16 @@
 #define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_SIZE
+ *
+ * The number of hash buckets used to index the EID-to-RLOC cache entries by EID.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_SIZE
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_SIZE OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_MAX_SNOOP_ENTRIES
  *
@@ -47,9 +47,9 @@ void AesCcm::SetKey(const uint8_t *aKey, uint16_t aKeyLength)
     mEcb.SetKey(aKey, CHAR_BIT * aKeyLength);
 }
 
-void AesCcm::SetKey(const Mac::Key &aMacKey)
+void AesCcm::SetKey(const Mac::Key &aMacKey, AesKeyScheduleCache *aKeyScheduleCache)
 {
-    SetKey(aMacKey.GetKey(), Mac::Key::kSize);
+    mEcb.SetKey(aMacKey.GetKey(), CHAR_BIT * Mac::Key::kSize, aKeyScheduleCache);
 }
 
 void AesCcm::Init(uint32_t    aHeaderLength,
@@ -188,13 +188,14 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
 {
     uint8_t *plaintextBytes  = reinterpret_cast<uint8_t *>(aPlainText);
     uint8_t *ciphertextBytes = reinterpret_cast<uint8_t *>(aCipherText);
+    uint32_t remaining       = aLength;
     uint8_t  byte;
 
     OT_ASSERT(mPlainTextCur + aLength <= mPlainTextLength);
 
-    for (unsigned i = 0; i < aLength; i++)
+    while (remaining > 0)
     {
-        if (mCtrLength == 16)
+        if (mCtrLength == sizeof(mCtrPad))
         {
             for (int j = sizeof(mCtr) - 1; j > mNonceLength; j--)
             {
@@ -204,19 +205,56 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
                 }
             }
 
+            if ((remaining >= sizeof(mCtrPad)) && ((mBlockLength == 0) || (mBlockLength == sizeof(mBlock))))
+            {
+                // Process a whole block. The pending CBC-MAC block (if any) is encrypted together with the counter
+                // block so that the two (independent) encryptions can be done in parallel.
+
+                if (mBlockLength == sizeof(mBlock))
+                {
+                    mEcb.Encrypt(mCtr, mCtrPad, mBlock, mBlock);
+                }
+                else
+                {
+                    mEcb.Encrypt(mCtr, mCtrPad);
+                }
+
+                for (uint8_t j = 0; j < sizeof(mCtrPad); j++)
+                {
+                    if (aMode == kEncrypt)
+                    {
+                        byte               = plaintextBytes[j];
+                        ciphertextBytes[j] = byte ^ mCtrPad[j];
+                    }
+                    else
+                    {
+                        byte              = ciphertextBytes[j] ^ mCtrPad[j];
+                        plaintextBytes[j] = byte;
+                    }
+
+                    mBlock[j] ^= byte;
+                }
+
+                plaintextBytes += sizeof(mCtrPad);
+                ciphertextBytes += sizeof(mCtrPad);
+                remaining -= sizeof(mCtrPad);
+                mBlockLength = sizeof(mBlock);
+                continue;
+            }
+
             mEcb.Encrypt(mCtr, mCtrPad);
             mCtrLength = 0;
         }
 
         if (aMode == kEncrypt)
         {
-            byte               = plaintextBytes[i];
-            ciphertextBytes[i] = byte ^ mCtrPad[mCtrLength++];
+            byte             = *plaintextBytes;
+            *ciphertextBytes = byte ^ mCtrPad[mCtrLength++];
         }
         else
         {
-            byte              = ciphertextBytes[i] ^ mCtrPad[mCtrLength++];
-            plaintextBytes[i] = byte;
+            byte            = *ciphertextBytes ^ mCtrPad[mCtrLength++];
+            *plaintextBytes = byte;
         }
 
         if (mBlockLength == sizeof(mBlock))
@@ -226,6 +264,10 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
         }
 
         mBlock[mBlockLength++] ^= byte;
+
+        plaintextBytes++;
+        ciphertextBytes++;
+        remaining--;
     }
 
     mPlainTextCur += aLength;
@@ -88,10 +88,11 @@ public:
     /**
      * This method sets the key.
      *
-     * @param[in]  aMacKey        A MAC key.
+     * @param[in]  aMacKey            A MAC key.
+     * @param[in]  aKeyScheduleCache  A pointer to a key schedule cache (see `AesEcb::SetKey()`), or `nullptr`.
      *
      */
-    void SetKey(const Mac::Key &aMacKey);
+    void SetKey(const Mac::Key &aMacKey, AesKeyScheduleCache *aKeyScheduleCache = nullptr);
 
     /**
      * This method initializes the AES CCM computation.
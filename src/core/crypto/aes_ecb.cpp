@@ -33,22 +33,194 @@
 
 #include "aes_ecb.hpp"
 
+#include <limits.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+#if OPENTHREAD_CONFIG_AES_HARDWARE_ACCELERATION_ENABLE && !defined(MBEDTLS_AES_ALT) && defined(__GNUC__)
+#if defined(__x86_64__)
+#define OT_AES_ECB_AESNI 1
+#include <cpuid.h>
+#include <wmmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRYPTO) && defined(__linux__) && \
+    (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define OT_AES_ECB_ARMCE 1
+#include <arm_neon.h>
+#include <sys/auxv.h>
+#ifndef HWCAP_AES
+#define HWCAP_AES (1 << 3)
+#endif
+#endif
+#endif
+
 namespace ot {
 namespace Crypto {
 
+AesEcb::Backend AesEcb::sBackend = AesEcb::kBackendUnknown;
+
+// The hardware accelerated backends use the round keys expanded by mbedtls (`rk`, `nr` of the key schedule). On a
+// little-endian CPU the mbedtls round key words are laid out in memory as the FIPS-197 round key bytes.
+
+#if OT_AES_ECB_AESNI
+
+__attribute__((target("aes,sse2"))) static void AesNiEncrypt(const mbedtls_aes_context &aContext,
+                                                             const uint8_t *            aInput,
+                                                             uint8_t *                  aOutput)
+{
+    const __m128i *roundKeys = reinterpret_cast<const __m128i *>(aContext.rk);
+    __m128i        state;
+
+    state = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(aInput)), _mm_loadu_si128(&roundKeys[0]));
+
+    for (int round = 1; round < aContext.nr; round++)
+    {
+        state = _mm_aesenc_si128(state, _mm_loadu_si128(&roundKeys[round]));
+    }
+
+    state = _mm_aesenclast_si128(state, _mm_loadu_si128(&roundKeys[aContext.nr]));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aOutput), state);
+}
+
+__attribute__((target("aes,sse2"))) static void AesNiEncrypt(const mbedtls_aes_context &aContext,
+                                                             const uint8_t *            aInput1,
+                                                             uint8_t *                  aOutput1,
+                                                             const uint8_t *            aInput2,
+                                                             uint8_t *                  aOutput2)
+{
+    const __m128i *roundKeys = reinterpret_cast<const __m128i *>(aContext.rk);
+    __m128i        roundKey  = _mm_loadu_si128(&roundKeys[0]);
+    __m128i        state1;
+    __m128i        state2;
+
+    state1 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(aInput1)), roundKey);
+    state2 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(aInput2)), roundKey);
+
+    for (int round = 1; round < aContext.nr; round++)
+    {
+        roundKey = _mm_loadu_si128(&roundKeys[round]);
+        state1   = _mm_aesenc_si128(state1, roundKey);
+        state2   = _mm_aesenc_si128(state2, roundKey);
+    }
+
+    roundKey = _mm_loadu_si128(&roundKeys[aContext.nr]);
+    state1   = _mm_aesenclast_si128(state1, roundKey);
+    state2   = _mm_aesenclast_si128(state2, roundKey);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aOutput1), state1);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aOutput2), state2);
+}
+
+#endif // OT_AES_ECB_AESNI
+
+#if OT_AES_ECB_ARMCE
+
+static void ArmCeEncrypt(const mbedtls_aes_context &aContext, const uint8_t *aInput, uint8_t *aOutput)
+{
+    const uint8_t *roundKeys = reinterpret_cast<const uint8_t *>(aContext.rk);
+    uint8x16_t     state     = vld1q_u8(aInput);
+    int            round;
+
+    // `AESE` performs AddRoundKey, SubBytes and ShiftRows, `AESMC` performs MixColumns.
+    for (round = 0; round < aContext.nr - 1; round++)
+    {
+        state = vaesmcq_u8(vaeseq_u8(state, vld1q_u8(&roundKeys[round * AesEcb::kBlockSize])));
+    }
+
+    state = vaeseq_u8(state, vld1q_u8(&roundKeys[round * AesEcb::kBlockSize]));
+    state = veorq_u8(state, vld1q_u8(&roundKeys[(round + 1) * AesEcb::kBlockSize]));
+    vst1q_u8(aOutput, state);
+}
+
+static void ArmCeEncrypt(const mbedtls_aes_context &aContext,
+                         const uint8_t *            aInput1,
+                         uint8_t *                  aOutput1,
+                         const uint8_t *            aInput2,
+                         uint8_t *                  aOutput2)
+{
+    const uint8_t *roundKeys = reinterpret_cast<const uint8_t *>(aContext.rk);
+    uint8x16_t     state1    = vld1q_u8(aInput1);
+    uint8x16_t     state2    = vld1q_u8(aInput2);
+    uint8x16_t     roundKey;
+    int            round;
+
+    for (round = 0; round < aContext.nr - 1; round++)
+    {
+        roundKey = vld1q_u8(&roundKeys[round * AesEcb::kBlockSize]);
+        state1   = vaesmcq_u8(vaeseq_u8(state1, roundKey));
+        state2   = vaesmcq_u8(vaeseq_u8(state2, roundKey));
+    }
+
+    roundKey = vld1q_u8(&roundKeys[round * AesEcb::kBlockSize]);
+    state1   = vaeseq_u8(state1, roundKey);
+    state2   = vaeseq_u8(state2, roundKey);
+
+    roundKey = vld1q_u8(&roundKeys[(round + 1) * AesEcb::kBlockSize]);
+    vst1q_u8(aOutput1, veorq_u8(state1, roundKey));
+    vst1q_u8(aOutput2, veorq_u8(state2, roundKey));
+}
+
+#endif // OT_AES_ECB_ARMCE
+
 AesEcb::AesEcb(void)
+    : mKeySchedule(&mContext)
 {
     mbedtls_aes_init(&mContext);
 }
 
-void AesEcb::SetKey(const uint8_t *aKey, uint16_t aKeyLength)
+void AesEcb::SetKey(const uint8_t *aKey, uint16_t aKeyLength, AesKeyScheduleCache *aKeyScheduleCache)
 {
-    mbedtls_aes_setkey_enc(&mContext, aKey, aKeyLength);
+    mKeySchedule = (aKeyScheduleCache != nullptr) ? aKeyScheduleCache->Get(aKey, aKeyLength) : nullptr;
+
+    if (mKeySchedule == nullptr)
+    {
+        mbedtls_aes_setkey_enc(&mContext, aKey, aKeyLength);
+        mKeySchedule = &mContext;
+    }
 }
 
 void AesEcb::Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize])
 {
-    mbedtls_aes_crypt_ecb(&mContext, MBEDTLS_AES_ENCRYPT, aInput, aOutput);
+    switch (GetBackend())
+    {
+#if OT_AES_ECB_AESNI
+    case kBackendAesNi:
+        AesNiEncrypt(*mKeySchedule, aInput, aOutput);
+        break;
+#endif
+#if OT_AES_ECB_ARMCE
+    case kBackendArmCe:
+        ArmCeEncrypt(*mKeySchedule, aInput, aOutput);
+        break;
+#endif
+    default:
+        mbedtls_aes_crypt_ecb(mKeySchedule, MBEDTLS_AES_ENCRYPT, aInput, aOutput);
+        break;
+    }
+}
+
+void AesEcb::Encrypt(const uint8_t aInput1[kBlockSize],
+                     uint8_t       aOutput1[kBlockSize],
+                     const uint8_t aInput2[kBlockSize],
+                     uint8_t       aOutput2[kBlockSize])
+{
+    switch (GetBackend())
+    {
+#if OT_AES_ECB_AESNI
+    case kBackendAesNi:
+        AesNiEncrypt(*mKeySchedule, aInput1, aOutput1, aInput2, aOutput2);
+        break;
+#endif
+#if OT_AES_ECB_ARMCE
+    case kBackendArmCe:
+        ArmCeEncrypt(*mKeySchedule, aInput1, aOutput1, aInput2, aOutput2);
+        break;
+#endif
+    default:
+        mbedtls_aes_crypt_ecb(mKeySchedule, MBEDTLS_AES_ENCRYPT, aInput1, aOutput1);
+        mbedtls_aes_crypt_ecb(mKeySchedule, MBEDTLS_AES_ENCRYPT, aInput2, aOutput2);
+        break;
+    }
 }
 
 AesEcb::~AesEcb(void)
@@ -56,5 +228,128 @@ AesEcb::~AesEcb(void)
     mbedtls_aes_free(&mContext);
 }
 
+AesEcb::Backend AesEcb::GetBackend(void)
+{
+    if (sBackend == kBackendUnknown)
+    {
+        sBackend = DetectBackend();
+    }
+
+    return sBackend;
+}
+
+AesEcb::Backend AesEcb::DetectBackend(void)
+{
+    Backend backend = kBackendMbedTls;
+
+#if OT_AES_ECB_AESNI
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_AES))
+    {
+        backend = kBackendAesNi;
+    }
+#elif OT_AES_ECB_ARMCE
+    if (getauxval(AT_HWCAP) & HWCAP_AES)
+    {
+        backend = kBackendArmCe;
+    }
+#endif
+
+    return backend;
+}
+
+AesKeyScheduleCache::AesKeyScheduleCache(void)
+{
+#if OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE > 0
+    for (Entry &entry : mEntries)
+    {
+        mbedtls_aes_init(&entry.mContext);
+    }
+
+    memset(mOrder, 0, sizeof(mOrder));
+    mLength = 0;
+#endif
+}
+
+AesKeyScheduleCache::~AesKeyScheduleCache(void)
+{
+#if OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE > 0
+    for (Entry &entry : mEntries)
+    {
+        memset(entry.mKey, 0, sizeof(entry.mKey));
+        mbedtls_aes_free(&entry.mContext);
+    }
+#endif
+}
+
+void AesKeyScheduleCache::Clear(void)
+{
+#if OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE > 0
+    // `mbedtls_aes_free()` wipes the key schedule.
+
+    for (Entry &entry : mEntries)
+    {
+        memset(entry.mKey, 0, sizeof(entry.mKey));
+        mbedtls_aes_free(&entry.mContext);
+        mbedtls_aes_init(&entry.mContext);
+    }
+
+    mLength = 0;
+#endif
+}
+
+mbedtls_aes_context *AesKeyScheduleCache::Get(const uint8_t *aKey, uint16_t aKeyLength)
+{
+    mbedtls_aes_context *context = nullptr;
+
+#if OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE > 0
+    uint8_t position;
+    uint8_t index;
+
+    VerifyOrExit(aKeyLength == CHAR_BIT * kKeySize);
+
+    for (position = 0; position < mLength; position++)
+    {
+        if (memcmp(mEntries[mOrder[position]].mKey, aKey, kKeySize) == 0)
+        {
+            break;
+        }
+    }
+
+    if (position == mLength)
+    {
+        // Expand the key into a free entry, or replace the least
+        // recently used one when the cache is full.
+
+        if (mLength < kSize)
+        {
+            mOrder[mLength] = mLength;
+            mLength++;
+        }
+
+        position = mLength - 1;
+        index    = mOrder[position];
+
+        memcpy(mEntries[index].mKey, aKey, kKeySize);
+        mbedtls_aes_setkey_enc(&mEntries[index].mContext, aKey, aKeyLength);
+    }
+
+    // Move the entry to the front (most recently used).
+    index = mOrder[position];
+    memmove(&mOrder[1], &mOrder[0], position);
+    mOrder[0] = index;
+
+    context = &mEntries[index].mContext;
+
+exit:
+#else
+    OT_UNUSED_VARIABLE(aKey);
+    OT_UNUSED_VARIABLE(aKeyLength);
+#endif
+
+    return context;
+}
+
 } // namespace Crypto
 } // namespace ot
@@ -36,11 +36,17 @@
 
 #include "openthread-core-config.h"
 
+#include <stdint.h>
+
 #include <mbedtls/aes.h>
 
+#include "common/non_copyable.hpp"
+
 namespace ot {
 namespace Crypto {
 
+class AesKeyScheduleCache;
+
 /**
  * @addtogroup core-security
  *
@@ -51,9 +57,17 @@ namespace Crypto {
 /**
  * This class implements AES ECB computation.
  *
+ * The key schedule is always expanded by mbedtls. When `OPENTHREAD_CONFIG_AES_HARDWARE_ACCELERATION_ENABLE` is set and
+ * the CPU supports it (detected at run time), blocks are encrypted using the AES instructions (AES-NI on x86-64 or the
+ * ARMv8 Cryptography Extension on AArch64) instead of mbedtls.
+ *
+ * The key schedule may be taken from an `AesKeyScheduleCache`, in which case it is used in place (not copied).
+ *
  */
 class AesEcb
 {
+    friend class AesEcbTester;
+
 public:
     enum
     {
@@ -75,11 +89,16 @@ public:
     /**
      * This method sets the key.
      *
-     * @param[in]  aKey        A pointer to the key.
-     * @param[in]  aKeyLength  The key length in bits.
+     * When @p aKeyScheduleCache is given, the key schedule is taken from (or expanded into) the cache. It is used in
+     * place and the cache MUST then not be cleared, nor be used to set `OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE`
+     * other keys, while this object is in use.
+     *
+     * @param[in]  aKey               A pointer to the key.
+     * @param[in]  aKeyLength         The key length in bits.
+     * @param[in]  aKeyScheduleCache  A pointer to a key schedule cache, or `nullptr` to not use a cache.
      *
      */
-    void SetKey(const uint8_t *aKey, uint16_t aKeyLength);
+    void SetKey(const uint8_t *aKey, uint16_t aKeyLength, AesKeyScheduleCache *aKeyScheduleCache = nullptr);
 
     /**
      * This method encrypts data.
@@ -90,8 +109,105 @@ public:
      */
     void Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize]);
 
+    /**
+     * This method encrypts two independent blocks.
+     *
+     * With the hardware accelerated backend, the rounds of the two blocks are interleaved so that both encryptions
+     * proceed in parallel. The input and output buffers of a block may be the same.
+     *
+     * @param[in]   aInput1   A pointer to the first input buffer.
+     * @param[out]  aOutput1  A pointer to the first output buffer.
+     * @param[in]   aInput2   A pointer to the second input buffer.
+     * @param[out]  aOutput2  A pointer to the second output buffer.
+     *
+     */
+    void Encrypt(const uint8_t aInput1[kBlockSize],
+                 uint8_t       aOutput1[kBlockSize],
+                 const uint8_t aInput2[kBlockSize],
+                 uint8_t       aOutput2[kBlockSize]);
+
+    /**
+     * This static method indicates whether blocks are encrypted using the hardware accelerated backend.
+     *
+     * @retval TRUE   If blocks are encrypted using the CPU AES instructions.
+     * @retval FALSE  If blocks are encrypted using mbedtls.
+     *
+     */
+    static bool IsHardwareAccelerated(void) { return GetBackend() != kBackendMbedTls; }
+
+private:
+    enum Backend : uint8_t
+    {
+        kBackendUnknown, // Not yet detected.
+        kBackendMbedTls, // mbedtls software implementation.
+        kBackendAesNi,   // x86-64 AES-NI instructions.
+        kBackendArmCe,   // ARMv8 Cryptography Extension instructions.
+    };
+
+    static Backend GetBackend(void);
+    static Backend DetectBackend(void);
+
+    static Backend sBackend;
+
+    mbedtls_aes_context *mKeySchedule; // Either `mContext` or a key schedule held by an `AesKeyScheduleCache`.
+    mbedtls_aes_context  mContext;
+};
+
+/**
+ * This class implements a cache of expanded AES-128 key schedules, used by `AesEcb::SetKey()`.
+ *
+ * A new `AesEcb` is used for every secured frame or MLE message, and the cache avoids expanding the same key again
+ * each time. The least recently used key schedule is replaced when the cache is full. The cache holds
+ * `OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE` entries, when it is zero no key schedule is cached.
+ *
+ */
+class AesKeyScheduleCache : private NonCopyable
+{
+    friend class AesEcb;
+    friend class AesEcbTester;
+
+public:
+    /**
+     * This constructor initializes an empty cache.
+     *
+     */
+    AesKeyScheduleCache(void);
+
+    /**
+     * This destructor wipes all the cached keys and key schedules.
+     *
+     */
+    ~AesKeyScheduleCache(void);
+
+    /**
+     * This method wipes all the cached keys and key schedules.
+     *
+     */
+    void Clear(void);
+
 private:
-    mbedtls_aes_context mContext;
+    enum : uint8_t
+    {
+        kSize    = OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE,
+        kKeySize = 16, // Only AES-128 key schedules are cached (key size in bytes).
+    };
+
+    mbedtls_aes_context *Get(const uint8_t *aKey, uint16_t aKeyLength);
+
+#if OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE > 0
+    struct Entry
+    {
+        uint8_t             mKey[kKeySize];
+        mbedtls_aes_context mContext;
+    };
+
+    // The entries are never moved, since an `AesEcb` uses the key
+    // schedule in place. `mOrder` holds the indexes of the used
+    // entries, from the most to the least recently used.
+    Entry   mEntries[kSize];
+    uint8_t mOrder[kSize];
+    uint8_t mLength;
+#endif
 };
 
 /**
@@ -1073,7 +1073,7 @@ void Mac::ProcessTransmitSecurity(TxFrame &aFrame)
     VerifyOrExit(aFrame.mInfo.mTxInfo.mCslPresent == 0);
 #endif
 
-    aFrame.ProcessTransmitAesCcm(*extAddress);
+    aFrame.ProcessTransmitAesCcm(*extAddress, &keyManager.GetAesKeyScheduleCache());
 
 exit:
     return;
@@ -1769,7 +1769,7 @@ Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neig
         OT_UNREACHABLE_CODE(break);
     }
 
-    SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey));
+    SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey, &keyManager.GetAesKeyScheduleCache()));
 
     if ((keyIdMode == Frame::kKeyIdMode1) && aNeighbor->IsStateValid())
     {
@@ -1889,7 +1889,7 @@ Error Mac::ProcessEnhAckSecurity(TxFrame &aTxFrame, RxFrame &aAckFrame)
         VerifyOrExit(frameCounter >= neighbor->GetLinkAckFrameCounter());
     }
 
-    error = aAckFrame.ProcessReceiveAesCcm(srcAddr.GetExtended(), *macKey);
+    error = aAckFrame.ProcessReceiveAesCcm(srcAddr.GetExtended(), *macKey, &keyManager.GetAesKeyScheduleCache());
     SuccessOrExit(error);
 
     if (neighbor->IsStateValid())
@@ -2498,7 +2498,7 @@ void Mac::ProcessCsl(const RxFrame &aFrame, const Address &aSrcAddr)
                  static_cast<uint32_t>(aFrame.GetTimestamp()), aFrame.GetSequence(), csl->GetPeriod(), csl->GetPhase(),
                  child->GetCslPhase());
 
-    Get<CslTxScheduler>().Update();
+    Get<CslTxScheduler>().Update(*child);
 
 exit:
     return;
@@ -43,6 +43,11 @@
 #include "mac/mac_types.hpp"
 
 namespace ot {
+
+namespace Crypto {
+class AesKeyScheduleCache;
+}
+
 namespace Mac {
 
 using ot::Encoding::LittleEndian::HostSwap16;
@@ -1199,15 +1204,18 @@ public:
     /**
      * This method performs AES CCM on the frame which is received.
      *
-     * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
-     *                          for AES CCM computation.
-     * @param[in]  aMacKey      A reference to the MAC key to decrypt the received frame.
+     * @param[in]  aExtAddress        A reference to the extended address, which will be used to generate nonce
+     *                                for AES CCM computation.
+     * @param[in]  aMacKey            A reference to the MAC key to decrypt the received frame.
+     * @param[in]  aKeyScheduleCache  A pointer to an AES key schedule cache, or `nullptr` to not use a cache.
      *
      * @retval kErrorNone      Process of received frame AES CCM succeeded.
      * @retval kErrorSecurity  Received frame MIC check failed.
      *
      */
-    Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const Key &aMacKey);
+    Error ProcessReceiveAesCcm(const ExtAddress &           aExtAddress,
+                               const Key &                  aMacKey,
+                               Crypto::AesKeyScheduleCache *aKeyScheduleCache = nullptr);
 
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
     /**
@@ -1346,11 +1354,13 @@ public:
     /**
      * This method performs AES CCM on the frame which is going to be sent.
      *
-     * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
-     *                          for AES CCM computation.
+     * @param[in]  aExtAddress        A reference to the extended address, which will be used to generate nonce
+     *                                for AES CCM computation.
+     * @param[in]  aKeyScheduleCache  A pointer to an AES key schedule cache, or `nullptr` to not use a cache.
      *
      */
-    void ProcessTransmitAesCcm(const ExtAddress &aExtAddress);
+    void ProcessTransmitAesCcm(const ExtAddress &           aExtAddress,
+                               Crypto::AesKeyScheduleCache *aKeyScheduleCache = nullptr);
 
     /**
      * This method indicates whether or not the frame has security processed.
@@ -34,6 +34,7 @@
 #include "checksum.hpp"
 
 #include "common/code_utils.hpp"
+#include "common/encoding.hpp"
 #include "common/message.hpp"
 #include "net/icmp6.hpp"
 #include "net/udp6.hpp"
@@ -68,10 +69,58 @@ void Checksum::AddUint16(uint16_t aUint16)
 
 void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
 {
-    for (uint16_t i = 0; i < aLength; i++)
+    // The data is summed as 32-bit big-endian words into a 64-bit
+    // accumulator (which cannot overflow for `aLength` up to 64K)
+    // and then folded into the 16-bit one's complement sum. Since
+    // one's complement addition is associative and commutative,
+    // this gives the same result as summing 16-bit words.
+
+    const uint8_t *cur = aBuffer;
+    const uint8_t *end = aBuffer + aLength;
+    uint64_t       sum = mValue;
+
+    VerifyOrExit(aLength > 0);
+
+    if (mAtOddIndex)
+    {
+        // Previous data ended at an odd index, so the first byte is
+        // the LSB of a 16-bit word (big-endian encoding).
+
+        sum += *cur++;
+    }
+
+    for (; end - cur >= static_cast<ptrdiff_t>(sizeof(uint32_t)); cur += sizeof(uint32_t))
+    {
+        sum += Encoding::BigEndian::ReadUint32(cur);
+    }
+
+    if (end - cur >= static_cast<ptrdiff_t>(sizeof(uint16_t)))
+    {
+        sum += Encoding::BigEndian::ReadUint16(cur);
+        cur += sizeof(uint16_t);
+    }
+
+    if (cur < end)
+    {
+        sum += (static_cast<uint16_t>(*cur) << 8);
+    }
+
+    // Fold the 64-bit sum into 16 bits.
+
+    while ((sum >> 16) != 0)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    mValue = static_cast<uint16_t>(sum);
+
+    if ((aLength & 1) != 0)
     {
-        AddUint8(aBuffer[i]);
+        mAtOddIndex = !mAtOddIndex;
     }
+
+exit:
+    return;
 }
 
 void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
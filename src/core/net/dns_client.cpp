@@ -187,7 +187,7 @@ Error Client::Response::FindHostAddress(Section       aSection,
     SelectSection(aSection, offset, numRecords);
     SuccessOrExit(error = ResourceRecord::FindRecord(*mMessage, offset, numRecords, aIndex, name, aaaaRecord));
     aAddress = aaaaRecord.GetAddress();
-    aTtl     = aaaaRecord.GetTtl();
+    aTtl     = AdjustTtl(aaaaRecord.GetTtl());
 
 exit:
     return error;
@@ -238,7 +238,7 @@ Error Client::Response::FindServiceInfo(Section aSection, const Name &aName, Ser
     SelectSection(aSection, offset, numRecords);
     SuccessOrExit(error = ResourceRecord::FindRecord(*mMessage, offset, numRecords, /* aIndex */ 0, aName, srvRecord));
 
-    aServiceInfo.mTtl      = srvRecord.GetTtl();
+    aServiceInfo.mTtl      = AdjustTtl(srvRecord.GetTtl());
     aServiceInfo.mPort     = srvRecord.GetPort();
     aServiceInfo.mPriority = srvRecord.GetPriority();
     aServiceInfo.mWeight   = srvRecord.GetWeight();
@@ -284,7 +284,7 @@ Error Client::Response::FindServiceInfo(Section aSection, const Name &aName, Ser
     case kErrorNone:
         SuccessOrExit(error =
                           txtRecord.ReadTxtData(*mMessage, offset, aServiceInfo.mTxtData, aServiceInfo.mTxtDataSize));
-        aServiceInfo.mTxtDataTtl = txtRecord.GetTtl();
+        aServiceInfo.mTxtDataTtl = AdjustTtl(txtRecord.GetTtl());
         break;
 
     case kErrorNotFound:
@@ -333,7 +333,7 @@ Error Client::AddressResponse::GetAddress(uint16_t aIndex, Ip6::Address &aAddres
         SuccessOrExit(error = FindARecord(section, name, aIndex, aRecord));
 
         aAddress.SynthesizeFromIp4Address(nat64Prefix, aRecord.GetAddress());
-        aTtl = aRecord.GetTtl();
+        aTtl = AdjustTtl(aRecord.GetTtl());
 
         ExitNow();
     }
@@ -547,6 +547,9 @@ Client::Client(Instance &aInstance)
     , mSocket(aInstance)
     , mTimer(aInstance, Client::HandleTimer)
     , mDefaultConfig(QueryConfig::kInitFromDefaults)
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    , mCacheClearCount(0)
+#endif
 {
     static_assert(kIp6AddressQuery == 0, "kIp6AddressQuery value is not correct");
 #if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
@@ -559,6 +562,10 @@ Client::Client(Instance &aInstance)
     static_assert(kBrowseQuery == 1, "kBrowseQuery value is not correct");
     static_assert(kServiceQuery == 2, "kServiceQuery value is not correct");
 #endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    ResetCacheCounters();
+#endif
 }
 
 Error Client::Start(void)
@@ -581,6 +588,10 @@ void Client::Stop(void)
         FinalizeQuery(*query, kErrorAbort);
     }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    ClearCache();
+#endif
+
     IgnoreError(mSocket.Close());
 }
 
@@ -678,6 +689,17 @@ Error Client::StartQuery(QueryInfo &        aInfo,
     aInfo.mCallbackContext = aContext;
 
     SuccessOrExit(error = AllocateQuery(aInfo, aLabel, aName, query));
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    if (ServeFromCache(*query, aInfo) == kErrorNone)
+    {
+        query->Free();
+        ExitNow();
+    }
+
+    mCacheCounters.mMisses++;
+#endif
+
     mQueries.Enqueue(*query);
 
     SendQuery(*query, aInfo, /* aUpdateTimer */ true);
@@ -810,6 +832,7 @@ void Client::FinalizeQuery(Query &aQuery, Error aError)
     Response  response;
     QueryInfo info;
 
+    response.Clear();
     response.mInstance = &Get<Instance>();
     response.mQuery    = &aQuery;
     info.ReadFrom(aQuery);
@@ -818,6 +841,24 @@ void Client::FinalizeQuery(Query &aQuery, Error aError)
 }
 
 void Client::FinalizeQuery(Response &aResponse, QueryType aType, Error aError)
+{
+    InvokeCallback(aResponse, aType, aError);
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    if (aResponse.mMessage != nullptr)
+    {
+        // The query message is reused to hold the cached response.
+        mQueries.Dequeue(*aResponse.mQuery);
+        SaveInCache(*aResponse.mQuery, aResponse, aError);
+    }
+    else
+#endif
+    {
+        FreeQuery(*aResponse.mQuery);
+    }
+}
+
+void Client::InvokeCallback(Response &aResponse, QueryType aType, Error aError)
 {
     Callback callback;
     void *   context;
@@ -852,8 +893,6 @@ void Client::FinalizeQuery(Response &aResponse, QueryType aType, Error aError)
         break;
 #endif
     }
-
-    FreeQuery(*aResponse.mQuery);
 }
 
 void Client::GetCallback(const Query &aQuery, Callback &aCallback, void *&aContext)
@@ -897,6 +936,7 @@ void Client::ProcessResponse(const Message &aMessage)
     QueryType type;
     Error     responseError;
 
+    response.Clear();
     response.mInstance = &Get<Instance>();
     response.mMessage  = &aMessage;
 
@@ -1053,12 +1093,377 @@ void Client::HandleTimer(void)
         }
     }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    ExpireCacheEntries(now, nextTime);
+#endif
+
     if (nextTime < now.GetDistantFuture())
     {
         mTimer.FireAt(nextTime);
     }
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+// A cached response is kept in the `Query` message of the query which
+// received it: the `QueryInfo` and the query name are followed by the
+// DNS response message (starting at its header), and the message
+// offset is set to the start of the response. This way the cache
+// entry can be used both as `mQuery` and `mMessage` of a `Response`.
+// `mRetransmissionTime` in the `QueryInfo` of a cache entry holds the
+// time the response was received. Entries are freed by `mTimer` once
+// they expire, so an entry never outlives the (32-bit) millisecond
+// time range.
+
+void Client::HandleNotifierEvents(Events aEvents)
+{
+    // Cached responses are dropped when leaving the network, or when
+    // the network changes in a way which may change the answers or
+    // the reachability of the DNS server.
+
+    if (aEvents.ContainsAny(kEventThreadPartitionIdChanged | kEventThreadMeshLocalAddrChanged |
+                            kEventThreadExtPanIdChanged) ||
+        (aEvents.Contains(kEventThreadRoleChanged) && !Get<Mle::Mle>().IsAttached()))
+    {
+        ClearCache();
+    }
+}
+
+void Client::ClearCache(void)
+{
+    Query *entry;
+
+    while ((entry = mCache.GetHead()) != nullptr)
+    {
+        mCache.Dequeue(*entry);
+        entry->Free();
+    }
+
+    mCacheClearCount++;
+}
+
+Error Client::EvictCacheEntry(void)
+{
+    Error  error = kErrorNone;
+    Query *entry = mCache.GetHead();
+
+    VerifyOrExit(entry != nullptr, error = kErrorNotFound);
+
+    mCache.Dequeue(*entry);
+    entry->Free();
+    mCacheCounters.mEvictions++;
+
+exit:
+    return error;
+}
+
+Error Client::ServeFromCache(const Query &aQuery, const QueryInfo &aInfo)
+{
+    Error     error = kErrorNone;
+    Query *   entry;
+    Response  response;
+    QueryInfo info;
+    Error     responseError;
+    uint16_t  clearCount;
+
+    entry = FindCacheEntry(aQuery, aInfo.mQueryType, aInfo.mConfig);
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+    // An IPv6 address query may have been resolved by an IPv4 address
+    // query (when the server provided no IPv6 address).
+
+    if ((entry == nullptr) && (aInfo.mQueryType == kIp6AddressQuery) &&
+        (aInfo.mConfig.GetNat64Mode() == QueryConfig::kNat64Allow))
+    {
+        entry = FindCacheEntry(aQuery, kIp4AddressQuery, aInfo.mConfig);
+    }
+#endif
+
+    VerifyOrExit(entry != nullptr, error = kErrorNotFound);
+
+    info.ReadFrom(*entry);
+
+    response.Clear();
+    response.mInstance = &Get<Instance>();
+    response.mQuery    = entry;
+    response.mMessage  = entry;
+    response.mCacheAge = Time::MsecToSec(TimerMilli::GetNow() - info.mRetransmissionTime);
+
+    SuccessOrExit(error = ParseCachedResponse(*entry, response, responseError));
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+    if ((info.mQueryType == kIp6AddressQuery) && (info.mConfig.GetNat64Mode() == QueryConfig::kNat64Allow))
+    {
+        Name         hostName(*entry, kNameOffsetInQuery);
+        Ip6::Address address;
+        uint32_t     ttl;
+        ARecord      aRecord;
+
+        response.mIp6QueryResponseRequiresNat64 =
+            (response.FindHostAddress(Response::kAnswerSection, hostName, /* aIndex */ 0, address, ttl) !=
+             kErrorNone) &&
+            (response.FindARecord(Response::kAdditionalDataSection, hostName, /* aIndex */ 0, aRecord) == kErrorNone);
+    }
+#endif
+
+    // The callback of the new query is saved in the cache entry, so
+    // that it is invoked from `InvokeCallback()`. The entry is removed
+    // from the cache while the callback runs, so that it is not
+    // evicted or freed under its feet (e.g., by a new query from the
+    // callback), and put back as most recently used afterwards unless
+    // the cache was cleared in the meantime.
+
+    info.mCallback        = aInfo.mCallback;
+    info.mCallbackContext = aInfo.mCallbackContext;
+    UpdateQuery(*entry, info);
+
+    mCache.Dequeue(*entry);
+    clearCount = mCacheClearCount;
+    mCacheCounters.mHits++;
+
+    InvokeCallback(response, info.mQueryType, responseError);
+
+    if (clearCount == mCacheClearCount)
+    {
+        mCache.Enqueue(*entry);
+    }
+    else
+    {
+        entry->Free();
+    }
+
+exit:
+    return error;
+}
+
+Client::Query *Client::FindCacheEntry(const Query &aQuery, QueryType aType, const QueryConfig &aConfig)
+{
+    TimeMilli now = TimerMilli::GetNow();
+    Name      queryName(aQuery, kNameOffsetInQuery);
+    Query *   nextEntry;
+    Query *   entry;
+    QueryInfo info;
+
+    for (entry = mCache.GetHead(); entry != nullptr; entry = nextEntry)
+    {
+        uint16_t offset = kNameOffsetInQuery;
+
+        nextEntry = entry->GetNext();
+
+        info.ReadFrom(*entry);
+
+        if ((info.mQueryType != aType) || !MatchesCacheConfig(info.mConfig, aConfig) ||
+            (Name::CompareName(*entry, offset, queryName) != kErrorNone))
+        {
+            continue;
+        }
+
+        if (now < GetCacheExpireTime(*entry))
+        {
+            break;
+        }
+
+        mCache.Dequeue(*entry);
+        entry->Free();
+    }
+
+    return entry;
+}
+
+bool Client::MatchesCacheConfig(const QueryConfig &aConfig, const QueryConfig &aOtherConfig)
+{
+    // Only the config fields which may change the response are
+    // compared.
+
+    return (aConfig.GetServerSockAddr().GetAddress() == aOtherConfig.GetServerSockAddr().GetAddress()) &&
+           (aConfig.GetServerSockAddr().GetPort() == aOtherConfig.GetServerSockAddr().GetPort()) &&
+           (aConfig.GetRecursionFlag() == aOtherConfig.GetRecursionFlag())
+#if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
+           && (aConfig.GetNat64Mode() == aOtherConfig.GetNat64Mode())
+#endif
+        ;
+}
+
+void Client::SaveInCache(Query &aQuery, const Response &aResponse, Error aResponseError)
+{
+    // This method takes ownership of `aQuery` (which must not be in
+    // `mQueries` list) and either moves it into the cache or frees it.
+
+    const Message &message = *aResponse.mMessage;
+    bool           saved   = false;
+    uint16_t       numEntries;
+    uint16_t       numBuffers;
+    uint16_t       offset;
+    uint16_t       length;
+    QueryInfo      info;
+    Query *        entry;
+
+    // Only positive and name error responses are cached, other errors
+    // (e.g., server failure) are likely transient.
+
+    VerifyOrExit((aResponseError == kErrorNone) || (aResponseError == kErrorNotFound));
+    VerifyOrExit(DetermineCacheTtl(message) > 0);
+
+    info.ReadFrom(aQuery);
+
+    entry = FindCacheEntry(aQuery, info.mQueryType, info.mConfig);
+
+    if (entry != nullptr)
+    {
+        mCache.Dequeue(*entry);
+        entry->Free();
+    }
+
+    mCache.GetInfo(numEntries, numBuffers);
+
+    if (numEntries >= kCacheMaxEntries)
+    {
+        IgnoreError(EvictCacheEntry());
+    }
+
+    offset = aQuery.GetLength();
+    length = message.GetLength() - message.GetOffset();
+
+    SuccessOrExit(aQuery.SetLength(offset + length));
+    message.CopyTo(message.GetOffset(), offset, length, aQuery);
+    aQuery.SetOffset(offset);
+
+    info.mRetransmissionTime = TimerMilli::GetNow();
+    UpdateQuery(aQuery, info);
+
+    mCache.Enqueue(aQuery);
+    saved = true;
+
+    mTimer.FireAtIfEarlier(GetCacheExpireTime(aQuery));
+
+exit:
+    if (!saved)
+    {
+        aQuery.Free();
+    }
+}
+
+Error Client::ParseCachedResponse(const Query &aEntry, Response &aResponse, Error &aResponseError)
+{
+    Error    error;
+    uint16_t offset = aEntry.GetOffset();
+    Header   header;
+
+    SuccessOrExit(error = aEntry.Read(offset, header));
+    offset += sizeof(Header);
+
+    for (uint16_t num = 0; num < header.GetQuestionCount(); num++)
+    {
+        SuccessOrExit(error = Name::ParseName(aEntry, offset));
+        offset += sizeof(Question);
+    }
+
+    aResponse.mAnswerOffset = offset;
+    SuccessOrExit(error = ResourceRecord::ParseRecords(aEntry, offset, header.GetAnswerCount()));
+    SuccessOrExit(error = ResourceRecord::ParseRecords(aEntry, offset, header.GetAuthorityRecordCount()));
+    aResponse.mAdditionalOffset = offset;
+
+    aResponse.mAnswerRecordCount     = header.GetAnswerCount();
+    aResponse.mAdditionalRecordCount = header.GetAdditionalRecordCount();
+
+    aResponseError = Header::ResponseCodeToError(header.GetResponseCode());
+
+exit:
+    return error;
+}
+
+void Client::ExpireCacheEntries(TimeMilli aNow, TimeMilli &aNextTime)
+{
+    // Frees the expired cache entries and updates `aNextTime` to the
+    // earliest expire time of the remaining ones.
+
+    Query *nextEntry;
+
+    for (Query *entry = mCache.GetHead(); entry != nullptr; entry = nextEntry)
+    {
+        TimeMilli expireTime = GetCacheExpireTime(*entry);
+
+        nextEntry = entry->GetNext();
+
+        if (aNow >= expireTime)
+        {
+            mCache.Dequeue(*entry);
+            entry->Free();
+            continue;
+        }
+
+        if (aNextTime > expireTime)
+        {
+            aNextTime = expireTime;
+        }
+    }
+}
+
+TimeMilli Client::GetCacheExpireTime(const Query &aEntry)
+{
+    QueryInfo info;
+
+    info.ReadFrom(aEntry);
+
+    return info.mRetransmissionTime + Time::SecToMsec(DetermineCacheTtl(aEntry));
+}
+
+uint32_t Client::DetermineCacheTtl(const Message &aMessage)
+{
+    // This method determines how long (in seconds) the DNS response in
+    // `aMessage` can be cached: the smallest TTL of all its records,
+    // limited to `kCacheMaxTtl`, and to `kCacheNegativeTtl` for a
+    // negative response (error or no answer). Zero is returned if the
+    // message can not be parsed.
+
+    static_assert(kCacheMaxTtl <= TimerMilli::kMaxDelay / 1000,
+                  "OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL is longer than TimerMilli::kMaxDelay");
+
+    Error    error;
+    uint32_t ttl    = kCacheMaxTtl;
+    uint16_t offset = aMessage.GetOffset();
+    Header   header;
+    uint32_t numRecords;
+
+    SuccessOrExit(error = aMessage.Read(offset, header));
+    offset += sizeof(Header);
+
+    for (uint16_t num = 0; num < header.GetQuestionCount(); num++)
+    {
+        SuccessOrExit(error = Name::ParseName(aMessage, offset));
+        offset += sizeof(Question);
+    }
+
+    numRecords = static_cast<uint32_t>(header.GetAnswerCount()) + header.GetAuthorityRecordCount() +
+                 header.GetAdditionalRecordCount();
+
+    for (; numRecords > 0; numRecords--)
+    {
+        ResourceRecord record;
+
+        SuccessOrExit(error = Name::ParseName(aMessage, offset));
+        SuccessOrExit(error = aMessage.Read(offset, record));
+        VerifyOrExit(offset + record.GetSize() <= aMessage.GetLength(), error = kErrorParse);
+        offset += static_cast<uint16_t>(record.GetSize());
+
+        // The TTL field of an OPT record is used for flags.
+        if ((record.GetType() != ResourceRecord::kTypeOpt) && (record.GetTtl() < ttl))
+        {
+            ttl = record.GetTtl();
+        }
+    }
+
+    if ((header.GetResponseCode() != Header::kResponseSuccess) || (header.GetAnswerCount() == 0))
+    {
+        ttl = OT_MIN(ttl, static_cast<uint32_t>(kCacheNegativeTtl));
+    }
+
+exit:
+    return (error == kErrorNone) ? ttl : 0;
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
 } // namespace Dns
 } // namespace ot
 
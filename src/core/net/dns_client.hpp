@@ -38,6 +38,7 @@
 #include "common/clearable.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/notifier.hpp"
 #include "common/timer.hpp"
 #include "net/dns_types.hpp"
 #include "net/ip6.hpp"
@@ -85,6 +86,8 @@ namespace Dns {
  */
 class Client : public InstanceLocator, private NonCopyable
 {
+    friend class ot::Notifier;
+
     typedef Message Query; // `Message` is used to save `Query` related info.
 
 public:
@@ -267,6 +270,12 @@ public:
         Error FindServiceInfo(Section aSection, const Name &aName, ServiceInfo &aServiceInfo) const;
 #endif
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+        uint32_t AdjustTtl(uint32_t aTtl) const { return (aTtl > mCacheAge) ? (aTtl - mCacheAge) : 0; }
+#else
+        uint32_t AdjustTtl(uint32_t aTtl) const { return aTtl; }
+#endif
+
         Instance *     mInstance;              // The OpenThread instance.
         Query *        mQuery;                 // The associated query.
         const Message *mMessage;               // The response message.
@@ -280,6 +289,9 @@ public:
         // addresses but server provided at least one IPv4 address
         // in the additional data section for NAT64 address synthesis.
         bool mIp6QueryResponseRequiresNat64;
+#endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+        uint32_t mCacheAge; // Time (in seconds) since a response served from the cache was received.
 #endif
     };
 
@@ -657,6 +669,45 @@ public:
 
 #endif // OPENTHREAD_CONFIG_DNS_CLIENT_SERVICE_DISCOVERY_ENABLE
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
+    /**
+     * This type represents the response cache counters.
+     *
+     */
+    typedef otDnsCacheCounters CacheCounters;
+
+    /**
+     * This method gets the response cache counters.
+     *
+     * @returns The response cache counters.
+     *
+     */
+    const CacheCounters &GetCacheCounters(void) const { return mCacheCounters; }
+
+    /**
+     * This method resets the response cache counters.
+     *
+     */
+    void ResetCacheCounters(void) { memset(&mCacheCounters, 0, sizeof(mCacheCounters)); }
+
+    /**
+     * This method removes all responses from the response cache.
+     *
+     */
+    void ClearCache(void);
+
+    /**
+     * This method evicts the least recently used response from the response cache, releasing its message buffers.
+     *
+     * @retval kErrorNone      A cached response was evicted.
+     * @retval kErrorNotFound  The response cache is empty.
+     *
+     */
+    Error EvictCacheEntry(void);
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+
 private:
     enum QueryType : uint8_t
     {
@@ -689,7 +740,7 @@ private:
         uint16_t    mMessageId;
         Callback    mCallback;
         void *      mCallbackContext;
-        TimeMilli   mRetransmissionTime;
+        TimeMilli   mRetransmissionTime; // For a cached response, the time it was received.
         QueryConfig mConfig;
         uint8_t     mTransmissionCount;
         // Followed by the name (service, host, instance) encoded as a `Dns::Name`.
@@ -700,6 +751,15 @@ private:
         kNameOffsetInQuery = sizeof(QueryInfo),
     };
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    enum : uint32_t
+    {
+        kCacheMaxEntries  = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES,
+        kCacheNegativeTtl = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL, // In seconds.
+        kCacheMaxTtl      = OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL,      // In seconds.
+    };
+#endif
+
     Error       StartQuery(QueryInfo &        aInfo,
                            const QueryConfig *aConfig,
                            const char *       aLabel,
@@ -722,6 +782,18 @@ private:
 #if OPENTHREAD_CONFIG_DNS_CLIENT_NAT64_ENABLE
     Error CheckAddressResponse(Response &aResponse, Error aResponseError) const;
 #endif
+    void InvokeCallback(Response &aResponse, QueryType aType, Error aError);
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    void             HandleNotifierEvents(Events aEvents);
+    Error            ServeFromCache(const Query &aQuery, const QueryInfo &aInfo);
+    Query *          FindCacheEntry(const Query &aQuery, QueryType aType, const QueryConfig &aConfig);
+    void             SaveInCache(Query &aQuery, const Response &aResponse, Error aResponseError);
+    void             ExpireCacheEntries(TimeMilli aNow, TimeMilli &aNextTime);
+    static bool      MatchesCacheConfig(const QueryConfig &aConfig, const QueryConfig &aOtherConfig);
+    static Error     ParseCachedResponse(const Query &aEntry, Response &aResponse, Error &aResponseError);
+    static uint32_t  DetermineCacheTtl(const Message &aMessage);
+    static TimeMilli GetCacheExpireTime(const Query &aEntry);
+#endif
 
     static const uint8_t   kQuestionCount[];
     static const uint16_t *kQuestionRecordTypes[];
@@ -739,6 +811,11 @@ private:
     QueryList        mQueries;
     TimerMilli       mTimer;
     QueryConfig      mDefaultConfig;
+#if OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+    QueryList     mCache; // Cached responses, least recently used first.
+    CacheCounters mCacheCounters;
+    uint16_t      mCacheClearCount;
+#endif
 };
 
 } // namespace Dns
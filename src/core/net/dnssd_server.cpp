@@ -639,83 +639,72 @@ Header::Response Server::ResolveQuestionBySrp(const char *      aName,
                                               NameCompressInfo &aCompressInfo,
                                               bool              aAdditional)
 {
-    Error                    error    = kErrorNone;
-    const Srp::Server::Host *host     = nullptr;
-    TimeMilli                now      = TimerMilli::GetNow();
-    uint16_t                 qtype    = aQuestion.GetType();
-    Header::Response         response = Header::kResponseNameError;
+    Error                       error    = kErrorNone;
+    const Srp::Server::Service *service  = nullptr;
+    uint16_t                    qtype    = aQuestion.GetType();
+    Header::Response            response = Header::kResponseNameError;
 
-    while ((host = GetNextSrpHost(host)) != nullptr)
+    // Handle PTR/SRV/TXT query
+    while ((service = GetNextSrpService(aName, qtype, service)) != nullptr)
     {
-        bool        needAdditionalAaaaRecord = false;
-        const char *hostName                 = host->GetFullName();
+        const Srp::Server::Host &host            = service->GetHost();
+        const char *             instanceName    = service->GetFullName();
+        bool                     ptrQueryMatched = qtype == ResourceRecord::kTypePtr;
+        bool                     srvQueryMatched = qtype == ResourceRecord::kTypeSrv;
+        bool                     txtQueryMatched = qtype == ResourceRecord::kTypeTxt;
+        uint32_t                 instanceTtl;
 
-        // Handle PTR/SRV/TXT query
-        if (qtype == ResourceRecord::kTypePtr || qtype == ResourceRecord::kTypeSrv || qtype == ResourceRecord::kTypeTxt)
+        instanceTtl = TimeMilli::MsecToSec(service->GetExpireTime() - TimerMilli::GetNow());
+
+        if (!aAdditional && ptrQueryMatched)
         {
-            const Srp::Server::Service *service = nullptr;
+            SuccessOrExit(error = AppendPtrRecord(aResponseMessage, aName, instanceName, instanceTtl, aCompressInfo));
+            IncResourceRecordCount(aResponseHeader, aAdditional);
+            response = Header::kResponseSuccess;
+        }
 
-            while ((service = GetNextSrpService(*host, service)) != nullptr)
-            {
-                uint32_t    instanceTtl         = TimeMilli::MsecToSec(service->GetExpireTime() - TimerMilli::GetNow());
-                const char *instanceName        = service->GetFullName();
-                bool        serviceNameMatched  = service->MatchesServiceName(aName);
-                bool        instanceNameMatched = service->Matches(aName);
-                bool        ptrQueryMatched     = qtype == ResourceRecord::kTypePtr && serviceNameMatched;
-                bool        srvQueryMatched     = qtype == ResourceRecord::kTypeSrv && instanceNameMatched;
-                bool        txtQueryMatched     = qtype == ResourceRecord::kTypeTxt && instanceNameMatched;
-
-                if (ptrQueryMatched || srvQueryMatched)
-                {
-                    needAdditionalAaaaRecord = true;
-                }
-
-                if (!aAdditional && ptrQueryMatched)
-                {
-                    SuccessOrExit(
-                        error = AppendPtrRecord(aResponseMessage, aName, instanceName, instanceTtl, aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aAdditional);
-                    response = Header::kResponseSuccess;
-                }
-
-                if ((!aAdditional && srvQueryMatched) ||
-                    (aAdditional && ptrQueryMatched &&
-                     !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeSrv)))
-                {
-                    SuccessOrExit(error = AppendSrvRecord(aResponseMessage, instanceName, hostName, instanceTtl,
-                                                          service->GetPriority(), service->GetWeight(),
-                                                          service->GetPort(), aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aAdditional);
-                    response = Header::kResponseSuccess;
-                }
-
-                if ((!aAdditional && txtQueryMatched) ||
-                    (aAdditional && ptrQueryMatched &&
-                     !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeTxt)))
-                {
-                    SuccessOrExit(error = AppendTxtRecord(aResponseMessage, instanceName, service->GetTxtData(),
-                                                          service->GetTxtDataLength(), instanceTtl, aCompressInfo));
-                    IncResourceRecordCount(aResponseHeader, aAdditional);
-                    response = Header::kResponseSuccess;
-                }
-            }
+        if ((!aAdditional && srvQueryMatched) ||
+            (aAdditional && ptrQueryMatched &&
+             !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeSrv)))
+        {
+            SuccessOrExit(error = AppendSrvRecord(aResponseMessage, instanceName, host.GetFullName(), instanceTtl,
+                                                  service->GetPriority(), service->GetWeight(), service->GetPort(),
+                                                  aCompressInfo));
+            IncResourceRecordCount(aResponseHeader, aAdditional);
+            response = Header::kResponseSuccess;
         }
 
-        // Handle AAAA query
-        if ((!aAdditional && qtype == ResourceRecord::kTypeAaaa && host->Matches(aName)) ||
-            (aAdditional && needAdditionalAaaaRecord &&
-             !HasQuestion(aResponseHeader, aResponseMessage, hostName, ResourceRecord::kTypeAaaa)))
+        if ((!aAdditional && txtQueryMatched) ||
+            (aAdditional && ptrQueryMatched &&
+             !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeTxt)))
         {
-            uint8_t             addrNum;
-            const Ip6::Address *addrs   = host->GetAddresses(addrNum);
-            uint32_t            hostTtl = TimeMilli::MsecToSec(host->GetExpireTime() - now);
+            SuccessOrExit(error = AppendTxtRecord(aResponseMessage, instanceName, service->GetTxtData(),
+                                                  service->GetTxtDataLength(), instanceTtl, aCompressInfo));
+            IncResourceRecordCount(aResponseHeader, aAdditional);
+            response = Header::kResponseSuccess;
+        }
 
-            for (uint8_t i = 0; i < addrNum; i++)
-            {
-                SuccessOrExit(error = AppendAaaaRecord(aResponseMessage, hostName, addrs[i], hostTtl, aCompressInfo));
-                IncResourceRecordCount(aResponseHeader, aAdditional);
-            }
+        // Add the AAAA records of the host once for all its matching services.
+        if (aAdditional && (ptrQueryMatched || srvQueryMatched) &&
+            !HasQuestion(aResponseHeader, aResponseMessage, host.GetFullName(), ResourceRecord::kTypeAaaa) &&
+            IsFirstSrpServiceOfHost(aName, qtype, *service))
+        {
+            SuccessOrExit(error = AppendSrpHostAddresses(host, aResponseHeader, aResponseMessage, aCompressInfo,
+                                                         aAdditional));
+            response = Header::kResponseSuccess;
+        }
+    }
+
+    // Handle AAAA query
+    if (!aAdditional && qtype == ResourceRecord::kTypeAaaa)
+    {
+        const Srp::Server &      srpServer = Get<Srp::Server>();
+        const Srp::Server::Host *host      = srpServer.FindHost(aName);
 
+        if (host != nullptr && !host->IsDeleted())
+        {
+            SuccessOrExit(error = AppendSrpHostAddresses(*host, aResponseHeader, aResponseMessage, aCompressInfo,
+                                                         aAdditional));
             response = Header::kResponseSuccess;
         }
     }
@@ -724,30 +713,87 @@ exit:
     return error == kErrorNone ? response : Header::kResponseServerFailure;
 }
 
-const Srp::Server::Host *Server::GetNextSrpHost(const Srp::Server::Host *aHost)
+Error Server::AppendSrpHostAddresses(const Srp::Server::Host &aHost,
+                                     Header &                 aResponseHeader,
+                                     Message &                aResponseMessage,
+                                     NameCompressInfo &       aCompressInfo,
+                                     bool                     aAdditional)
 {
-    const Srp::Server::Host *host = Get<Srp::Server>().GetNextHost(aHost);
+    Error               error = kErrorNone;
+    uint8_t             addrNum;
+    const Ip6::Address *addrs   = aHost.GetAddresses(addrNum);
+    uint32_t            hostTtl = TimeMilli::MsecToSec(aHost.GetExpireTime() - TimerMilli::GetNow());
 
-    while (host != nullptr && host->IsDeleted())
+    for (uint8_t i = 0; i < addrNum; i++)
     {
-        host = Get<Srp::Server>().GetNextHost(host);
+        SuccessOrExit(
+            error = AppendAaaaRecord(aResponseMessage, aHost.GetFullName(), addrs[i], hostTtl, aCompressInfo));
+        IncResourceRecordCount(aResponseHeader, aAdditional);
     }
 
-    return host;
+exit:
+    return error;
 }
 
-const Srp::Server::Service *Server::GetNextSrpService(const Srp::Server::Host &   aHost,
+const Srp::Server::Service *Server::GetNextSrpService(const char *                aName,
+                                                      uint16_t                    aQueryType,
                                                       const Srp::Server::Service *aService)
 {
-    const Srp::Server::Service *service = aHost.GetNextService(aService);
+    const Srp::Server &         srpServer = Get<Srp::Server>();
+    const Srp::Server::Service *service   = nullptr;
 
-    while (service != nullptr && service->IsDeleted())
+    switch (aQueryType)
     {
-        service = aHost.GetNextService(service);
+    case ResourceRecord::kTypePtr:
+        service = aService;
+
+        do
+        {
+            service = srpServer.GetNextServiceByServiceName(aName, service);
+        } while (service != nullptr && (service->IsDeleted() || service->GetHost().IsDeleted()));
+
+        break;
+
+    case ResourceRecord::kTypeSrv:
+    case ResourceRecord::kTypeTxt:
+        VerifyOrExit(aService == nullptr);
+        service = srpServer.FindService(aName);
+
+        if (service != nullptr && (service->IsDeleted() || service->GetHost().IsDeleted()))
+        {
+            service = nullptr;
+        }
+
+        break;
+
+    default:
+        break;
     }
 
+exit:
     return service;
 }
+
+bool Server::IsFirstSrpServiceOfHost(const char *aName, uint16_t aQueryType, const Srp::Server::Service &aService)
+{
+    // Only walks the services of `aService`'s host (rather than all services matching the query) to check whether
+    // `aService` is the first of them answering the query, so that the host addresses are appended exactly once.
+    const Srp::Server::Service *service = nullptr;
+
+    // A SRV query matches a single service instance.
+    VerifyOrExit(aQueryType == ResourceRecord::kTypePtr, service = &aService);
+
+    while ((service = aService.GetHost().GetNextService(service)) != nullptr)
+    {
+        if (!service->IsDeleted() && strcmp(service->GetServiceName(), aName) == 0)
+        {
+            break;
+        }
+    }
+
+exit:
+    return service == &aService;
+}
 #endif // OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
 
 Error Server::ResolveByQueryCallbacks(Header &                aResponseHeader,
@@ -334,9 +334,17 @@ private:
                                                             Message &         aResponseMessage,
                                                             NameCompressInfo &aCompressInfo,
                                                             bool              aAdditional);
-    const Srp::Server::Host *          GetNextSrpHost(const Srp::Server::Host *aHost);
-    static const Srp::Server::Service *GetNextSrpService(const Srp::Server::Host &   aHost,
+    const Srp::Server::Service *       GetNextSrpService(const char *                aName,
+                                                         uint16_t                    aQueryType,
                                                          const Srp::Server::Service *aService);
+    bool                               IsFirstSrpServiceOfHost(const char *                aName,
+                                                               uint16_t                    aQueryType,
+                                                               const Srp::Server::Service &aService);
+    static Error                       AppendSrpHostAddresses(const Srp::Server::Host &aHost,
+                                                              Header &                 aResponseHeader,
+                                                              Message &                aResponseMessage,
+                                                              NameCompressInfo &       aCompressInfo,
+                                                              bool                     aAdditional);
 #endif
 
     Error             ResolveByQueryCallbacks(Header &                aResponseHeader,
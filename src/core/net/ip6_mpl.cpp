@@ -368,7 +368,23 @@ void Mpl::HandleRetransmissionTimer(void)
 
             if (metadata.mTransmissionCount < GetTimerExpirations())
             {
-                Message *messageCopy = message->Clone(message->GetLength() - sizeof(Metadata));
+                Message *messageCopy;
+
+                // The metadata is updated before the message is cloned,
+                // since the copy shares the message buffers. Updating
+                // it fails only if the previous copy is still queued
+                // and its shared buffers cannot be copied.
+
+                metadata.GenerateNextTransmissionTime(now, kDataMessageInterval);
+
+                if (metadata.UpdateIn(*message) != kErrorNone)
+                {
+                    mBufferedMessageSet.Dequeue(*message);
+                    message->Free();
+                    continue;
+                }
+
+                messageCopy = message->CloneSharingBuffers(message->GetLength() - sizeof(Metadata));
 
                 if (messageCopy != nullptr)
                 {
@@ -380,9 +396,6 @@ void Mpl::HandleRetransmissionTimer(void)
                     Get<Ip6>().EnqueueDatagram(*messageCopy);
                 }
 
-                metadata.GenerateNextTransmissionTime(now, kDataMessageInterval);
-                metadata.UpdateIn(*message);
-
                 if (nextTime > metadata.mTransmissionTime)
                 {
                     nextTime = metadata.mTransmissionTime;
@@ -433,9 +446,16 @@ void Mpl::Metadata::RemoveFrom(Message &aMessage) const
     OT_UNUSED_VARIABLE(error);
 }
 
-void Mpl::Metadata::UpdateIn(Message &aMessage) const
+Error Mpl::Metadata::UpdateIn(Message &aMessage) const
 {
+    Error error;
+
+    // A retransmitted copy may still share the message buffers.
+    SuccessOrExit(error = aMessage.UnshareBuffers());
     aMessage.Write(aMessage.GetLength() - sizeof(*this), *this);
+
+exit:
+    return error;
 }
 
 void Mpl::Metadata::GenerateNextTransmissionTime(TimeMilli aCurrentTime, uint8_t aInterval)
@@ -310,7 +310,7 @@ private:
         Error AppendTo(Message &aMessage) const { return aMessage.Append(*this); }
         void  ReadFrom(const Message &aMessage);
         void  RemoveFrom(Message &aMessage) const;
-        void  UpdateIn(Message &aMessage) const;
+        Error UpdateIn(Message &aMessage) const;
         void  GenerateNextTransmissionTime(TimeMilli aCurrentTime, uint8_t aInterval);
 
         TimeMilli mTransmissionTime;
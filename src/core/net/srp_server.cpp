@@ -90,6 +90,10 @@ Server::Server(Instance &aInstance)
     , mServiceUpdateId(Random::NonCrypto::GetUint32())
     , mEnabled(false)
 {
+    memset(mHostNameIndex, 0, sizeof(mHostNameIndex));
+    memset(mServiceNameIndex, 0, sizeof(mServiceNameIndex));
+    memset(mServiceTypeIndex, 0, sizeof(mServiceTypeIndex));
+
     IgnoreError(SetDomain(kDefaultDomain));
 }
 
@@ -208,12 +212,30 @@ const Server::Host *Server::GetNextHost(const Server::Host *aHost)
     return (aHost == nullptr) ? mHosts.GetHead() : aHost->GetNext();
 }
 
+const Server::Host *Server::FindHost(const char *aFullName) const
+{
+    return const_cast<Server *>(this)->FindHost(aFullName);
+}
+
+Server::Host *Server::FindHost(const char *aFullName)
+{
+    Host *host = mHostNameIndex[GetNameIndexBucket(aFullName)];
+
+    while (host != nullptr && !host->Matches(aFullName))
+    {
+        host = host->mNextInNameIndex;
+    }
+
+    return host;
+}
+
 // This method adds a SRP service host and takes ownership of it.
 // The caller MUST make sure that there is no existing host with the same hostname.
 void Server::AddHost(Host *aHost)
 {
-    OT_ASSERT(mHosts.FindMatching(aHost->GetFullName()) == nullptr);
+    OT_ASSERT(FindHost(aHost->GetFullName()) == nullptr);
     IgnoreError(mHosts.Add(*aHost));
+    IndexHost(*aHost);
 }
 
 void Server::RemoveHost(Host *aHost, bool aRetainName, bool aNotifyServiceHandler)
@@ -231,6 +253,7 @@ void Server::RemoveHost(Host *aHost, bool aRetainName, bool aNotifyServiceHandle
     {
         aHost->mKeyLease = 0;
         IgnoreError(mHosts.Remove(*aHost));
+        UnindexHost(*aHost);
         otLogInfoSrp("[server] fully remove host '%s'", aHost->mFullName);
     }
 
@@ -255,25 +278,115 @@ exit:
 
 const Server::Service *Server::FindService(const char *aFullName) const
 {
-    const Service *service = nullptr;
+    const Service *service = mServiceNameIndex[GetNameIndexBucket(aFullName)];
+
+    while (service != nullptr && !service->Matches(aFullName))
+    {
+        service = service->mNextInNameIndex;
+    }
+
+    return service;
+}
+
+const Server::Service *Server::GetNextServiceByServiceName(const char *aServiceName, const Service *aService) const
+{
+    const Service *service =
+        (aService == nullptr) ? mServiceTypeIndex[GetNameIndexBucket(aServiceName)] : aService->mNextInServiceNameIndex;
 
-    for (const Host *host = mHosts.GetHead(); host != nullptr; host = host->GetNext())
+    while (service != nullptr && strcmp(service->GetServiceName(), aServiceName) != 0)
     {
-        service = host->FindService(aFullName);
-        if (service != nullptr)
+        service = service->mNextInServiceNameIndex;
+    }
+
+    return service;
+}
+
+uint16_t Server::GetNameIndexBucket(const char *aName)
+{
+    uint32_t hash = 2166136261u;
+
+    // FNV-1a
+    while (*aName != '\0')
+    {
+        hash = (hash ^ static_cast<uint8_t>(*aName++)) * 16777619u;
+    }
+
+    return static_cast<uint16_t>(hash % kNameIndexSize);
+}
+
+void Server::IndexHost(Host &aHost)
+{
+    Host *&  head    = mHostNameIndex[GetNameIndexBucket(aHost.GetFullName())];
+    Service *service = nullptr;
+
+    aHost.mNextInNameIndex = head;
+    head                   = &aHost;
+
+    while ((service = aHost.GetNextService(service)) != nullptr)
+    {
+        IndexService(*service);
+    }
+}
+
+void Server::UnindexHost(Host &aHost)
+{
+    // Services are removed from the indexes when they are freed.
+    for (Host **entry = &mHostNameIndex[GetNameIndexBucket(aHost.GetFullName())]; *entry != nullptr;
+         entry        = &(*entry)->mNextInNameIndex)
+    {
+        if (*entry == &aHost)
         {
+            *entry                 = aHost.mNextInNameIndex;
+            aHost.mNextInNameIndex = nullptr;
             break;
         }
     }
+}
 
-    return service;
+void Server::IndexService(Service &aService)
+{
+    Service *&nameHead = mServiceNameIndex[GetNameIndexBucket(aService.GetFullName())];
+    Service *&typeHead = mServiceTypeIndex[GetNameIndexBucket(aService.GetServiceName())];
+
+    aService.mNextInNameIndex        = nameHead;
+    nameHead                         = &aService;
+    aService.mNextInServiceNameIndex = typeHead;
+    typeHead                         = &aService;
+}
+
+void Server::UnindexService(Service &aService)
+{
+    // A service which is not indexed (e.g., a service of a host which is
+    // being parsed from an SRP update) is simply not found.
+
+    for (Service **entry = &mServiceNameIndex[GetNameIndexBucket(aService.GetFullName())]; *entry != nullptr;
+         entry           = &(*entry)->mNextInNameIndex)
+    {
+        if (*entry == &aService)
+        {
+            *entry                    = aService.mNextInNameIndex;
+            aService.mNextInNameIndex = nullptr;
+            break;
+        }
+    }
+
+    for (Service **entry = &mServiceTypeIndex[GetNameIndexBucket(aService.GetServiceName())]; *entry != nullptr;
+         entry           = &(*entry)->mNextInServiceNameIndex)
+    {
+        if (*entry == &aService)
+        {
+            *entry                           = aService.mNextInServiceNameIndex;
+            aService.mNextInServiceNameIndex = nullptr;
+            break;
+        }
+    }
 }
 
 bool Server::HasNameConflictsWith(Host &aHost) const
 {
     bool           hasConflicts = false;
     const Service *service      = nullptr;
-    const Host *   existingHost = mHosts.FindMatching(aHost.GetFullName());
+    const Host *   existingHost = FindHost(aHost.GetFullName());
 
     if (existingHost != nullptr && *aHost.GetKey() != *existingHost->GetKey())
     {
@@ -346,7 +459,7 @@ void Server::CommitSrpUpdate(Error                    aError,
     aHost.SetLease(grantedLease);
     aHost.SetKeyLease(grantedKeyLease);
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
 
     if (aHost.GetLease() == 0)
     {
@@ -391,6 +504,12 @@ void Server::CommitSrpUpdate(Error                    aError,
                 Service *newService = existingHost->AddService(service->mFullName);
 
                 VerifyOrExit(newService != nullptr, aError = kErrorNoBufs);
+
+                if (existingService == nullptr)
+                {
+                    IndexService(*newService);
+                }
+
                 SuccessOrExit(aError = newService->CopyResourcesFrom(*service));
                 otLogInfoSrp("[server] %s service %s", (existingService != nullptr) ? "update existing" : "add new",
                              service->mFullName);
@@ -990,7 +1109,7 @@ void Server::HandleUpdate(const Dns::UpdateHeader &aDnsHeader, Host *aHost, cons
 
     if (aHost->GetLease() == 0)
     {
-        Host *existingHost = mHosts.FindMatching(aHost->GetFullName());
+        Host *existingHost = FindHost(aHost->GetFullName());
 
         aHost->ClearResources();
 
@@ -1312,6 +1431,7 @@ void Server::Service::Free(void)
 
 Server::Service::Service(void)
     : mFullName(nullptr)
+    , mServiceName("")
     , mPriority(0)
     , mWeight(0)
     , mPort(0)
@@ -1319,6 +1439,8 @@ Server::Service::Service(void)
     , mTxtData(nullptr)
     , mHost(nullptr)
     , mNext(nullptr)
+    , mNextInNameIndex(nullptr)
+    , mNextInServiceNameIndex(nullptr)
     , mTimeLastUpdate(TimerMilli::GetNow())
 {
 }
@@ -1336,6 +1458,10 @@ Error Server::Service::SetFullName(const char *aFullName)
     Instance::HeapFree(mFullName);
     mFullName = nameCopy;
 
+    // The service name <Service>.<Domain> follows the <Instance> label.
+    mServiceName = strchr(mFullName, '.');
+    mServiceName = (mServiceName != nullptr) ? mServiceName + 1 : "";
+
 exit:
     return error;
 }
@@ -1468,6 +1594,7 @@ Server::Host::Host(Instance &aInstance)
     , mFullName(nullptr)
     , mAddressesNum(0)
     , mNext(nullptr)
+    , mNextInNameIndex(nullptr)
     , mLease(0)
     , mKeyLease(0)
     , mTimeLastUpdate(TimerMilli::GetNow())
@@ -1558,6 +1685,7 @@ void Server::Host::RemoveService(Service *aService, bool aRetainName, bool aNoti
     }
     else
     {
+        server.UnindexService(*aService);
         otLogInfoSrp("[server] fully remove service '%s'", aService->mFullName);
     }
 
@@ -137,6 +137,14 @@ public:
          */
         const char *GetFullName(void) const { return mFullName; }
 
+        /**
+         * This method returns the service name <Service>.<Domain> of the service instance.
+         *
+         * @returns  A pointer to the null-terminated service name string (within the full name).
+         *
+         */
+        const char *GetServiceName(void) const { return mServiceName; }
+
         /**
          * This method returns the port of the service instance.
          *
@@ -233,6 +241,7 @@ public:
         void  ClearResources(void);
 
         char *           mFullName;
+        const char *     mServiceName; // Points into `mFullName`, past the <Instance> label.
         uint16_t         mPriority;
         uint16_t         mWeight;
         uint16_t         mPort;
@@ -240,6 +249,8 @@ public:
         uint8_t *        mTxtData;
         otSrpServerHost *mHost;
         Service *        mNext;
+        Service *        mNextInNameIndex;        // The next service in the same bucket of the instance name index.
+        Service *        mNextInServiceNameIndex; // The next service in the same bucket of the service name index.
         TimeMilli        mTimeLastUpdate;
         bool             mIsDeleted;
     };
@@ -394,6 +405,7 @@ public:
         Ip6::Address mAddresses[kMaxAddressesNum];
         uint8_t      mAddressesNum;
         Host *       mNext;
+        Host *       mNextInNameIndex; // The next host in the same bucket of the host name index.
 
         Dns::Ecdsa256KeyRecord mKey;
         uint32_t               mLease;    // The LEASE time in seconds.
@@ -496,6 +508,43 @@ public:
      */
     const Host *GetNextHost(const Host *aHost);
 
+    /**
+     * This method finds a registered SRP host by its full name.
+     *
+     * The returned host may have been deleted but retain its name (@sa Host::IsDeleted()).
+     *
+     * @param[in]  aFullName  The full name of the host.
+     *
+     * @returns  A pointer to the SRP host or nullptr if no such host is registered.
+     *
+     */
+    const Host *FindHost(const char *aFullName) const;
+
+    /**
+     * This method finds a registered SRP service instance by its full name.
+     *
+     * The returned service may have been deleted but retain its name (@sa Service::IsDeleted()).
+     *
+     * @param[in]  aFullName  The full name of the service instance.
+     *
+     * @returns  A pointer to the SRP service or nullptr if no such service is registered.
+     *
+     */
+    const Service *FindService(const char *aFullName) const;
+
+    /**
+     * This method returns the next registered SRP service instance of a given service name.
+     *
+     * The returned services may have been deleted but retain their names (@sa Service::IsDeleted()).
+     *
+     * @param[in]  aServiceName  The full service name <Service>.<Domain> to match.
+     * @param[in]  aService      The current SRP service; use nullptr to get the first matching SRP service.
+     *
+     * @returns  A pointer to the next matching SRP service or nullptr if no more services can be found.
+     *
+     */
+    const Service *GetNextServiceByServiceName(const char *aServiceName, const Service *aService) const;
+
     /**
      * This method receives the service update result from service handler set by
      * SetServiceHandler.
@@ -510,6 +559,7 @@ private:
     enum : uint16_t
     {
         kUdpPayloadSize = Ip6::Ip6::kMaxDatagramLength - sizeof(Ip6::Udp::Header), // Max UDP payload size
+        kNameIndexSize  = OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE,
     };
 
     enum : uint32_t
@@ -608,8 +658,14 @@ private:
                                                 const Dns::Zone &        aZone,
                                                 uint16_t &               aOffset) const;
 
-    static bool    IsValidDeleteAllRecord(const Dns::ResourceRecord &aRecord);
-    const Service *FindService(const char *aFullName) const;
+    static bool IsValidDeleteAllRecord(const Dns::ResourceRecord &aRecord);
+
+    static uint16_t GetNameIndexBucket(const char *aName);
+    Host *          FindHost(const char *aFullName);
+    void            IndexHost(Host &aHost);
+    void            UnindexHost(Host &aHost);
+    void            IndexService(Service &aService);
+    void            UnindexService(Service &aService);
 
     void        HandleUpdate(const Dns::UpdateHeader &aDnsHeader, Host *aHost, const Ip6::MessageInfo &aMessageInfo);
     void        AddHost(Host *aHost);
@@ -646,6 +702,11 @@ private:
     LinkedList<Host> mHosts;
     TimerMilli       mLeaseTimer;
 
+    // Hash indexes of registered hosts and services, chained through `mNextInNameIndex` and `mNextInServiceNameIndex`.
+    Host *   mHostNameIndex[kNameIndexSize];
+    Service *mServiceNameIndex[kNameIndexSize];
+    Service *mServiceTypeIndex[kNameIndexSize];
+
     TimerMilli                 mOutstandingUpdatesTimer;
     LinkedList<UpdateMetadata> mOutstandingUpdates;
 
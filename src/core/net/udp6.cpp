@@ -34,6 +34,7 @@
 #include "udp6.hpp"
 
 #include <stdio.h>
+#include <string.h>
 
 #include <openthread/platform/udp.h>
 
@@ -156,6 +157,10 @@ exit:
 Udp::Udp(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mEphemeralPort(kDynamicPortMin)
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+    , mSocketSequence(0)
+    , mNumUnindexedSockets(0)
+#endif
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     , mPrevBackboneSockets(nullptr)
 #endif
@@ -164,6 +169,9 @@ Udp::Udp(Instance &aInstance)
     , mUdpForwarder(nullptr)
 #endif
 {
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+    memset(mSocketIndex, 0, sizeof(mSocketIndex));
+#endif
 }
 
 Error Udp::AddReceiver(Receiver &aReceiver)
@@ -190,6 +198,7 @@ Error Udp::Open(SocketHandle &aSocket, otUdpReceive aHandler, void *aContext)
     aSocket.GetPeerName().Clear();
     aSocket.mHandler = aHandler;
     aSocket.mContext = aContext;
+    memset(&aSocket.mCounters, 0, sizeof(aSocket.mCounters));
 
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
     error = otPlatUdpSocket(&aSocket);
@@ -241,6 +250,10 @@ Error Udp::Bind(SocketHandle &aSocket, const SockAddr &aSockAddr, otNetifIdentif
     }
 #endif
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+    UpdateSocketIndex(aSocket);
+#endif
+
 exit:
     return error;
 }
@@ -373,7 +386,18 @@ exit:
 
 void Udp::AddSocket(SocketHandle &aSocket)
 {
-    SuccessOrExit(mSockets.Add(aSocket));
+    if (mSockets.Add(aSocket) != kErrorNone)
+    {
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+        // The socket is re-opened, its port was cleared.
+        UpdateSocketIndex(aSocket);
+#endif
+        ExitNow();
+    }
+
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+    AddToSocketIndex(aSocket, mSocketSequence++);
+#endif
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     if (mPrevBackboneSockets == nullptr)
@@ -391,6 +415,21 @@ void Udp::RemoveSocket(SocketHandle &aSocket)
 
     SuccessOrExit(mSockets.Find(aSocket, prev));
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+    {
+        uint32_t sequence;
+
+        if (!RemoveFromSocketIndex(aSocket, sequence)
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+            && !IsBackboneSocket(aSocket)
+#endif
+        )
+        {
+            mNumUnindexedSockets--;
+        }
+    }
+#endif
+
     mSockets.PopAfter(prev);
     aSocket.SetNext(nullptr);
 
@@ -405,6 +444,139 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+
+void Udp::AddToSocketIndex(SocketHandle &aSocket, uint32_t aSequence)
+{
+    uint16_t slot = GetSocketIndexSlot(aSocket.GetSockName().mPort);
+
+    for (uint16_t i = 0; i < kSocketIndexSize; i++)
+    {
+        SocketIndexEntry &entry = mSocketIndex[slot];
+
+        if (entry.mSocket == nullptr)
+        {
+            entry.mSocket   = &aSocket;
+            entry.mSequence = aSequence;
+            entry.mPort     = aSocket.GetSockName().mPort;
+            ExitNow();
+        }
+
+        slot = (slot + 1) % kSocketIndexSize;
+    }
+
+    mNumUnindexedSockets++;
+
+exit:
+    return;
+}
+
+bool Udp::RemoveFromSocketIndex(const SocketHandle &aSocket, uint32_t &aSequence)
+{
+    // The port of `aSocket` may have changed since it was indexed, so
+    // the entry is searched over the whole table. This is only done
+    // when a socket is bound or closed.
+
+    bool     found = false;
+    uint16_t slot;
+    uint16_t next;
+
+    for (slot = 0; slot < kSocketIndexSize; slot++)
+    {
+        if (mSocketIndex[slot].mSocket == &aSocket)
+        {
+            found = true;
+            break;
+        }
+    }
+
+    VerifyOrExit(found);
+
+    aSequence                  = mSocketIndex[slot].mSequence;
+    mSocketIndex[slot].mSocket = nullptr;
+
+    // Backward shift deletion: move up the following entries of the
+    // probe run which would no longer be reachable from their home
+    // slot through the emptied one.
+
+    next = slot;
+
+    while (true)
+    {
+        uint16_t home;
+
+        next = (next + 1) % kSocketIndexSize;
+        VerifyOrExit(mSocketIndex[next].mSocket != nullptr);
+
+        home = GetSocketIndexSlot(mSocketIndex[next].mPort);
+
+        if ((next > slot) ? ((home <= slot) || (home > next)) : ((home <= slot) && (home > next)))
+        {
+            mSocketIndex[slot]         = mSocketIndex[next];
+            mSocketIndex[next].mSocket = nullptr;
+            slot                       = next;
+        }
+    }
+
+exit:
+    return found;
+}
+
+void Udp::UpdateSocketIndex(SocketHandle &aSocket)
+{
+    uint32_t sequence;
+
+    if (RemoveFromSocketIndex(aSocket, sequence))
+    {
+        AddToSocketIndex(aSocket, sequence);
+    }
+}
+
+Udp::SocketHandle *Udp::FindIndexedSocket(const MessageInfo &aMessageInfo, SocketHandle *&aPortSocket)
+{
+    // Among the indexed sockets matching `aMessageInfo`, returns the
+    // one which comes first in `mSockets` (largest sequence), i.e., the
+    // one `mSockets.FindMatching()` would return.
+
+    SocketHandle *socket       = nullptr;
+    uint32_t      sequence     = 0;
+    uint32_t      portSequence = 0;
+    uint16_t      port         = aMessageInfo.GetSockPort();
+    uint16_t      slot         = GetSocketIndexSlot(port);
+
+    aPortSocket = nullptr;
+
+    for (uint16_t i = 0; (i < kSocketIndexSize) && (mSocketIndex[slot].mSocket != nullptr); i++)
+    {
+        const SocketIndexEntry &entry = mSocketIndex[slot];
+
+        slot = (slot + 1) % kSocketIndexSize;
+
+        if (entry.mPort != port)
+        {
+            continue;
+        }
+
+        if (entry.mSocket->Matches(aMessageInfo))
+        {
+            if ((socket == nullptr) || (entry.mSequence > sequence))
+            {
+                socket   = entry.mSocket;
+                sequence = entry.mSequence;
+            }
+        }
+        else if ((aPortSocket == nullptr) || (entry.mSequence > portSequence))
+        {
+            aPortSocket  = entry.mSocket;
+            portSequence = entry.mSequence;
+        }
+    }
+
+    return socket;
+}
+
+#endif // OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+
 uint16_t Udp::GetEphemeralPort(void)
 {
     uint16_t rval = mEphemeralPort;
@@ -491,33 +663,74 @@ exit:
     return error;
 }
 
-void Udp::HandlePayload(Message &aMessage, MessageInfo &aMessageInfo)
+Udp::SocketHandle *Udp::FindSocket(const MessageInfo &aMessageInfo, SocketHandle *&aPortSocket)
 {
-    SocketHandle *socket;
-    SocketHandle *prev;
+    // Returns the socket to which the datagram is delivered. If there
+    // is none, `aPortSocket` is set to the first socket bound to the
+    // destination port (if any), which counts the datagram as dropped.
+
+    SocketHandle *      socket;
+    SocketHandle *      prev;
+    const SocketHandle *socketsBegin = mSockets.GetHead();
+    const SocketHandle *socketsEnd   = nullptr;
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+    if (!aMessageInfo.IsHostInterface())
+    {
+        socketsEnd = GetBackboneSockets();
+    }
+    else
+    {
+        socketsBegin = GetBackboneSockets();
+    }
+#endif
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+    // Backbone sockets are not indexed.
+    if ((mNumUnindexedSockets == 0)
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+        && !aMessageInfo.IsHostInterface()
+#endif
+    )
     {
-        const SocketHandle *socketsBegin, *socketsEnd;
+        ExitNow(socket = FindIndexedSocket(aMessageInfo, aPortSocket));
+    }
+#endif
+
+    socket      = mSockets.FindMatching(socketsBegin, socketsEnd, aMessageInfo, prev);
+    aPortSocket = nullptr;
 
-        if (!aMessageInfo.IsHostInterface())
+    VerifyOrExit(socket == nullptr);
+
+    for (const SocketHandle *entry = socketsBegin; entry != socketsEnd; entry = entry->GetNext())
+    {
+        if (entry->GetSockName().mPort == aMessageInfo.GetSockPort())
         {
-            socketsBegin = mSockets.GetHead();
-            socketsEnd   = GetBackboneSockets();
+            aPortSocket = const_cast<SocketHandle *>(entry);
+            break;
         }
-        else
+    }
+
+exit:
+    return socket;
+}
+
+void Udp::HandlePayload(Message &aMessage, MessageInfo &aMessageInfo)
+{
+    SocketHandle *portSocket;
+    SocketHandle *socket = FindSocket(aMessageInfo, portSocket);
+
+    if (socket == nullptr)
+    {
+        if (portSocket != nullptr)
         {
-            socketsBegin = GetBackboneSockets();
-            socketsEnd   = nullptr;
+            portSocket->mCounters.mRxDropped++;
         }
 
-        socket = mSockets.FindMatching(socketsBegin, socketsEnd, aMessageInfo, prev);
+        ExitNow();
     }
-#else
-    socket = mSockets.FindMatching(aMessageInfo, prev);
-#endif
 
-    VerifyOrExit(socket != nullptr);
+    socket->mCounters.mRxDatagrams++;
 
     aMessage.RemoveHeader(aMessage.GetOffset());
     OT_ASSERT(aMessage.GetOffset() == 0);
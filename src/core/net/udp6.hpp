@@ -122,6 +122,14 @@ public:
          */
         const SockAddr &GetPeerName(void) const { return *static_cast<const SockAddr *>(&mPeerName); }
 
+        /**
+         * This method returns the receive counters of the socket.
+         *
+         * @returns A reference to the receive counters.
+         *
+         */
+        const otUdpSocketCounters &GetCounters(void) const { return mCounters; }
+
     private:
         bool Matches(const MessageInfo &aMessageInfo) const;
 
@@ -591,8 +599,30 @@ private:
         kDynamicPortMax = 65535, ///< Service Name and Transport Protocol Port Number Registry
     };
 
-    void AddSocket(SocketHandle &aSocket);
-    void RemoveSocket(SocketHandle &aSocket);
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+    enum : uint16_t
+    {
+        kSocketIndexSize = OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE,
+    };
+
+    struct SocketIndexEntry
+    {
+        SocketHandle *mSocket;
+        uint32_t      mSequence; // Order of the socket in `mSockets`, a larger value comes first.
+        uint16_t      mPort;
+    };
+#endif
+
+    void            AddSocket(SocketHandle &aSocket);
+    void            RemoveSocket(SocketHandle &aSocket);
+    SocketHandle *  FindSocket(const MessageInfo &aMessageInfo, SocketHandle *&aPortSocket);
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+    SocketHandle *  FindIndexedSocket(const MessageInfo &aMessageInfo, SocketHandle *&aPortSocket);
+    void            AddToSocketIndex(SocketHandle &aSocket, uint32_t aSequence);
+    bool            RemoveFromSocketIndex(const SocketHandle &aSocket, uint32_t &aSequence);
+    void            UpdateSocketIndex(SocketHandle &aSocket);
+    static uint16_t GetSocketIndexSlot(uint16_t aPort) { return aPort % kSocketIndexSize; }
+#endif
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
     bool ShouldUsePlatformUdp(const SocketHandle &aSocket) const;
 #endif
@@ -606,6 +636,13 @@ private:
     uint16_t                 mEphemeralPort;
     LinkedList<Receiver>     mReceivers;
     LinkedList<SocketHandle> mSockets;
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+    // Open addressing hash table of the non-backbone sockets in `mSockets`, keyed by local port. Sockets added while
+    // the table is full are counted, and datagrams are then matched by walking `mSockets`.
+    SocketIndexEntry mSocketIndex[kSocketIndexSize];
+    uint32_t         mSocketSequence;
+    uint16_t         mNumUnindexedSockets;
+#endif
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     SocketHandle *mPrevBackboneSockets;
 #endif
@@ -128,6 +128,7 @@ void Link::BeginTransmit(void)
     Packet        txPacket;
     Neighbor *    neighbor = nullptr;
     Mac::RxFrame *ackFrame = nullptr;
+    Error         error;
 
     VerifyOrExit(mState == kStateTransmit);
 
@@ -173,13 +174,12 @@ void Link::BeginTransmit(void)
     if (neighbor == nullptr)
     {
         txPacket.GetHeader().SetAckMode(Header::kNoAck);
-        txPacket.GetHeader().SetPacketNumber(mTxPacketNumber++);
+        txPacket.GetHeader().SetPacketNumber(mTxPacketNumber);
     }
     else
     {
         txPacket.GetHeader().SetAckMode(Header::kAckRequested);
-        txPacket.GetHeader().SetPacketNumber(neighbor->mTrelTxPacketNumber++);
-        neighbor->mTrelCurrentPendingAcks++;
+        txPacket.GetHeader().SetPacketNumber(neighbor->mTrelTxPacketNumber);
     }
 
     txPacket.GetHeader().SetChannel(mTxFrame.GetChannel());
@@ -195,7 +195,26 @@ void Link::BeginTransmit(void)
     otLogDebgMac("Trel: BeginTransmit() [%s] plen:%d", txPacket.GetHeader().ToString().AsCString(),
                  txPacket.GetPayloadLength());
 
-    VerifyOrExit(mInterface.Send(txPacket) == kErrorNone, InvokeSendDone(kErrorAbort));
+    error = mInterface.Send(txPacket);
+
+    // A full platform tx queue is reported as a busy channel, so the
+    // frame is handled like one that failed CCA rather than aborted.
+    VerifyOrExit(error == kErrorNone,
+                 InvokeSendDone((error == kErrorNoBufs) ? kErrorChannelAccessFailure : kErrorAbort));
+
+    // The packet number is only consumed once the platform accepted
+    // the packet, so a rejected packet does not leave a gap in the
+    // sequence seen by the neighbor.
+
+    if (neighbor == nullptr)
+    {
+        mTxPacketNumber++;
+    }
+    else
+    {
+        neighbor->mTrelTxPacketNumber++;
+        neighbor->mTrelCurrentPendingAcks++;
+    }
 
     if (mTxFrame.GetAckRequest())
     {
@@ -64,6 +64,9 @@ AddressResolver::AddressResolver(Instance &aInstance)
     Get<Tmf::Agent>().AddResource(mAddressNotification);
 
     IgnoreError(Get<Ip6::Icmp>().RegisterHandler(mIcmpHandler));
+
+    memset(mCacheIndex, 0, sizeof(mCacheIndex));
+    ResetCounters();
 }
 
 void AddressResolver::Clear(void)
@@ -84,6 +87,8 @@ void AddressResolver::Clear(void)
             mCacheEntryPool.Free(*entry);
         }
     }
+
+    memset(mCacheIndex, 0, sizeof(mCacheIndex));
 }
 
 Error AddressResolver::GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const
@@ -213,20 +218,65 @@ AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address
                                                              CacheEntryList *&   aList,
                                                              CacheEntry *&       aPrevEntry)
 {
-    CacheEntry *    entry   = nullptr;
-    CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
+    CacheEntry *entry = mCacheIndex[GetIndexBucket(aEid)];
 
-    for (CacheEntryList *list : lists)
+    while ((entry != nullptr) && !entry->Matches(aEid))
     {
-        aList = list;
-        entry = aList->FindMatching(aEid, aPrevEntry);
-        VerifyOrExit(entry == nullptr);
+        entry = entry->GetNextInIndex();
     }
 
-exit:
+    aList      = (entry != nullptr) ? entry->GetList() : nullptr;
+    aPrevEntry = (entry != nullptr) ? entry->GetPrev() : nullptr;
+
     return entry;
 }
 
+uint16_t AddressResolver::GetIndexBucket(const Ip6::Address &aEid)
+{
+    uint32_t hash = 2166136261u;
+
+    // FNV-1a
+    for (uint8_t byte : aEid.mFields.m8)
+    {
+        hash = (hash ^ byte) * 16777619u;
+    }
+
+    return static_cast<uint16_t>(hash % kCacheIndexSize);
+}
+
+void AddressResolver::AddToIndex(CacheEntry &aEntry)
+{
+    CacheEntry *&head = mCacheIndex[GetIndexBucket(aEntry.GetTarget())];
+
+    aEntry.SetNextInIndex(head);
+    head = &aEntry;
+}
+
+void AddressResolver::RemoveFromIndex(CacheEntry &aEntry)
+{
+    CacheEntry *&head = mCacheIndex[GetIndexBucket(aEntry.GetTarget())];
+    CacheEntry * prev = nullptr;
+
+    for (CacheEntry *entry = head; entry != nullptr; prev = entry, entry = entry->GetNextInIndex())
+    {
+        if (entry != &aEntry)
+        {
+            continue;
+        }
+
+        if (prev == nullptr)
+        {
+            head = aEntry.GetNextInIndex();
+        }
+        else
+        {
+            prev->SetNextInIndex(aEntry.GetNextInIndex());
+        }
+
+        break;
+    }
+}
+
 void AddressResolver::Remove(const Ip6::Address &aEid)
 {
     Remove(aEid, kReasonRemovingEid);
@@ -289,6 +339,7 @@ AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
         if (newEntry != nullptr)
         {
             RemoveCacheEntry(*newEntry, *list, prevEntry, kReasonEvictingForNewEntry);
+            mCounters.mEvictions++;
             ExitNow();
         }
 
@@ -320,6 +371,7 @@ void AddressResolver::RemoveCacheEntry(CacheEntry &    aEntry,
                                        Reason          aReason)
 {
     aList.PopAfter(aPrevEntry);
+    RemoveFromIndex(aEntry);
 
     if (&aList == &mQueryList)
     {
@@ -398,6 +450,7 @@ void AddressResolver::AddSnoopedCacheEntry(const Ip6::Address &aEid, Mac::ShortA
     }
 
     mSnoopedList.Push(*entry);
+    AddToIndex(*entry);
 
     LogCacheEntryChange(kEntryAdded, kReasonSnoop, *entry);
 
@@ -428,6 +481,8 @@ void AddressResolver::RestartAddressQueries(void)
 
     for (CacheEntry *entry = mQueryList.GetHead(); entry != nullptr; entry = entry->GetNext())
     {
+        entry->SetList(&mQueryList);
+
         IgnoreError(SendAddressQuery(entry->GetTarget()));
 
         entry->SetTimeout(kAddressQueryTimeout);
@@ -445,6 +500,15 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
 
     entry = FindCacheEntry(aEid, list, prev);
 
+    if ((list == &mCachedList) || (list == &mSnoopedList))
+    {
+        mCounters.mHits++;
+    }
+    else
+    {
+        mCounters.mMisses++;
+    }
+
     if (entry == nullptr)
     {
         // If the entry is not present in any of the lists, try to
@@ -460,6 +524,7 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
         entry->SetRloc16(Mac::kShortAddrInvalid);
         entry->SetRetryDelay(kAddressQueryInitialRetryDelay);
         entry->SetCanEvict(false);
+        AddToIndex(*entry);
         list = nullptr;
     }
 
@@ -503,7 +568,13 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
     entry->SetTimeout(kAddressQueryTimeout);
 
     error = SendAddressQuery(aEid);
-    VerifyOrExit(error == kErrorNone, mCacheEntryPool.Free(*entry));
+
+    if (error != kErrorNone)
+    {
+        RemoveFromIndex(*entry);
+        mCacheEntryPool.Free(*entry);
+        ExitNow();
+    }
 
     if (list == nullptr)
     {
@@ -1045,7 +1116,10 @@ void AddressResolver::LogCacheEntryChange(EntryChange, Reason, const CacheEntry
 void AddressResolver::CacheEntry::Init(Instance &aInstance)
 {
     InstanceLocatorInit::Init(aInstance);
-    mNextIndex = kNoNextIndex;
+    mNextIndex        = kNoNextIndex;
+    mPrevIndex        = kNoNextIndex;
+    mNextInIndexIndex = kNoNextIndex;
+    mList             = nullptr;
 }
 
 AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void)
@@ -1060,8 +1134,37 @@ const AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void) co
 
 void AddressResolver::CacheEntry::SetNext(CacheEntry *aEntry)
 {
+    // The previous entry index of `aEntry` is updated along with the
+    // next entry index, since all list operations link entries using
+    // `SetNext()`. It is not updated when an entry becomes the head
+    // of its list.
+
     VerifyOrExit(aEntry != nullptr, mNextIndex = kNoNextIndex);
-    mNextIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*aEntry);
+    mNextIndex         = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*aEntry);
+    aEntry->mPrevIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*this);
+
+exit:
+    return;
+}
+
+AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetPrev(void)
+{
+    return ((mList == nullptr) || (mList->GetHead() == this))
+               ? nullptr
+               : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mPrevIndex);
+}
+
+AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNextInIndex(void)
+{
+    return (mNextInIndexIndex == kNoNextIndex)
+               ? nullptr
+               : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mNextInIndexIndex);
+}
+
+void AddressResolver::CacheEntry::SetNextInIndex(CacheEntry *aEntry)
+{
+    VerifyOrExit(aEntry != nullptr, mNextInIndexIndex = kNoNextIndex);
+    mNextInIndexIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*aEntry);
 
 exit:
     return;
@@ -81,6 +81,12 @@ public:
      */
     typedef otCacheEntryInfo EntryInfo;
 
+    /**
+     * This type represents the EID cache counters.
+     *
+     */
+    typedef otEidCacheCounters Counters;
+
     /**
      * This constructor initializes the object.
      *
@@ -107,6 +113,20 @@ public:
      */
     Error GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const;
 
+    /**
+     * This method returns the EID cache counters.
+     *
+     * @returns The EID cache counters.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method resets the EID cache counters.
+     *
+     */
+    void ResetCounters(void) { memset(&mCounters, 0, sizeof(mCounters)); }
+
     /**
      * This method removes the EID-to-RLOC cache entries corresponding to an RLOC16.
      *
@@ -211,6 +231,7 @@ private:
     enum
     {
         kCacheEntries                  = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES,
+        kCacheIndexSize                = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_INDEX_SIZE,
         kMaxNonEvictableSnoopedEntries = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_MAX_SNOOP_ENTRIES,
         kAddressQueryTimeout           = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_TIMEOUT,             // in seconds
         kAddressQueryInitialRetryDelay = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_INITIAL_RETRY_DELAY, // in seconds
@@ -220,6 +241,8 @@ private:
         kIteratorEntryIndex            = 1,
     };
 
+    class CacheEntryList;
+
     class CacheEntry : public InstanceLocatorInit
     {
     public:
@@ -228,6 +251,13 @@ private:
         CacheEntry *      GetNext(void);
         const CacheEntry *GetNext(void) const;
         void              SetNext(CacheEntry *aEntry);
+        CacheEntry *      GetPrev(void);
+
+        CacheEntryList *GetList(void) const { return mList; }
+        void            SetList(CacheEntryList *aList) { mList = aList; }
+
+        CacheEntry *GetNextInIndex(void);
+        void        SetNextInIndex(CacheEntry *aEntry);
 
         const Ip6::Address &GetTarget(void) const { return mTarget; }
         void                SetTarget(const Ip6::Address &aTarget) { mTarget = aTarget; }
@@ -266,6 +296,9 @@ private:
         Ip6::Address      mTarget;
         Mac::ShortAddress mRloc16;
         uint16_t          mNextIndex;
+        uint16_t          mPrevIndex;        // Only valid if the entry is not the head of its list.
+        uint16_t          mNextInIndexIndex; // Next entry in the same `mCacheIndex` bucket.
+        CacheEntryList *  mList;             // The list containing the entry.
         union
         {
             struct
@@ -284,8 +317,17 @@ private:
         } mInfo;
     };
 
+    class CacheEntryList : public LinkedList<CacheEntry>
+    {
+    public:
+        void Push(CacheEntry &aEntry)
+        {
+            aEntry.SetList(this);
+            LinkedList<CacheEntry>::Push(aEntry);
+        }
+    };
+
     typedef Pool<CacheEntry, kCacheEntries> CacheEntryPool;
-    typedef LinkedList<CacheEntry>          CacheEntryList;
 
     enum EntryChange
     {
@@ -313,6 +355,10 @@ private:
     CacheEntry *FindCacheEntry(const Ip6::Address &aEid, CacheEntryList *&aList, CacheEntry *&aPrevEntry);
     CacheEntry *NewCacheEntry(bool aSnoopedEntry);
     void        RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, CacheEntry *aPrevEntry, Reason aReason);
+    void        AddToIndex(CacheEntry &aEntry);
+    void        RemoveFromIndex(CacheEntry &aEntry);
+
+    static uint16_t GetIndexBucket(const Ip6::Address &aEid);
 
     Error SendAddressQuery(const Ip6::Address &aEid);
 
@@ -355,6 +401,8 @@ private:
     CacheEntryList mSnoopedList;
     CacheEntryList mQueryList;
     CacheEntryList mQueryRetryList;
+    CacheEntry *   mCacheIndex[kCacheIndexSize]; // Hash index of the entries in all lists, by EID.
+    Counters       mCounters;
 
     Ip6::Icmp::Handler mIcmpHandler;
 };
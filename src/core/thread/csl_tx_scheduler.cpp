@@ -65,8 +65,14 @@ CslTxScheduler::CslTxScheduler(Instance &aInstance)
     , mCslTxMessage(nullptr)
     , mFrameContext()
     , mCallbacks(aInstance)
+    , mNumScheduled(0)
 {
     InitFrameRequestAhead();
+
+    for (uint16_t &position : mSchedulePosition)
+    {
+        position = kNotScheduled;
+    }
 }
 
 void CslTxScheduler::InitFrameRequestAhead(void)
@@ -93,6 +99,12 @@ void CslTxScheduler::Update(void)
     }
 }
 
+void CslTxScheduler::Update(Child &aChild)
+{
+    ScheduleChild(aChild, otPlatRadioGetNow(&GetInstance()));
+    Update();
+}
+
 void CslTxScheduler::Clear(void)
 {
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
@@ -109,6 +121,11 @@ void CslTxScheduler::Clear(void)
     mFrameContext.mMessageNextOffset = 0;
     mCslTxChild                      = nullptr;
     mCslTxMessage                    = nullptr;
+
+    while (mNumScheduled > 0)
+    {
+        UnscheduleAt(mNumScheduled - 1);
+    }
 }
 
 /**
@@ -119,31 +136,41 @@ void CslTxScheduler::Clear(void)
  */
 void CslTxScheduler::RescheduleCslTx(void)
 {
-    uint32_t minDelayTime = Time::kMaxDuration;
-    Child *  bestChild    = nullptr;
+    uint64_t radioNow  = otPlatRadioGetNow(&GetInstance());
+    Child *  bestChild = nullptr;
 
-    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
+    // The head of `mSchedule` is the child with the earliest CSL tx
+    // window. Its window may have passed since it was scheduled (the
+    // windows of other children can only be later), in which case
+    // the child is moved to its next window. A child which is no
+    // longer a candidate is removed.
+
+    while (mNumScheduled > 0)
     {
-        uint32_t delay;
-        uint32_t cslTxDelay;
+        uint16_t childIndex = mSchedule[0];
+        Child *  child      = Get<ChildTable>().GetChildAtIndex(childIndex);
 
-        if (!child.IsCslSynchronized() || child.GetIndirectMessageCount() == 0)
+        if ((child == nullptr) || !IsCslTxCandidate(*child))
         {
+            UnscheduleAt(0);
             continue;
         }
 
-        delay = GetNextCslTransmissionDelay(child, cslTxDelay);
-
-        if (delay < minDelayTime)
+        if (mNextTxWindow[childIndex] >= radioNow + mCslFrameRequestAheadUs)
         {
-            minDelayTime = delay;
-            bestChild    = &child;
+            bestChild = child;
+            break;
         }
+
+        mNextTxWindow[childIndex] = GetNextCslTxWindow(*child, radioNow);
+        SiftDown(0);
     }
 
     if (bestChild != nullptr)
     {
-        Get<Mac::Mac>().RequestCslFrameTransmission(minDelayTime / 1000UL);
+        uint64_t delay = mNextTxWindow[mSchedule[0]] - radioNow - mCslFrameRequestAheadUs;
+
+        Get<Mac::Mac>().RequestCslFrameTransmission(static_cast<uint32_t>(delay / 1000UL));
     }
 
     mCslTxChild = bestChild;
@@ -151,16 +178,134 @@ void CslTxScheduler::RescheduleCslTx(void)
 
 uint32_t CslTxScheduler::GetNextCslTransmissionDelay(const Child &aChild, uint32_t &aDelayFromLastRx) const
 {
-    uint64_t radioNow      = otPlatRadioGetNow(&GetInstance());
+    uint64_t radioNow     = otPlatRadioGetNow(&GetInstance());
+    uint64_t nextTxWindow = GetNextCslTxWindow(aChild, radioNow);
+
+    aDelayFromLastRx = static_cast<uint32_t>(nextTxWindow - aChild.GetLastRxTimestamp());
+
+    return static_cast<uint32_t>(nextTxWindow - radioNow - mCslFrameRequestAheadUs);
+}
+
+uint64_t CslTxScheduler::GetNextCslTxWindow(const Child &aChild, uint64_t aRadioNow) const
+{
     uint32_t periodInUs    = aChild.GetCslPeriod() * kUsPerTenSymbols;
     uint64_t firstTxWindow = aChild.GetLastRxTimestamp() + aChild.GetCslPhase() * kUsPerTenSymbols;
-    uint64_t nextTxWindow  = radioNow - (radioNow % periodInUs) + (firstTxWindow % periodInUs);
+    uint64_t nextTxWindow  = aRadioNow - (aRadioNow % periodInUs) + (firstTxWindow % periodInUs);
 
-    while (nextTxWindow < radioNow + mCslFrameRequestAheadUs) nextTxWindow += periodInUs;
+    while (nextTxWindow < aRadioNow + mCslFrameRequestAheadUs) nextTxWindow += periodInUs;
 
-    aDelayFromLastRx = static_cast<uint32_t>(nextTxWindow - aChild.GetLastRxTimestamp());
+    return nextTxWindow;
+}
 
-    return static_cast<uint32_t>(nextTxWindow - radioNow - mCslFrameRequestAheadUs);
+bool CslTxScheduler::IsCslTxCandidate(const Child &aChild)
+{
+    return !aChild.IsStateInvalid() && aChild.IsCslSynchronized() && (aChild.GetIndirectMessageCount() > 0);
+}
+
+void CslTxScheduler::ScheduleChild(const Child &aChild, uint64_t aRadioNow)
+{
+    uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+    uint16_t position   = mSchedulePosition[childIndex];
+
+    if (!IsCslTxCandidate(aChild))
+    {
+        if (position != kNotScheduled)
+        {
+            UnscheduleAt(position);
+        }
+
+        ExitNow();
+    }
+
+    mNextTxWindow[childIndex] = GetNextCslTxWindow(aChild, aRadioNow);
+
+    if (position == kNotScheduled)
+    {
+        position = mNumScheduled++;
+        PlaceAt(position, childIndex);
+    }
+
+    SiftUp(position);
+    SiftDown(mSchedulePosition[childIndex]);
+
+exit:
+    return;
+}
+
+void CslTxScheduler::UnscheduleAt(uint16_t aPosition)
+{
+    uint16_t childIndex = mSchedule[aPosition];
+
+    mSchedulePosition[childIndex] = kNotScheduled;
+    mNumScheduled--;
+
+    VerifyOrExit(aPosition != mNumScheduled);
+
+    // Move the last entry into the freed position and restore the
+    // heap order from there.
+
+    PlaceAt(aPosition, mSchedule[mNumScheduled]);
+    SiftUp(aPosition);
+    SiftDown(mSchedulePosition[mSchedule[aPosition]]);
+
+exit:
+    return;
+}
+
+void CslTxScheduler::SiftUp(uint16_t aPosition)
+{
+    uint16_t childIndex = mSchedule[aPosition];
+
+    while (aPosition > 0)
+    {
+        uint16_t parent = (aPosition - 1) / 2;
+
+        if (!IsEarlier(childIndex, mSchedule[parent]))
+        {
+            break;
+        }
+
+        PlaceAt(aPosition, mSchedule[parent]);
+        aPosition = parent;
+    }
+
+    PlaceAt(aPosition, childIndex);
+}
+
+void CslTxScheduler::SiftDown(uint16_t aPosition)
+{
+    uint16_t childIndex = mSchedule[aPosition];
+
+    while (true)
+    {
+        uint16_t earliest = 2 * aPosition + 1;
+
+        if (earliest >= mNumScheduled)
+        {
+            break;
+        }
+
+        if ((earliest + 1 < mNumScheduled) && IsEarlier(mSchedule[earliest + 1], mSchedule[earliest]))
+        {
+            earliest++;
+        }
+
+        if (!IsEarlier(mSchedule[earliest], childIndex))
+        {
+            break;
+        }
+
+        PlaceAt(aPosition, mSchedule[earliest]);
+        aPosition = earliest;
+    }
+
+    PlaceAt(aPosition, childIndex);
+}
+
+void CslTxScheduler::PlaceAt(uint16_t aPosition, uint16_t aChildIndex)
+{
+    mSchedule[aPosition]           = aChildIndex;
+    mSchedulePosition[aChildIndex] = aPosition;
 }
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
@@ -40,6 +40,7 @@
 #include "mac/mac.hpp"
 #include "mac/mac_frame.hpp"
 #include "thread/indirect_sender_frame_context.hpp"
+#include "thread/mle_types.hpp"
 
 namespace ot {
 
@@ -183,6 +184,17 @@ public:
      */
     void Update(void);
 
+    /**
+     * This method updates the CSL transmission schedule of a given child and then the next CSL transmission.
+     *
+     * This method MUST be called whenever the CSL parameters (synchronization, period, phase, last rx timestamp) or
+     * the indirect messages of the child change.
+     *
+     * @param[in]  aChild  The child whose state changed.
+     *
+     */
+    void Update(Child &aChild);
+
     /**
      * This method clears all the states inside `CslTxScheduler` and the related states in each child.
      *
@@ -190,10 +202,30 @@ public:
     void Clear(void);
 
 private:
+    enum : uint16_t
+    {
+        kMaxChildren  = Mle::kMaxChildren,
+        kNotScheduled = 0xffff, // Position of a child which is not in `mSchedule`.
+    };
+
     void InitFrameRequestAhead(void);
     void RescheduleCslTx(void);
 
     uint32_t GetNextCslTransmissionDelay(const Child &aChild, uint32_t &aDelayFromLastRx) const;
+    uint64_t GetNextCslTxWindow(const Child &aChild, uint64_t aRadioNow) const;
+
+    // The children with pending CSL transmissions are kept in a binary
+    // min-heap (`mSchedule`) ordered by their next CSL tx window.
+    static bool IsCslTxCandidate(const Child &aChild);
+    void        ScheduleChild(const Child &aChild, uint64_t aRadioNow);
+    void        UnscheduleAt(uint16_t aPosition);
+    void        SiftUp(uint16_t aPosition);
+    void        SiftDown(uint16_t aPosition);
+    void        PlaceAt(uint16_t aPosition, uint16_t aChildIndex);
+    bool        IsEarlier(uint16_t aChildIndex, uint16_t aOtherChildIndex) const
+    {
+        return mNextTxWindow[aChildIndex] < mNextTxWindow[aOtherChildIndex];
+    }
 
     // Callbacks from `Mac`
     Mac::TxFrame *HandleFrameRequest(Mac::TxFrames &aTxFrames);
@@ -206,6 +238,10 @@ private:
     Message *               mCslTxMessage;
     Callbacks::FrameContext mFrameContext;
     Callbacks               mCallbacks;
+    uint16_t                mNumScheduled;                   // Number of children in `mSchedule`.
+    uint16_t                mSchedule[kMaxChildren];         // Child indexes, heap ordered by `mNextTxWindow`.
+    uint16_t                mSchedulePosition[kMaxChildren]; // Position in `mSchedule` per child index.
+    uint64_t                mNextTxWindow[kMaxChildren];     // Next CSL tx window (radio time in usec) per child.
 };
 
 /**
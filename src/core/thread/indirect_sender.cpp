@@ -81,6 +81,14 @@ void IndirectSender::Stop(void)
         mSourceMatchController.ResetMessageCount(child);
     }
 
+    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAny))
+    {
+        child.mIndirectIndex.Clear();
+        child.SetIndirectIndexValid(true);
+    }
+
+    mMessageEntryPool.FreeAll();
+
     mDataPollHandler.Clear();
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     mCslTxScheduler.Clear();
@@ -101,6 +109,7 @@ void IndirectSender::AddMessageForSleepyChild(Message &aMessage, Child &aChild)
 
     aMessage.SetChildMask(childIndex);
     mSourceMatchController.IncrementMessageCount(aChild);
+    AddToIndex(aMessage, aChild);
 
     if ((aMessage.GetType() != Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
     {
@@ -128,6 +137,7 @@ Error IndirectSender::RemoveMessageFromSleepyChild(Message &aMessage, Child &aCh
 
     aMessage.ClearChildMask(childIndex);
     mSourceMatchController.DecrementMessageCount(aChild);
+    RemoveFromIndex(aMessage, aChild);
 
     RequestMessageUpdate(aChild);
 
@@ -137,26 +147,46 @@ exit:
 
 void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
 {
-    Message *message;
-    Message *nextMessage;
+    uint16_t childIndex;
 
     VerifyOrExit(aChild.GetIndirectMessageCount() > 0);
 
-    for (message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = nextMessage)
+    childIndex = Get<ChildTable>().GetChildIndex(aChild);
+
+    if (aChild.IsIndirectIndexValid())
     {
-        nextMessage = message->GetNext();
+        MessageEntry *entry;
 
-        message->ClearChildMask(Get<ChildTable>().GetChildIndex(aChild));
+        while ((entry = aChild.mIndirectIndex.Pop()) != nullptr)
+        {
+            Message &message = entry->GetMessage();
 
-        Get<MeshForwarder>().RemoveMessageIfNoPendingTx(*message);
+            mMessageEntryPool.Free(*entry);
+            message.ClearChildMask(childIndex);
+            Get<MeshForwarder>().RemoveMessageIfNoPendingTx(message);
+        }
+    }
+    else
+    {
+        Message *nextMessage;
+
+        for (Message *message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = nextMessage)
+        {
+            nextMessage = message->GetNext();
+
+            message->ClearChildMask(childIndex);
+
+            Get<MeshForwarder>().RemoveMessageIfNoPendingTx(*message);
+        }
     }
 
     aChild.SetIndirectMessage(nullptr);
     mSourceMatchController.ResetMessageCount(aChild);
+    ClearIndex(aChild);
 
     mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-    mCslTxScheduler.Update();
+    mCslTxScheduler.Update(aChild);
 #endif
 
 exit:
@@ -187,21 +217,33 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
     {
         uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
 
-        for (Message *message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = message->GetNext())
+        if (aChild.IsIndirectIndexValid())
         {
-            if (message->GetChildMask(childIndex))
+            for (MessageEntry *entry = aChild.mIndirectIndex.GetHead(); entry; entry = entry->GetNext())
             {
-                message->ClearChildMask(childIndex);
-                message->SetDirectTransmission();
+                entry->GetMessage().ClearChildMask(childIndex);
+                entry->GetMessage().SetDirectTransmission();
+            }
+        }
+        else
+        {
+            for (Message *message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = message->GetNext())
+            {
+                if (message->GetChildMask(childIndex))
+                {
+                    message->ClearChildMask(childIndex);
+                    message->SetDirectTransmission();
+                }
             }
         }
 
         aChild.SetIndirectMessage(nullptr);
         mSourceMatchController.ResetMessageCount(aChild);
+        ClearIndex(aChild);
 
         mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-        mCslTxScheduler.Update();
+        mCslTxScheduler.Update(aChild);
 #endif
     }
 
@@ -215,8 +257,24 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
 
 Message *IndirectSender::FindIndirectMessage(Child &aChild, bool aSupervisionTypeOnly)
 {
-    Message *message;
-    uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+    Message *message = nullptr;
+    uint16_t childIndex;
+
+    if (aChild.IsIndirectIndexValid())
+    {
+        for (MessageEntry *entry = aChild.mIndirectIndex.GetHead(); entry; entry = entry->GetNext())
+        {
+            if (!aSupervisionTypeOnly || (entry->GetMessage().GetType() == Message::kTypeSupervision))
+            {
+                message = &entry->GetMessage();
+                break;
+            }
+        }
+
+        ExitNow();
+    }
+
+    childIndex = Get<ChildTable>().GetChildIndex(aChild);
 
     for (message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = message->GetNext())
     {
@@ -227,9 +285,89 @@ Message *IndirectSender::FindIndirectMessage(Child &aChild, bool aSupervisionTyp
         }
     }
 
+exit:
     return message;
 }
 
+void IndirectSender::AddToIndex(Message &aMessage, Child &aChild)
+{
+    // Entries are kept in the same order as the messages in the
+    // send queue, i.e., by priority and then in order of arrival
+    // within the same priority level, so that the head entry is
+    // the next message to send to the child.
+
+    MessageEntry *entry;
+    MessageEntry *prev = nullptr;
+
+    VerifyOrExit(aChild.IsIndirectIndexValid());
+
+    entry = mMessageEntryPool.Allocate();
+
+    if (entry == nullptr)
+    {
+        // Out of entries. The child's messages are found by
+        // searching the send queue until all of them are sent
+        // or removed (see `ClearIndex()`).
+
+        ClearIndex(aChild);
+        aChild.SetIndirectIndexValid(false);
+        ExitNow();
+    }
+
+    entry->SetMessage(aMessage);
+
+    for (MessageEntry *cur = aChild.mIndirectIndex.GetHead(); cur; cur = cur->GetNext())
+    {
+        if (cur->GetMessage().GetPriority() < aMessage.GetPriority())
+        {
+            break;
+        }
+
+        prev = cur;
+    }
+
+    if (prev == nullptr)
+    {
+        aChild.mIndirectIndex.Push(*entry);
+    }
+    else
+    {
+        aChild.mIndirectIndex.PushAfter(*entry, *prev);
+    }
+
+exit:
+    return;
+}
+
+void IndirectSender::RemoveFromIndex(Message &aMessage, Child &aChild)
+{
+    if (aChild.IsIndirectIndexValid())
+    {
+        MessageEntry *entry = aChild.mIndirectIndex.RemoveMatching(aMessage);
+
+        if (entry != nullptr)
+        {
+            mMessageEntryPool.Free(*entry);
+        }
+    }
+    else if (aChild.GetIndirectMessageCount() == 0)
+    {
+        ClearIndex(aChild);
+    }
+}
+
+void IndirectSender::ClearIndex(Child &aChild)
+{
+    MessageEntry *entry;
+
+    while ((entry = aChild.mIndirectIndex.Pop()) != nullptr)
+    {
+        mMessageEntryPool.Free(*entry);
+    }
+
+    aChild.SetIndirectIndexValid(true);
+}
+
 void IndirectSender::RequestMessageUpdate(Child &aChild)
 {
     Message *curMessage = aChild.GetIndirectMessage();
@@ -256,7 +394,7 @@ void IndirectSender::RequestMessageUpdate(Child &aChild)
         aChild.SetWaitingForMessageUpdate(true);
         mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-        mCslTxScheduler.Update();
+        mCslTxScheduler.Update(aChild);
 #endif
 
         ExitNow();
@@ -288,7 +426,7 @@ void IndirectSender::RequestMessageUpdate(Child &aChild)
     aChild.SetWaitingForMessageUpdate(true);
     mDataPollHandler.RequestFrameChange(DataPollHandler::kReplaceFrame, aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-    mCslTxScheduler.Update();
+    mCslTxScheduler.Update(aChild);
 #endif
 
 exit:
@@ -314,7 +452,7 @@ void IndirectSender::UpdateIndirectMessage(Child &aChild)
     aChild.SetIndirectTxSuccess(true);
 
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-    mCslTxScheduler.Update();
+    mCslTxScheduler.Update(aChild);
 #endif
 
     if (message != nullptr)
@@ -475,7 +613,7 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
         aChild.SetIndirectFragmentOffset(nextOffset);
         mDataPollHandler.HandleNewFrame(aChild);
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-        mCslTxScheduler.Update();
+        mCslTxScheduler.Update(aChild);
 #endif
         ExitNow();
     }
@@ -540,6 +678,7 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
         {
             message->ClearChildMask(childIndex);
             mSourceMatchController.DecrementMessageCount(aChild);
+            RemoveFromIndex(*message, aChild);
         }
 
         Get<MeshForwarder>().RemoveMessageIfNoPendingTx(*message);
@@ -38,9 +38,11 @@
 
 #if OPENTHREAD_FTD
 
+#include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/pool.hpp"
 #include "mac/data_poll_handler.hpp"
 #include "mac/mac_frame.hpp"
 #include "thread/csl_tx_scheduler.hpp"
@@ -73,6 +75,24 @@ class IndirectSender : public InstanceLocator, public IndirectSenderBase, privat
     friend class CslTxScheduler::Callbacks;
 #endif
 
+    /**
+     * This class represents an entry in the index of messages queued for a child.
+     *
+     */
+    class MessageEntry : public LinkedListEntry<MessageEntry>
+    {
+        friend class LinkedListEntry<MessageEntry>;
+
+    public:
+        Message &GetMessage(void) const { return *mMessage; }
+        void     SetMessage(Message &aMessage) { mMessage = &aMessage; }
+        bool     Matches(const Message &aMessage) const { return mMessage == &aMessage; }
+
+    private:
+        MessageEntry *mNext;
+        Message *     mMessage;
+    };
+
 public:
     /**
      * This class defines all the child info required for indirect transmission.
@@ -119,6 +139,9 @@ public:
         bool IsWaitingForMessageUpdate(void) const { return mWaitingForMessageUpdate; }
         void SetWaitingForMessageUpdate(bool aNeedsUpdate) { mWaitingForMessageUpdate = aNeedsUpdate; }
 
+        bool IsIndirectIndexValid(void) const { return !mIndirectIndexInvalid; }
+        void SetIndirectIndexValid(bool aValid) { mIndirectIndexInvalid = !aValid; }
+
         const Mac::Address &GetMacAddress(Mac::Address &aMacAddress) const;
 
         Message *mIndirectMessage;             // Current indirect message.
@@ -128,6 +151,9 @@ public:
         uint16_t mQueuedMessageCount : 14;     // Number of queued indirect messages for the child.
         bool     mUseShortAddress : 1;         // Indicates whether to use short or extended address.
         bool     mSourceMatchPending : 1;      // Indicates whether or not pending to add to src match table.
+        bool     mIndirectIndexInvalid : 1;    // Indicates `mIndirectIndex` is not used (ran out of entries).
+
+        LinkedList<MessageEntry> mIndirectIndex; // Queued indirect messages for the child (in send queue order).
 
         static_assert(OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS < (1UL << 14),
                       "mQueuedMessageCount cannot fit max required!");
@@ -217,6 +243,14 @@ private:
     void  HandleSentFrameToChild(const Mac::TxFrame &aFrame, const FrameContext &aContext, Error aError, Child &aChild);
     void  HandleFrameChangeDone(Child &aChild);
 
+    enum
+    {
+        kNumMessageEntries = OPENTHREAD_CONFIG_INDIRECT_MESSAGE_INDEX_ENTRIES,
+    };
+
+    void     AddToIndex(Message &aMessage, Child &aChild);
+    void     RemoveFromIndex(Message &aMessage, Child &aChild);
+    void     ClearIndex(Child &aChild);
     void     UpdateIndirectMessage(Child &aChild);
     Message *FindIndirectMessage(Child &aChild, bool aSupervisionTypeOnly = false);
     void     RequestMessageUpdate(Child &aChild);
@@ -224,9 +258,10 @@ private:
     void     PrepareEmptyFrame(Mac::TxFrame &aFrame, Child &aChild, bool aAckRequest);
     void     ClearMessagesForRemovedChildren(void);
 
-    bool                  mEnabled;
-    SourceMatchController mSourceMatchController;
-    DataPollHandler       mDataPollHandler;
+    bool                                   mEnabled;
+    Pool<MessageEntry, kNumMessageEntries> mMessageEntryPool;
+    SourceMatchController                  mSourceMatchController;
+    DataPollHandler                        mDataPollHandler;
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     CslTxScheduler mCslTxScheduler;
 #endif
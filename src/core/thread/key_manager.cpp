@@ -169,6 +169,7 @@ exit:
 KeyManager::KeyManager(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mKeySequence(0)
+    , mKeyCacheLength(0)
     , mMleFrameCounter(0)
     , mStoredMacFrameCounter(0)
     , mStoredMleFrameCounter(0)
@@ -186,6 +187,7 @@ KeyManager::KeyManager(Instance &aInstance)
 
     mMacFrameCounters.Reset();
     mPskc.Clear();
+    ResetKeyCacheCounters();
 }
 
 void KeyManager::Start(void)
@@ -197,6 +199,7 @@ void KeyManager::Start(void)
 void KeyManager::Stop(void)
 {
     mKeyRotationTimer.Stop();
+    mAesKeyScheduleCache.Clear();
 }
 
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
@@ -215,6 +218,7 @@ Error KeyManager::SetMasterKey(const MasterKey &aKey)
     SuccessOrExit(Get<Notifier>().Update(mMasterKey, aKey, kEventMasterKeyChanged));
     Get<Notifier>().Signal(kEventThreadKeySeqCounterChanged);
     mKeySequence = 0;
+    ClearKeyCache();
     UpdateKeyMaterial();
 
     // reset parent frame counters
@@ -262,6 +266,55 @@ void KeyManager::ComputeKeys(uint32_t aKeySequence, HashKeys &aHashKeys)
     hmac.Finish(aHashKeys.mHash);
 }
 
+void KeyManager::GetKeys(uint32_t aKeySequence, HashKeys &aHashKeys)
+{
+    // Gets the keys for `aKeySequence` from the key cache, computing
+    // them on a miss. `mKeyCache` entries are ordered from the most
+    // to the least recently used one, so a hit is moved to the front
+    // and a miss replaces the last entry once the cache is full.
+
+    KeyCacheEntry entry;
+    uint8_t       index;
+
+    for (index = 0; index < mKeyCacheLength; index++)
+    {
+        if (mKeyCache[index].mKeySequence == aKeySequence)
+        {
+            break;
+        }
+    }
+
+    if (index < mKeyCacheLength)
+    {
+        mKeyCacheCounters.mHits++;
+        entry = mKeyCache[index];
+    }
+    else
+    {
+        mKeyCacheCounters.mMisses++;
+        entry.mKeySequence = aKeySequence;
+        ComputeKeys(aKeySequence, entry.mHashKeys);
+
+        if (mKeyCacheLength < kKeyCacheSize)
+        {
+            mKeyCacheLength++;
+        }
+
+        index = mKeyCacheLength - 1;
+    }
+
+    memmove(&mKeyCache[1], &mKeyCache[0], index * sizeof(KeyCacheEntry));
+    mKeyCache[0] = entry;
+    aHashKeys    = entry.mHashKeys;
+}
+
+void KeyManager::ClearKeyCache(void)
+{
+    memset(reinterpret_cast<void *>(mKeyCache), 0, sizeof(mKeyCache));
+    mKeyCacheLength = 0;
+    mAesKeyScheduleCache.Clear();
+}
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 void KeyManager::ComputeTrelKey(uint32_t aKeySequence, Mac::Key &aTrelKey)
 {
@@ -284,12 +337,12 @@ void KeyManager::UpdateKeyMaterial(void)
     HashKeys next;
 #endif
 
-    ComputeKeys(mKeySequence, cur);
+    GetKeys(mKeySequence, cur);
     mMleKey = cur.mKeys.mMleKey;
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
-    ComputeKeys(mKeySequence - 1, prev);
-    ComputeKeys(mKeySequence + 1, next);
+    GetKeys(mKeySequence - 1, prev);
+    GetKeys(mKeySequence + 1, next);
 
     Get<Mac::SubMac>().SetMacKey(Mac::Frame::kKeyIdMode1, (mKeySequence & 0x7f) + 1, prev.mKeys.mMacKey,
                                  cur.mKeys.mMacKey, next.mKeys.mMacKey);
@@ -332,7 +385,7 @@ const Mle::Key &KeyManager::GetTemporaryMleKey(uint32_t aKeySequence)
 {
     HashKeys hashKeys;
 
-    ComputeKeys(aKeySequence, hashKeys);
+    GetKeys(aKeySequence, hashKeys);
     mTemporaryMleKey = hashKeys.mKeys.mMleKey;
 
     return mTemporaryMleKey;
@@ -47,10 +47,15 @@
 #include "common/non_copyable.hpp"
 #include "common/random.hpp"
 #include "common/timer.hpp"
+#include "crypto/aes_ecb.hpp"
 #include "crypto/hmac_sha256.hpp"
 #include "mac/mac_types.hpp"
 #include "thread/mle_types.hpp"
 
+#if (OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_SIZE < 1) || (OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_SIZE > 255)
+#error "OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_SIZE must be between 1 and 255."
+#endif
+
 namespace ot {
 
 /**
@@ -182,6 +187,16 @@ typedef Mac::Key Kek;
 class KeyManager : public InstanceLocator, private NonCopyable
 {
 public:
+    /**
+     * This structure represents the key cache counters.
+     *
+     */
+    struct KeyCacheCounters : public Clearable<KeyCacheCounters>
+    {
+        uint32_t mHits;   ///< Number of key derivations served from the key cache.
+        uint32_t mMisses; ///< Number of key derivations computed using HMAC-SHA256.
+    };
+
     /**
      * This constructor initializes the object.
      *
@@ -304,6 +319,16 @@ public:
      */
     const Mle::Key &GetTemporaryMleKey(uint32_t aKeySequence);
 
+    /**
+     * This method returns the AES key schedule cache used when securing MAC frames and MLE messages.
+     *
+     * The cache is wiped when the Thread Master Key changes and when the KeyManager is stopped.
+     *
+     * @returns A reference to the AES key schedule cache.
+     *
+     */
+    Crypto::AesKeyScheduleCache &GetAesKeyScheduleCache(void) { return mAesKeyScheduleCache; }
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
     /**
      * This method returns the current MAC Frame Counter value for 15.4 radio link.
@@ -478,11 +503,26 @@ public:
      */
     void MacFrameCounterUpdated(uint32_t aMacFrameCounter);
 
+    /**
+     * This method returns the key cache counters.
+     *
+     * @returns A reference to the key cache counters.
+     *
+     */
+    const KeyCacheCounters &GetKeyCacheCounters(void) const { return mKeyCacheCounters; }
+
+    /**
+     * This method resets the key cache counters.
+     *
+     */
+    void ResetKeyCacheCounters(void) { mKeyCacheCounters.Clear(); }
+
 private:
     enum
     {
         kDefaultKeySwitchGuardTime = 624,
         kOneHourIntervalInMsec     = 3600u * 1000u,
+        kKeyCacheSize              = OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_SIZE,
     };
 
     OT_TOOL_PACKED_BEGIN
@@ -498,7 +538,15 @@ private:
         Keys                     mKeys;
     };
 
+    struct KeyCacheEntry
+    {
+        uint32_t mKeySequence;
+        HashKeys mHashKeys;
+    };
+
     void ComputeKeys(uint32_t aKeySequence, HashKeys &aHashKeys);
+    void GetKeys(uint32_t aKeySequence, HashKeys &aHashKeys);
+    void ClearKeyCache(void);
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     void ComputeTrelKey(uint32_t aKeySequence, Mac::Key &aTrelKey);
@@ -521,6 +569,12 @@ private:
     Mle::Key mMleKey;
     Mle::Key mTemporaryMleKey;
 
+    KeyCacheEntry    mKeyCache[kKeyCacheSize];
+    uint8_t          mKeyCacheLength;
+    KeyCacheCounters mKeyCacheCounters;
+
+    Crypto::AesKeyScheduleCache mAesKeyScheduleCache;
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     Mac::Key mTrelKey;
     Mac::Key mTemporaryTrelKey;
@@ -138,6 +138,18 @@ void LinkQualityInfo::Clear(void)
     mMessageErrorRate.Clear();
 }
 
+void LinkQualityInfo::SetLinkQuality(uint8_t aLinkQuality)
+{
+#if OPENTHREAD_FTD
+    if (aLinkQuality != mLinkQuality)
+    {
+        Get<Mle::MleRouter>().InvalidateFib();
+    }
+#endif
+
+    mLinkQuality = aLinkQuality;
+}
+
 void LinkQualityInfo::AddRss(int8_t aRss)
 {
     uint8_t oldLinkQuality = kNoLinkQuality;
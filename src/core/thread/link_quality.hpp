@@ -456,7 +456,7 @@ private:
         kNoLinkQuality = 0xff, // Used to indicate that there is no previous/last link quality.
     };
 
-    void SetLinkQuality(uint8_t aLinkQuality) { mLinkQuality = aLinkQuality; }
+    void SetLinkQuality(uint8_t aLinkQuality);
 
     /* Static private method to calculate the link quality from a given link margin while taking into account the last
      * link quality value and adding the hysteresis value to the thresholds. If there is no previous value for link
@@ -98,6 +98,12 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
     mFragTag = Random::NonCrypto::GetUint16();
 
     ResetCounters();
+    ResetReassemblyCounters();
+
+    for (ReassemblyEntry &entry : mReassemblyEntries)
+    {
+        entry.Clear();
+    }
 
 #if OPENTHREAD_FTD
     mFragmentPriorityList.Clear();
@@ -133,10 +139,14 @@ void MeshForwarder::Stop(void)
         message->Free();
     }
 
-    while ((message = mReassemblyList.GetHead()) != nullptr)
+    for (ReassemblyEntry &entry : mReassemblyEntries)
     {
-        mReassemblyList.Dequeue(*message);
-        message->Free();
+        if (entry.IsInUse())
+        {
+            mReassemblyList.Dequeue(*entry.GetMessage());
+            entry.GetMessage()->Free();
+            entry.Clear();
+        }
     }
 
 #if OPENTHREAD_FTD
@@ -320,9 +330,13 @@ Message *MeshForwarder::GetDirectTransmission(void)
 #endif
 
         default:
-            mSendQueue.Dequeue(*curMessage);
+            // Only the direct transmission is dropped. The message
+            // may still be queued for sleepy children (and be in
+            // their indirect message index), in which case it is
+            // freed once those transmissions are done.
             LogMessage(kMessageDrop, *curMessage, nullptr, error);
-            curMessage->Free();
+            curMessage->ClearDirectTransmission();
+            RemoveMessageIfNoPendingTx(*curMessage);
             continue;
         }
     }
@@ -1165,6 +1179,7 @@ void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
     Lowpan::FragmentHeader fragmentHeader;
     uint16_t               fragmentHeaderLength;
     Message *              message = nullptr;
+    ReassemblyEntry *      entry   = nullptr;
 
     // Check the fragment header
     SuccessOrExit(error = fragmentHeader.ParseFrom(aFrame, aFrameLength, fragmentHeaderLength));
@@ -1190,11 +1205,10 @@ void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
                     VerifyOrExit(fragmentHeader.GetDatagramOffset() != 0, error = kErrorDuplicated);
 
                     // Duplication suppression for a "next fragment" is handled
-                    // by the code below where the the datagram offset is
-                    // checked against the offset of the corresponding message
-                    // (same datagram tag and size) in Reassembly List. Note
-                    // that if there is no matching message in the Reassembly
-                    // List (e.g., in case the message is already fully
+                    // by the code below where the received offsets of the
+                    // matching reassembly entry (same source, datagram tag and
+                    // size) are checked. Note that if there is no matching
+                    // entry (e.g., in case the message is already fully
                     // assembled) the received "next fragment" frame would be
                     // dropped.
                 }
@@ -1209,16 +1223,38 @@ void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
     if (fragmentHeader.GetDatagramOffset() == 0)
     {
         uint16_t datagramSize = fragmentHeader.GetDatagramSize();
+        uint16_t tag          = fragmentHeader.GetDatagramTag();
+
+        entry = FindReassemblyEntry(aMacSource, tag);
+
+        if (entry != nullptr)
+        {
+            // A repeated first fragment of a datagram which is being
+            // reassembled is a duplicate. If the size differs, the sender
+            // has started over and the fragments received so far are
+            // discarded.
+
+            if (entry->GetMessage()->GetLength() == datagramSize)
+            {
+                mReassemblyCounters.mDuplicateFragments++;
+                entry = nullptr;
+                ExitNow(error = kErrorDuplicated);
+            }
+
+            mReassemblyCounters.mOverlapFragments++;
+            RemoveReassemblyEntry(*entry, kErrorDrop);
+            entry = nullptr;
+        }
 
         error = FrameToMessage(aFrame, aFrameLength, datagramSize, aMacSource, aMacDest, message);
         SuccessOrExit(error);
 
         VerifyOrExit(datagramSize >= message->GetLength(), error = kErrorParse);
+        VerifyOrExit(ReassemblyEntry::IsValidFragmentEnd(message->GetOffset(), datagramSize), error = kErrorParse);
         error = message->SetLength(datagramSize);
         SuccessOrExit(error);
 
-        message->SetDatagramTag(fragmentHeader.GetDatagramTag());
-        message->SetTimeout(kReassemblyTimeout);
+        message->SetDatagramTag(tag);
         message->SetLinkInfo(aLinkInfo);
 
         VerifyOrExit(Get<Ip6::Filter>().Accept(*message), error = kErrorDrop);
@@ -1236,54 +1272,81 @@ void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
             ClearReassemblyList();
         }
 
+        VerifyOrExit(message->GetOffset() < datagramSize);
+
+        entry = AllocateReassemblyEntry();
+        entry->Init(*message, aMacSource, tag);
+        IgnoreError(entry->MarkReceived(0, message->GetOffset()));
+
         mReassemblyList.Enqueue(*message);
 
         Get<TimeTicker>().RegisterReceiver(TimeTicker::kMeshForwarder);
     }
     else // Received frame is a "next fragment".
     {
-        for (message = mReassemblyList.GetHead(); message; message = message->GetNext())
+        entry = FindReassemblyEntry(aMacSource, fragmentHeader.GetDatagramTag());
+
+        // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
+        if ((entry != nullptr) &&
+            ((entry->GetMessage()->GetLength() != fragmentHeader.GetDatagramSize()) ||
+             (entry->GetMessage()->IsLinkSecurityEnabled() != aLinkInfo.IsLinkSecurityEnabled())))
         {
-            // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
-            if (message->GetLength() == fragmentHeader.GetDatagramSize() &&
-                message->GetDatagramTag() == fragmentHeader.GetDatagramTag() &&
-                message->GetOffset() == fragmentHeader.GetDatagramOffset() &&
-                message->GetOffset() + aFrameLength <= fragmentHeader.GetDatagramSize() &&
-                message->IsLinkSecurityEnabled() == aLinkInfo.IsLinkSecurityEnabled())
-            {
-                break;
-            }
+            entry = nullptr;
         }
 
         // For a sleepy-end-device, if we receive a new (secure) next fragment
-        // with a non-matching fragmentation offset or tag, it indicates that
-        // we have either missed a fragment, or the parent has moved to a new
-        // message with a new tag. In either case, we can safely clear any
-        // remaining fragments stored in the reassembly list.
+        // with a non-matching tag, it indicates that the parent has moved to
+        // a new message with a new tag after we missed its first fragment.
+        // We can safely clear any remaining fragments stored in the
+        // reassembly list.
 
-        if (!GetRxOnWhenIdle() && (message == nullptr) && aLinkInfo.IsLinkSecurityEnabled())
+        if (!GetRxOnWhenIdle() && (entry == nullptr) && aLinkInfo.IsLinkSecurityEnabled())
         {
             ClearReassemblyList();
         }
 
-        VerifyOrExit(message != nullptr, error = kErrorDrop);
+        if (entry == nullptr)
+        {
+            mReassemblyCounters.mUnmatchedFragments++;
+            ExitNow(error = kErrorDrop);
+        }
+
+        error = entry->MarkReceived(fragmentHeader.GetDatagramOffset(), aFrameLength);
+
+        if (error == kErrorDuplicated)
+        {
+            mReassemblyCounters.mDuplicateFragments++;
+        }
+        else if (error == kErrorAlready)
+        {
+            mReassemblyCounters.mOverlapFragments++;
+        }
+
+        SuccessOrExit(error);
 
-        message->WriteBytes(message->GetOffset(), aFrame, aFrameLength);
-        message->MoveOffset(aFrameLength);
+        message = entry->GetMessage();
+        message->WriteBytes(fragmentHeader.GetDatagramOffset(), aFrame, aFrameLength);
         message->AddRss(aLinkInfo.GetRss());
 #if OPENTHREAD_CONFIG_MLE_LINK_METRICS_ENABLE
         message->AddLqi(aLinkInfo.GetLqi());
 #endif
-        message->SetTimeout(kReassemblyTimeout);
+        entry->ResetLifetime();
     }
 
 exit:
 
     if (error == kErrorNone)
     {
-        if (message->GetOffset() >= message->GetLength())
+        if ((entry == nullptr) || entry->IsComplete())
         {
-            mReassemblyList.Dequeue(*message);
+            if (entry != nullptr)
+            {
+                mReassemblyList.Dequeue(*message);
+                entry->Clear();
+                mReassemblyCounters.mReassembled++;
+            }
+
+            message->SetOffset(message->GetLength());
             IgnoreError(HandleDatagram(*message, aLinkInfo, aMacSource));
         }
     }
@@ -1295,24 +1358,112 @@ exit:
     }
 }
 
-void MeshForwarder::ClearReassemblyList(void)
+MeshForwarder::ReassemblyEntry *MeshForwarder::FindReassemblyEntry(const Mac::Address &aMacSource, uint16_t aTag)
 {
-    Message *message;
-    Message *next;
+    ReassemblyEntry *rval = nullptr;
 
-    for (message = mReassemblyList.GetHead(); message; message = next)
+    for (ReassemblyEntry &entry : mReassemblyEntries)
     {
-        next = message->GetNext();
-        mReassemblyList.Dequeue(*message);
+        if (entry.Matches(aMacSource, aTag))
+        {
+            rval = &entry;
+            break;
+        }
+    }
+
+    return rval;
+}
 
-        LogMessage(kMessageReassemblyDrop, *message, nullptr, kErrorNoFrameReceived);
+MeshForwarder::ReassemblyEntry *MeshForwarder::AllocateReassemblyEntry(void)
+{
+    ReassemblyEntry *newEntry = nullptr;
 
-        if (message->GetType() == Message::kTypeIp6)
+    for (ReassemblyEntry &entry : mReassemblyEntries)
+    {
+        if (!entry.IsInUse())
         {
-            mIpCounters.mRxFailure++;
+            ExitNow(newEntry = &entry);
         }
 
-        message->Free();
+        if ((newEntry == nullptr) || (entry.GetLifetime() < newEntry->GetLifetime()))
+        {
+            newEntry = &entry;
+        }
+    }
+
+    // All entries are in use, evict the reassembly closest to timing out.
+    mReassemblyCounters.mEvictions++;
+    RemoveReassemblyEntry(*newEntry, kErrorNoBufs);
+
+exit:
+    return newEntry;
+}
+
+void MeshForwarder::RemoveReassemblyEntry(ReassemblyEntry &aEntry, Error aError)
+{
+    Message &message = *aEntry.GetMessage();
+
+    mReassemblyList.Dequeue(message);
+    aEntry.Clear();
+
+    LogMessage(kMessageReassemblyDrop, message, nullptr, aError);
+
+    if (message.GetType() == Message::kTypeIp6)
+    {
+        mIpCounters.mRxFailure++;
+    }
+
+    message.Free();
+}
+
+Error MeshForwarder::EvictReassembly(Message::Priority aPriority)
+{
+    Error            error = kErrorNotFound;
+    ReassemblyEntry *evict = nullptr;
+
+    // Choose the lowest priority reassembly, and among those the one
+    // closest to timing out.
+    for (ReassemblyEntry &entry : mReassemblyEntries)
+    {
+        uint8_t priority;
+
+        if (!entry.IsInUse())
+        {
+            continue;
+        }
+
+        priority = entry.GetMessage()->GetPriority();
+
+        if (priority >= aPriority)
+        {
+            continue;
+        }
+
+        if ((evict == nullptr) || (priority < evict->GetMessage()->GetPriority()) ||
+            ((priority == evict->GetMessage()->GetPriority()) && (entry.GetLifetime() < evict->GetLifetime())))
+        {
+            evict = &entry;
+        }
+    }
+
+    VerifyOrExit(evict != nullptr);
+
+    mReassemblyCounters.mEvictions++;
+    RemoveReassemblyEntry(*evict, kErrorNoBufs);
+    error = kErrorNone;
+
+exit:
+    return error;
+}
+
+void MeshForwarder::ClearReassemblyList(void)
+{
+    for (ReassemblyEntry &entry : mReassemblyEntries)
+    {
+        if (entry.IsInUse())
+        {
+            RemoveReassemblyEntry(entry, kErrorNoFrameReceived);
+        }
     }
 }
 
@@ -1334,31 +1485,97 @@ void MeshForwarder::HandleTimeTick(void)
 
 bool MeshForwarder::UpdateReassemblyList(void)
 {
-    Message *next = nullptr;
+    bool inUse = false;
 
-    for (Message *message = mReassemblyList.GetHead(); message; message = next)
+    for (ReassemblyEntry &entry : mReassemblyEntries)
     {
-        next = message->GetNext();
+        if (!entry.IsInUse())
+        {
+            continue;
+        }
 
-        if (message->GetTimeout() > 0)
+        if (!entry.IsExpired())
         {
-            message->DecrementTimeout();
+            entry.DecrementLifetime();
+            inUse = true;
         }
         else
         {
-            mReassemblyList.Dequeue(*message);
+            mReassemblyCounters.mTimeouts++;
+            RemoveReassemblyEntry(entry, kErrorReassemblyTimeout);
+        }
+    }
 
-            LogMessage(kMessageReassemblyDrop, *message, nullptr, kErrorReassemblyTimeout);
-            if (message->GetType() == Message::kTypeIp6)
-            {
-                mIpCounters.mRxFailure++;
-            }
+    return inUse;
+}
+
+void MeshForwarder::ReassemblyEntry::Init(Message &aMessage, const Mac::Address &aMacSource, uint16_t aTag)
+{
+    Clear();
+    mMessage     = &aMessage;
+    mMacSource   = aMacSource;
+    mDatagramTag = aTag;
+    ResetLifetime();
+}
+
+bool MeshForwarder::ReassemblyEntry::Matches(const Mac::Address &aMacSource, uint16_t aTag) const
+{
+    bool matches = false;
+
+    VerifyOrExit(IsInUse() && (mDatagramTag == aTag) && (mMacSource.GetType() == aMacSource.GetType()));
+
+    switch (mMacSource.GetType())
+    {
+    case Mac::Address::kTypeNone:
+        matches = true;
+        break;
+    case Mac::Address::kTypeShort:
+        matches = (mMacSource.GetShort() == aMacSource.GetShort());
+        break;
+    case Mac::Address::kTypeExtended:
+        matches = (mMacSource.GetExtended() == aMacSource.GetExtended());
+        break;
+    }
+
+exit:
+    return matches;
+}
+
+bool MeshForwarder::ReassemblyEntry::IsValidFragmentEnd(uint16_t aEnd, uint16_t aDatagramSize)
+{
+    // Every fragment but the last one must end on an 8-octet boundary so
+    // that the offset of the following fragment can refer to it.
+    return (aEnd == aDatagramSize) || ((aEnd < aDatagramSize) && (aEnd % kUnitSize == 0));
+}
 
-            message->Free();
+Error MeshForwarder::ReassemblyEntry::MarkReceived(uint16_t aOffset, uint16_t aLength)
+{
+    Error    error       = kErrorNone;
+    uint16_t firstUnit   = aOffset / kUnitSize;
+    uint16_t endUnit     = (aOffset + aLength + kUnitSize - 1) / kUnitSize;
+    uint16_t numReceived = 0;
+
+    VerifyOrExit((aLength > 0) && IsValidFragmentEnd(aOffset + aLength, mMessage->GetLength()), error = kErrorParse);
+
+    for (uint16_t unit = firstUnit; unit < endUnit; unit++)
+    {
+        if (mReceivedUnits[unit / 8] & (1 << (unit % 8)))
+        {
+            numReceived++;
         }
     }
 
-    return mReassemblyList.GetHead() != nullptr;
+    VerifyOrExit(numReceived == 0, error = (numReceived == endUnit - firstUnit) ? kErrorDuplicated : kErrorAlready);
+
+    for (uint16_t unit = firstUnit; unit < endUnit; unit++)
+    {
+        mReceivedUnits[unit / 8] |= (1 << (unit % 8));
+    }
+
+    mReceivedLength += aLength;
+
+exit:
+    return error;
 }
 
 Error MeshForwarder::FrameToMessage(const uint8_t *     aFrame,
@@ -154,6 +154,7 @@ class MeshForwarder : public InstanceLocator, private NonCopyable
     friend class IndirectSender;
     friend class Mle::DiscoverScanner;
     friend class TimeTicker;
+    friend class MeshForwarderTester;
 
 public:
     /**
@@ -256,13 +257,28 @@ public:
     /**
      * This method evicts the message with lowest priority in the send queue.
      *
-     * @param[in]  aPriority  The highest priority level of the evicted message.
+     * A message with a priority lower than @p aPriority is evicted if there is one. Otherwise, unless @p aLowerOnly is
+     * set, an indirect message with a priority equal to or higher than @p aPriority may be evicted.
+     *
+     * @param[in]  aPriority   The highest priority level of the evicted message.
+     * @param[in]  aLowerOnly  TRUE to only evict a message with a priority lower than @p aPriority.
      *
      * @retval kErrorNone       Successfully evicted a low priority message.
      * @retval kErrorNotFound   No low priority messages available to evict.
      *
      */
-    Error EvictMessage(Message::Priority aPriority);
+    Error EvictMessage(Message::Priority aPriority, bool aLowerOnly);
+
+    /**
+     * This method evicts the stalest 6LoWPAN reassembly with a lower priority.
+     *
+     * @param[in]  aPriority  The priority level of the message that needs buffers.
+     *
+     * @retval kErrorNone       Successfully evicted a reassembly with a priority lower than @p aPriority.
+     * @retval kErrorNotFound   No lower priority reassembly available to evict.
+     *
+     */
+    Error EvictReassembly(Message::Priority aPriority);
 
     /**
      * This method returns a reference to the send queue.
@@ -294,6 +310,20 @@ public:
      */
     void ResetCounters(void) { memset(&mIpCounters, 0, sizeof(mIpCounters)); }
 
+    /**
+     * This method returns a reference to the 6LoWPAN reassembly counters.
+     *
+     * @returns A reference to the 6LoWPAN reassembly counters.
+     *
+     */
+    const otReassemblyCounters &GetReassemblyCounters(void) const { return mReassemblyCounters; }
+
+    /**
+     * This method resets the 6LoWPAN reassembly counters.
+     *
+     */
+    void ResetReassemblyCounters(void) { memset(&mReassemblyCounters, 0, sizeof(mReassemblyCounters)); }
+
 #if OPENTHREAD_FTD
     /**
      * This method returns a reference to the resolving queue.
@@ -325,6 +355,7 @@ private:
     enum : uint8_t
     {
         kReassemblyTimeout      = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT, // Reassembly timeout (in seconds).
+        kNumReassemblyEntries   = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES, // Max concurrent reassemblies.
         kMeshHeaderFrameMtu     = OT_RADIO_FRAME_MAX_SIZE, // Max. MTU allowed when generating a Mesh Header frame.
         kMeshHeaderFrameFcsSize = sizeof(uint16_t),        // Frame FCS size for Mesh Header frame.
     };
@@ -346,6 +377,43 @@ private:
         kAnycastService,
     };
 
+    class ReassemblyEntry : public Clearable<ReassemblyEntry>
+    {
+    public:
+        void     Init(Message &aMessage, const Mac::Address &aMacSource, uint16_t aTag);
+        bool     IsInUse(void) const { return (mMessage != nullptr); }
+        Message *GetMessage(void) const { return mMessage; }
+        uint8_t  GetLifetime(void) const { return mLifetime; }
+        bool     IsExpired(void) const { return (mLifetime == 0); }
+        void     DecrementLifetime(void) { mLifetime--; }
+        void     ResetLifetime(void) { mLifetime = kReassemblyTimeout; }
+        bool     IsComplete(void) const { return (mReceivedLength >= mMessage->GetLength()); }
+        bool     Matches(const Mac::Address &aMacSource, uint16_t aTag) const;
+
+        static bool IsValidFragmentEnd(uint16_t aEnd, uint16_t aDatagramSize);
+
+        // Marks `[aOffset, aOffset + aLength)` of the datagram as received. Returns `kErrorDuplicated` if the
+        // whole range was already received, `kErrorAlready` if only part of it was (nothing is marked), and
+        // `kErrorParse` if the range is not a valid fragment of the datagram.
+        Error MarkReceived(uint16_t aOffset, uint16_t aLength);
+
+    private:
+        enum : uint16_t
+        {
+            kUnitSize        = 8,     // Fragment offsets are in units of 8 octets.
+            kMaxDatagramSize = 0x7ff, // Largest 11-bit Datagram Size.
+            kNumUnits        = (kMaxDatagramSize + kUnitSize - 1) / kUnitSize,
+            kBitmapSize      = (kNumUnits + 7) / 8,
+        };
+
+        Message *    mMessage;
+        Mac::Address mMacSource;
+        uint16_t     mDatagramTag;
+        uint16_t     mReceivedLength;
+        uint8_t      mLifetime;
+        uint8_t      mReceivedUnits[kBitmapSize]; // One bit per 8-octet unit of the datagram.
+    };
+
 #if OPENTHREAD_FTD
     class FragmentPriorityList : public Clearable<FragmentPriorityList>
     {
@@ -460,6 +528,10 @@ private:
     void  RemoveMessage(Message &aMessage);
     void  HandleDiscoverComplete(void);
 
+    ReassemblyEntry *FindReassemblyEntry(const Mac::Address &aMacSource, uint16_t aTag);
+    ReassemblyEntry *AllocateReassemblyEntry(void);
+    void             RemoveReassemblyEntry(ReassemblyEntry &aEntry, Error aError);
+
     void          HandleReceivedFrame(Mac::RxFrame &aFrame);
     Mac::TxFrame *HandleFrameRequest(Mac::TxFrames &aTxFrames);
     Neighbor *    UpdateNeighborOnSentFrame(Mac::TxFrame &aFrame, Error aError, const Mac::Address &aMacDest);
@@ -577,6 +649,9 @@ private:
 
     otIpCounters mIpCounters;
 
+    ReassemblyEntry      mReassemblyEntries[kNumReassemblyEntries];
+    otReassemblyCounters mReassemblyCounters;
+
 #if OPENTHREAD_FTD
     FragmentPriorityList mFragmentPriorityList;
     PriorityQueue        mResolvingQueue;
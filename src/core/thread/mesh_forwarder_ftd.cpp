@@ -175,7 +175,7 @@ void MeshForwarder::HandleResolved(const Ip6::Address &aEid, Error aError)
     }
 }
 
-Error MeshForwarder::EvictMessage(Message::Priority aPriority)
+Error MeshForwarder::EvictMessage(Message::Priority aPriority, bool aLowerOnly)
 {
     Error          error    = kErrorNotFound;
     PriorityQueue *queues[] = {&mResolvingQueue, &mSendQueue};
@@ -211,6 +211,8 @@ Error MeshForwarder::EvictMessage(Message::Priority aPriority)
         ExitNow(error = kErrorNone);
     }
 
+    VerifyOrExit(!aLowerOnly);
+
     for (uint8_t priority = aPriority; priority < Message::kNumPriorities; priority++)
     {
         // search for an equal or higher priority indirect message to evict
@@ -300,23 +302,24 @@ void MeshForwarder::RemoveMessages(Child &aChild, Message::SubType aSubType)
 
 void MeshForwarder::RemoveDataResponseMessages(void)
 {
-    Ip6::Header ip6Header;
+    Message *nextMessage;
 
-    for (Message *message = mSendQueue.GetHead(); message; message = message->GetNext())
+    for (Message *message = mSendQueue.GetHead(); message; message = nextMessage)
     {
+        nextMessage = message->GetNext();
+
         if (message->GetSubType() != Message::kSubTypeMleDataResponse)
         {
             continue;
         }
 
-        IgnoreError(message->Read(0, ip6Header));
+        // Multicast Data Responses may also be queued for sleepy
+        // children, so the message is removed from all children
+        // (and their indirect message index) before it is freed.
 
-        if (!(ip6Header.GetDestination().IsMulticast()))
+        for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
         {
-            for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
-            {
-                IgnoreError(mIndirectSender.RemoveMessageFromSleepyChild(*message, child));
-            }
+            IgnoreError(mIndirectSender.RemoveMessageFromSleepyChild(*message, child));
         }
 
         if (mSendMessage == message)
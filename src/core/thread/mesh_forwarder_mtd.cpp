@@ -49,11 +49,13 @@ Error MeshForwarder::SendMessage(Message &aMessage)
     return kErrorNone;
 }
 
-Error MeshForwarder::EvictMessage(Message::Priority aPriority)
+Error MeshForwarder::EvictMessage(Message::Priority aPriority, bool aLowerOnly)
 {
     Error    error = kErrorNotFound;
     Message *message;
 
+    OT_UNUSED_VARIABLE(aLowerOnly);
+
     VerifyOrExit((message = mSendQueue.GetTail()) != nullptr);
 
     if (message->GetPriority() < static_cast<uint8_t>(aPriority))
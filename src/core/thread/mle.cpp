@@ -352,6 +352,7 @@ Error Mle::Restore(void)
 
     Get<Mac::Mac>().SetShortAddress(networkInfo.GetRloc16());
     Get<Mac::Mac>().SetExtAddress(networkInfo.GetExtAddress());
+    Get<MleRouter>().InvalidateFib();
 
     mMeshLocal64.GetAddress().SetIid(networkInfo.GetMeshLocalIid());
 
@@ -909,6 +910,7 @@ void Mle::SetRloc16(uint16_t aRloc16)
 
     Get<Mac::Mac>().SetShortAddress(aRloc16);
     Get<Ip6::Mpl>().SetSeedId(aRloc16);
+    Get<MleRouter>().InvalidateFib();
 
     if (aRloc16 != Mac::kShortAddrInvalid)
     {
@@ -2557,7 +2559,7 @@ Error Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
         Crypto::AesCcm::GenerateNonce(Get<Mac::Mac>().GetExtAddress(), Get<KeyManager>().GetMleFrameCounter(),
                                       Mac::Frame::kSecEncMic32, nonce);
 
-        aesCcm.SetKey(Get<KeyManager>().GetCurrentMleKey());
+        aesCcm.SetKey(Get<KeyManager>().GetCurrentMleKey(), &Get<KeyManager>().GetAesKeyScheduleCache());
         aesCcm.Init(16 + 16 + header.GetHeaderLength(), aMessage.GetLength() - (header.GetLength() - 1), sizeof(tag),
                     nonce, sizeof(nonce));
 
@@ -2690,7 +2692,7 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
     frameCounter = header.GetFrameCounter();
     Crypto::AesCcm::GenerateNonce(extAddr, frameCounter, Mac::Frame::kSecEncMic32, nonce);
 
-    aesCcm.SetKey(*mleKey);
+    aesCcm.SetKey(*mleKey, &Get<KeyManager>().GetAesKeyScheduleCache());
     aesCcm.Init(sizeof(aMessageInfo.GetPeerAddr()) + sizeof(aMessageInfo.GetSockAddr()) + header.GetHeaderLength(),
                 aMessage.GetLength() - aMessage.GetOffset(), sizeof(messageTag), nonce, sizeof(nonce));
 
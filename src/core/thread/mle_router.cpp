@@ -59,6 +59,7 @@ MleRouter::MleRouter(Instance &aInstance)
     , mAdvertiseTrickleTimer(aInstance, MleRouter::HandleAdvertiseTrickleTimer)
     , mAddressSolicit(UriPath::kAddressSolicit, &MleRouter::HandleAddressSolicit, this)
     , mAddressRelease(UriPath::kAddressRelease, &MleRouter::HandleAddressRelease, this)
+    , mFibValid(false)
     , mChildTable(aInstance)
     , mRouterTable(aInstance)
     , mChallengeTimeout(0)
@@ -92,6 +93,7 @@ MleRouter::MleRouter(Instance &aInstance)
     mDeviceMode.Set(mDeviceMode.Get() | DeviceMode::kModeFullThreadDevice | DeviceMode::kModeFullNetworkData);
 
     SetRouterId(kInvalidRouterId);
+    ResetFibCounters();
 
 #if OPENTHREAD_CONFIG_MLE_STEERING_DATA_SET_OOB_ENABLE
     mSteeringData.Clear();
@@ -1791,7 +1793,7 @@ void MleRouter::HandleTimeTick(void)
         {
             otLogInfoMle("Child CSL synchronization expired");
             child.SetCslSynchronized(false);
-            Get<CslTxScheduler>().Update();
+            Get<CslTxScheduler>().Update(child);
         }
 #endif
 
@@ -3366,12 +3368,8 @@ exit:
 
 uint16_t MleRouter::GetNextHop(uint16_t aDestination)
 {
-    uint8_t       destinationId = RouterIdFromRloc16(aDestination);
-    uint8_t       routeCost;
-    uint8_t       linkCost;
-    uint16_t      rval = Mac::kShortAddrInvalid;
-    const Router *router;
-    const Router *nextHop;
+    uint8_t  destinationId = RouterIdFromRloc16(aDestination);
+    uint16_t rval          = Mac::kShortAddrInvalid;
 
     if (IsChild())
     {
@@ -3384,24 +3382,16 @@ uint16_t MleRouter::GetNextHop(uint16_t aDestination)
         ExitNow(rval = aDestination);
     }
 
-    router = mRouterTable.GetRouter(destinationId);
-    VerifyOrExit(router != nullptr);
-
-    linkCost  = GetLinkCost(destinationId);
-    routeCost = GetRouteCost(aDestination);
+    VerifyOrExit(destinationId <= kMaxRouterId);
 
-    if ((routeCost + GetLinkCost(router->GetNextHop())) < linkCost)
-    {
-        nextHop = mRouterTable.GetRouter(router->GetNextHop());
-        VerifyOrExit(nextHop != nullptr && !nextHop->IsStateInvalid());
-
-        rval = Rloc16FromRouterId(router->GetNextHop());
-    }
-    else if (linkCost < kMaxRouteCost)
+    if (!mFibValid)
     {
-        rval = Rloc16FromRouterId(destinationId);
+        UpdateFib();
     }
 
+    mFibCounters.mLookups++;
+    rval = mFib[destinationId].mNextHop;
+
 exit:
     return rval;
 }
@@ -3409,23 +3399,89 @@ exit:
 uint8_t MleRouter::GetCost(uint16_t aRloc16)
 {
     uint8_t routerId = RouterIdFromRloc16(aRloc16);
-    uint8_t cost     = GetLinkCost(routerId);
-    Router *router   = mRouterTable.GetRouter(routerId);
-    uint8_t routeCost;
-
-    VerifyOrExit(router != nullptr && mRouterTable.GetRouter(router->GetNextHop()) != nullptr);
+    uint8_t cost     = kMaxRouteCost;
 
-    routeCost = GetRouteCost(aRloc16) + GetLinkCost(router->GetNextHop());
+    VerifyOrExit(routerId <= kMaxRouterId);
 
-    if (cost > routeCost)
+    if (!mFibValid)
     {
-        cost = routeCost;
+        UpdateFib();
     }
 
+    mFibCounters.mLookups++;
+    cost = mFib[routerId].mCost;
+
 exit:
     return cost;
 }
 
+void MleRouter::UpdateFib(void)
+{
+    // The router entries and link costs are gathered in a single pass over the router table so that the rebuild
+    // does not search the table for each router and its next hop.
+
+    Router *routers[kMaxRouterId + 1];
+    uint8_t linkCosts[kMaxRouterId + 1];
+
+    for (uint8_t routerId = 0; routerId <= kMaxRouterId; routerId++)
+    {
+        routers[routerId]   = nullptr;
+        linkCosts[routerId] = kMaxRouteCost;
+    }
+
+    for (Router &router : mRouterTable.Iterate())
+    {
+        uint8_t routerId = router.GetRouterId();
+
+        routers[routerId]   = &router;
+        linkCosts[routerId] = mRouterTable.GetLinkCost(router);
+    }
+
+    for (uint8_t routerId = 0; routerId <= kMaxRouterId; routerId++)
+    {
+        FibEntry &    entry  = mFib[routerId];
+        const Router *router = routers[routerId];
+        uint8_t       nextId;
+        uint8_t       routeCost;
+
+        entry.mNextHop = Mac::kShortAddrInvalid;
+        entry.mCost    = linkCosts[routerId];
+
+        if (router == nullptr)
+        {
+            continue;
+        }
+
+        nextId = router->GetNextHop();
+
+        // Prefer forwarding via the next hop only when strictly cheaper than the direct link.
+        if (nextId <= kMaxRouterId && routers[nextId] != nullptr)
+        {
+            routeCost = router->GetCost() + linkCosts[nextId];
+
+            if (routeCost < linkCosts[routerId])
+            {
+                entry.mCost = routeCost;
+
+                if (!routers[nextId]->IsStateInvalid())
+                {
+                    entry.mNextHop = Rloc16FromRouterId(nextId);
+                }
+
+                continue;
+            }
+        }
+
+        if (linkCosts[routerId] < kMaxRouteCost)
+        {
+            entry.mNextHop = Rloc16FromRouterId(routerId);
+        }
+    }
+
+    mFibValid = true;
+    mFibCounters.mRebuilds++;
+}
+
 uint8_t MleRouter::GetRouteCost(uint16_t aRloc16) const
 {
     uint8_t       rval = kMaxRouteCost;
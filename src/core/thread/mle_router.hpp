@@ -79,6 +79,12 @@ class MleRouter : public Mle
     friend class ot::TimeTicker;
 
 public:
+    /**
+     * This type represents the forwarding information base counters.
+     *
+     */
+    typedef otRouterFibCounters FibCounters;
+
     /**
      * This constructor initializes the object.
      *
@@ -268,6 +274,29 @@ public:
      */
     uint8_t GetCost(uint16_t aRloc16);
 
+    /**
+     * This method marks the forwarding information base as stale.
+     *
+     * The next hop and cost of every router are recomputed on the next call to `GetNextHop()` or `GetCost()`. This
+     * method must be called whenever a router entry, its link quality, or the device RLOC16 changes.
+     *
+     */
+    void InvalidateFib(void) { mFibValid = false; }
+
+    /**
+     * This method returns the forwarding information base counters.
+     *
+     * @returns The forwarding information base counters.
+     *
+     */
+    const FibCounters &GetFibCounters(void) const { return mFibCounters; }
+
+    /**
+     * This method resets the forwarding information base counters.
+     *
+     */
+    void ResetFibCounters(void) { memset(&mFibCounters, 0, sizeof(mFibCounters)); }
+
     /**
      * This method returns the ROUTER_SELECTION_JITTER value.
      *
@@ -631,6 +660,7 @@ private:
     Error UpdateChildAddresses(const Message &aMessage, uint16_t aOffset, Child &aChild);
     void  UpdateRoutes(const RouteTlv &aRoute, uint8_t aRouterId);
     bool  UpdateLinkQualityOut(const RouteTlv &aRoute, Router &aNeighbor, bool &aResetAdvInterval);
+    void  UpdateFib(void);
 
     static void HandleAddressSolicitResponse(void *               aContext,
                                              otMessage *          aMessage,
@@ -662,6 +692,16 @@ private:
     Coap::Resource mAddressSolicit;
     Coap::Resource mAddressRelease;
 
+    struct FibEntry
+    {
+        uint16_t mNextHop; ///< The RLOC16 of the next hop, or `Mac::kShortAddrInvalid` if unreachable.
+        uint8_t  mCost;    ///< The minimum cost via a direct link or forwarding.
+    };
+
+    FibEntry    mFib[kMaxRouterId + 1];
+    FibCounters mFibCounters;
+    bool        mFibValid;
+
     ChildTable  mChildTable;
     RouterTable mRouterTable;
 
@@ -728,6 +768,8 @@ public:
 
     uint8_t GetCost(uint16_t) { return 0; }
 
+    void InvalidateFib(void) {}
+
     Error RemoveNeighbor(Neighbor &) { return BecomeDetached(); }
     void  RemoveRouterLink(Router &) { IgnoreError(BecomeDetached()); }
 
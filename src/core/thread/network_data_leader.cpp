@@ -64,6 +64,7 @@ void LeaderBase::Reset(void)
     mVersion       = Random::NonCrypto::GetUint8();
     mStableVersion = Random::NonCrypto::GetUint8();
     mLength        = 0;
+    InvalidateLookupCache();
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
 
@@ -112,8 +113,9 @@ exit:
 
 Error LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext) const
 {
-    const PrefixTlv * prefix = nullptr;
-    const ContextTlv *contextTlv;
+    const LookupCache *cache  = GetLookupCache();
+    const PrefixTlv *  prefix = nullptr;
+    const ContextTlv * contextTlv;
 
     aContext.mPrefix.SetLength(0);
 
@@ -124,6 +126,22 @@ Error LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aCon
         aContext.mCompressFlag = true;
     }
 
+    if (cache != nullptr)
+    {
+        for (const LookupCache::Prefix *entry = cache->GetPrefixesStart(); entry < cache->GetPrefixesEnd(); entry++)
+        {
+            if (entry->mHasContext && (entry->mPrefix.GetLength() > aContext.mPrefix.GetLength()) &&
+                aAddress.MatchesPrefix(entry->mPrefix))
+            {
+                aContext.mPrefix       = entry->mPrefix;
+                aContext.mContextId    = entry->mContextId;
+                aContext.mCompressFlag = entry->mCompress;
+            }
+        }
+
+        ExitNow();
+    }
+
     while ((prefix = FindNextMatchingPrefix(aAddress, prefix)) != nullptr)
     {
         contextTlv = FindContext(*prefix);
@@ -141,13 +159,15 @@ Error LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aCon
         }
     }
 
+exit:
     return (aContext.mPrefix.GetLength() > 0) ? kErrorNone : kErrorNotFound;
 }
 
 Error LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext) const
 {
-    Error            error = kErrorNotFound;
-    const PrefixTlv *prefix;
+    Error              error = kErrorNotFound;
+    const LookupCache *cache;
+    const PrefixTlv *  prefix;
 
     if (aContextId == Mle::kMeshLocalPrefixContextId)
     {
@@ -157,6 +177,20 @@ Error LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext) cons
         ExitNow(error = kErrorNone);
     }
 
+    cache = GetLookupCache();
+
+    if (cache != nullptr)
+    {
+        const LookupCache::Prefix *entry = cache->GetContextPrefix(aContextId);
+
+        VerifyOrExit(entry != nullptr);
+
+        aContext.mPrefix       = entry->mPrefix;
+        aContext.mContextId    = entry->mContextId;
+        aContext.mCompressFlag = entry->mCompress;
+        ExitNow(error = kErrorNone);
+    }
+
     for (const NetworkDataTlv *start = GetTlvsStart(); (prefix = FindTlv<PrefixTlv>(start, GetTlvsEnd())) != nullptr;
          start                       = prefix->GetNext())
     {
@@ -179,11 +213,27 @@ exit:
 
 bool LeaderBase::IsOnMesh(const Ip6::Address &aAddress) const
 {
-    const PrefixTlv *prefix = nullptr;
-    bool             rval   = false;
+    const LookupCache *cache;
+    const PrefixTlv *  prefix = nullptr;
+    bool               rval   = false;
 
     VerifyOrExit(!Get<Mle::MleRouter>().IsMeshLocalAddress(aAddress), rval = true);
 
+    cache = GetLookupCache();
+
+    if (cache != nullptr)
+    {
+        for (const LookupCache::Prefix *entry = cache->GetPrefixesStart(); entry < cache->GetPrefixesEnd(); entry++)
+        {
+            if (entry->mOnMesh && aAddress.MatchesPrefix(entry->mPrefix))
+            {
+                ExitNow(rval = true);
+            }
+        }
+
+        ExitNow();
+    }
+
     while ((prefix = FindNextMatchingPrefix(aAddress, prefix)) != nullptr)
     {
         // check both stable and temporary Border Router TLVs
@@ -216,8 +266,38 @@ Error LeaderBase::RouteLookup(const Ip6::Address &aSource,
                               uint8_t *           aPrefixMatchLength,
                               uint16_t *          aRloc16) const
 {
-    Error            error  = kErrorNoRoute;
-    const PrefixTlv *prefix = nullptr;
+    Error              error  = kErrorNoRoute;
+    const LookupCache *cache  = GetLookupCache();
+    const PrefixTlv *  prefix = nullptr;
+
+    if (cache != nullptr)
+    {
+        for (const LookupCache::Prefix *entry = cache->GetPrefixesStart(); entry < cache->GetPrefixesEnd(); entry++)
+        {
+            if (!aSource.MatchesPrefix(entry->mPrefix))
+            {
+                continue;
+            }
+
+            if (ExternalRouteLookup(*cache, entry->mDomainId, aDestination, aPrefixMatchLength, aRloc16) ==
+                kErrorNone)
+            {
+                ExitNow(error = kErrorNone);
+            }
+
+            if (DefaultRouteLookup(*cache, *entry, aRloc16) == kErrorNone)
+            {
+                if (aPrefixMatchLength)
+                {
+                    *aPrefixMatchLength = 0;
+                }
+
+                ExitNow(error = kErrorNone);
+            }
+        }
+
+        ExitNow();
+    }
 
     while ((prefix = FindNextMatchingPrefix(aSource, prefix)) != nullptr)
     {
@@ -241,6 +321,23 @@ exit:
     return error;
 }
 
+bool LeaderBase::IsRoutePreferred(int8_t   aPreference,
+                                  uint16_t aRloc16,
+                                  int8_t   aOtherPreference,
+                                  uint16_t aOtherRloc16) const
+{
+    // Returns whether a route entry is preferred over another one,
+    // based on preference, then on whether the route is through
+    // this device, and finally on the path cost.
+
+    uint16_t rloc16 = Get<Mle::MleRouter>().GetRloc16();
+
+    return (aPreference > aOtherPreference) ||
+           ((aPreference == aOtherPreference) &&
+            ((aRloc16 == rloc16) || ((aOtherRloc16 != rloc16) && (Get<Mle::MleRouter>().GetCost(aRloc16) <
+                                                                  Get<Mle::MleRouter>().GetCost(aOtherRloc16)))));
+}
+
 Error LeaderBase::ExternalRouteLookup(uint8_t             aDomainId,
                                       const Ip6::Address &aDestination,
                                       uint8_t *           aPrefixMatchLength,
@@ -279,12 +376,9 @@ Error LeaderBase::ExternalRouteLookup(uint8_t             aDomainId,
             for (const HasRouteEntry *entry = hasRoute->GetFirstEntry(); entry <= hasRoute->GetLastEntry();
                  entry                      = entry->GetNext())
             {
-                if (bestRouteEntry == nullptr || entry->GetPreference() > bestRouteEntry->GetPreference() ||
-                    (entry->GetPreference() == bestRouteEntry->GetPreference() &&
-                     (entry->GetRloc() == Get<Mle::MleRouter>().GetRloc16() ||
-                      (bestRouteEntry->GetRloc() != Get<Mle::MleRouter>().GetRloc16() &&
-                       Get<Mle::MleRouter>().GetCost(entry->GetRloc()) <
-                           Get<Mle::MleRouter>().GetCost(bestRouteEntry->GetRloc())))))
+                if (bestRouteEntry == nullptr ||
+                    IsRoutePreferred(entry->GetPreference(), entry->GetRloc(), bestRouteEntry->GetPreference(),
+                                     bestRouteEntry->GetRloc()))
                 {
                     bestRouteEntry  = entry;
                     bestMatchLength = prefixLength;
@@ -311,6 +405,58 @@ Error LeaderBase::ExternalRouteLookup(uint8_t             aDomainId,
     return error;
 }
 
+Error LeaderBase::ExternalRouteLookup(const LookupCache & aCache,
+                                      uint8_t             aDomainId,
+                                      const Ip6::Address &aDestination,
+                                      uint8_t *           aPrefixMatchLength,
+                                      uint16_t *          aRloc16) const
+{
+    // Same as the TLV based `ExternalRouteLookup()`, using the
+    // lookup cache.
+
+    Error                     error           = kErrorNoRoute;
+    const LookupCache::Route *bestRoute       = nullptr;
+    uint8_t                   bestMatchLength = 0;
+
+    for (const LookupCache::Prefix *entry = aCache.GetPrefixesStart(); entry < aCache.GetPrefixesEnd(); entry++)
+    {
+        const LookupCache::Route *routes = entry->GetRoutes(aCache);
+
+        if ((entry->mNumRoutes == 0) || (entry->mDomainId != aDomainId) ||
+            (entry->mPrefix.GetLength() <= bestMatchLength) || !aDestination.MatchesPrefix(entry->mPrefix))
+        {
+            continue;
+        }
+
+        for (uint8_t i = 0; i < entry->mNumRoutes; i++)
+        {
+            if (bestRoute == nullptr || IsRoutePreferred(routes[i].mPreference, routes[i].mRloc16,
+                                                         bestRoute->mPreference, bestRoute->mRloc16))
+            {
+                bestRoute       = &routes[i];
+                bestMatchLength = entry->mPrefix.GetLength();
+            }
+        }
+    }
+
+    if (bestRoute != nullptr)
+    {
+        if (aRloc16 != nullptr)
+        {
+            *aRloc16 = bestRoute->mRloc16;
+        }
+
+        if (aPrefixMatchLength != nullptr)
+        {
+            *aPrefixMatchLength = bestMatchLength;
+        }
+
+        error = kErrorNone;
+    }
+
+    return error;
+}
+
 Error LeaderBase::DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t *aRloc16) const
 {
     Error                    error = kErrorNoRoute;
@@ -329,11 +475,8 @@ Error LeaderBase::DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t *aRloc16
                 continue;
             }
 
-            if (route == nullptr || entry->GetPreference() > route->GetPreference() ||
-                (entry->GetPreference() == route->GetPreference() &&
-                 (entry->GetRloc() == Get<Mle::MleRouter>().GetRloc16() ||
-                  (route->GetRloc() != Get<Mle::MleRouter>().GetRloc16() &&
-                   Get<Mle::MleRouter>().GetCost(entry->GetRloc()) < Get<Mle::MleRouter>().GetCost(route->GetRloc())))))
+            if (route == nullptr ||
+                IsRoutePreferred(entry->GetPreference(), entry->GetRloc(), route->GetPreference(), route->GetRloc()))
             {
                 route = entry;
             }
@@ -353,6 +496,189 @@ Error LeaderBase::DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t *aRloc16
     return error;
 }
 
+Error LeaderBase::DefaultRouteLookup(const LookupCache &        aCache,
+                                     const LookupCache::Prefix &aPrefix,
+                                     uint16_t *                 aRloc16) const
+{
+    Error                     error  = kErrorNoRoute;
+    const LookupCache::Route *routes = aPrefix.GetDefaultRoutes(aCache);
+    const LookupCache::Route *route  = nullptr;
+
+    for (uint8_t i = 0; i < aPrefix.mNumDefaultRoutes; i++)
+    {
+        if (route == nullptr ||
+            IsRoutePreferred(routes[i].mPreference, routes[i].mRloc16, route->mPreference, route->mRloc16))
+        {
+            route = &routes[i];
+        }
+    }
+
+    if (route != nullptr)
+    {
+        if (aRloc16 != nullptr)
+        {
+            *aRloc16 = route->mRloc16;
+        }
+
+        error = kErrorNone;
+    }
+
+    return error;
+}
+
+void LeaderBase::InvalidateLookupCache(void)
+{
+    mLookupCache.Invalidate();
+}
+
+const LeaderBase::LookupCache *LeaderBase::GetLookupCache(void) const
+{
+    // The lookup cache is derived from the Network Data, so it is
+    // (re)built lazily from a `const` lookup whenever the Network
+    // Data version changed since it was last built.
+
+    LookupCache &cache = const_cast<LookupCache &>(mLookupCache);
+
+    if (!cache.IsUpToDate(mVersion, mStableVersion))
+    {
+        cache.Build(*this);
+    }
+
+    return cache.IsUsable() ? &cache : nullptr;
+}
+
+void LeaderBase::LookupCache::Build(const LeaderBase &aLeader)
+{
+    const PrefixTlv *prefix;
+
+    mState         = kStateValid;
+    mVersion       = aLeader.mVersion;
+    mStableVersion = aLeader.mStableVersion;
+    mNumPrefixes   = 0;
+    mNumRoutes     = 0;
+    memset(mContextIndex, kInvalidIndex, sizeof(mContextIndex));
+
+    for (const NetworkDataTlv *start = aLeader.GetTlvsStart();
+         (prefix = FindTlv<PrefixTlv>(start, aLeader.GetTlvsEnd())) != nullptr; start = prefix->GetNext())
+    {
+        if (AddPrefix(*prefix) != kErrorNone)
+        {
+            otLogInfoNetData("Network Data does not fit in lookup cache");
+            mState = kStateOverflow;
+            break;
+        }
+    }
+}
+
+Error LeaderBase::LookupCache::AddPrefix(const PrefixTlv &aPrefixTlv)
+{
+    Error                  error = kErrorNone;
+    Prefix &               entry = mPrefixes[mNumPrefixes];
+    const ContextTlv *     contextTlv;
+    const HasRouteTlv *    hasRoute;
+    const BorderRouterTlv *borderRouter;
+
+    VerifyOrExit(mNumPrefixes < kMaxPrefixes, error = kErrorNoBufs);
+
+    entry.mPrefix.Set(aPrefixTlv.GetPrefix(), aPrefixTlv.GetPrefixLength());
+    entry.mDomainId   = aPrefixTlv.GetDomainId();
+    entry.mHasContext = false;
+    entry.mCompress   = false;
+    entry.mOnMesh     = false;
+
+    contextTlv = FindContext(aPrefixTlv);
+
+    if (contextTlv != nullptr)
+    {
+        entry.mHasContext = true;
+        entry.mContextId  = contextTlv->GetContextId();
+        entry.mCompress   = contextTlv->IsCompress();
+
+        if (mContextIndex[entry.mContextId] == kInvalidIndex)
+        {
+            mContextIndex[entry.mContextId] = mNumPrefixes;
+        }
+    }
+
+    // On-mesh is determined from the first stable and the first
+    // temporary Border Router TLVs (same as `IsOnMesh()`).
+
+    for (int i = 0; i < 2; i++)
+    {
+        borderRouter = FindBorderRouter(aPrefixTlv, /* aStable */ (i == 0));
+
+        if (borderRouter == nullptr)
+        {
+            continue;
+        }
+
+        for (const BorderRouterEntry *brEntry = borderRouter->GetFirstEntry(); brEntry <= borderRouter->GetLastEntry();
+             brEntry                          = brEntry->GetNext())
+        {
+            if (brEntry->IsOnMesh())
+            {
+                entry.mOnMesh = true;
+            }
+        }
+    }
+
+    entry.mRoutesStart = mNumRoutes;
+
+    for (const NetworkDataTlv *start = aPrefixTlv.GetSubTlvs();
+         (hasRoute = FindTlv<HasRouteTlv>(start, aPrefixTlv.GetNext())) != nullptr; start = hasRoute->GetNext())
+    {
+        for (const HasRouteEntry *routeEntry = hasRoute->GetFirstEntry(); routeEntry <= hasRoute->GetLastEntry();
+             routeEntry                      = routeEntry->GetNext())
+        {
+            SuccessOrExit(error = AddRoute(routeEntry->GetRloc(), routeEntry->GetPreference()));
+        }
+    }
+
+    entry.mNumRoutes          = mNumRoutes - entry.mRoutesStart;
+    entry.mDefaultRoutesStart = mNumRoutes;
+
+    for (const NetworkDataTlv *start = aPrefixTlv.GetSubTlvs();
+         (borderRouter = FindTlv<BorderRouterTlv>(start, aPrefixTlv.GetNext())) != nullptr;
+         start = borderRouter->GetNext())
+    {
+        for (const BorderRouterEntry *brEntry = borderRouter->GetFirstEntry(); brEntry <= borderRouter->GetLastEntry();
+             brEntry                          = brEntry->GetNext())
+        {
+            if (brEntry->IsDefaultRoute())
+            {
+                SuccessOrExit(error = AddRoute(brEntry->GetRloc(), brEntry->GetPreference()));
+            }
+        }
+    }
+
+    entry.mNumDefaultRoutes = mNumRoutes - entry.mDefaultRoutesStart;
+    mNumPrefixes++;
+
+exit:
+    return error;
+}
+
+Error LeaderBase::LookupCache::AddRoute(uint16_t aRloc16, int8_t aPreference)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(mNumRoutes < kMaxRoutes, error = kErrorNoBufs);
+
+    mRoutes[mNumRoutes].mRloc16     = aRloc16;
+    mRoutes[mNumRoutes].mPreference = aPreference;
+    mNumRoutes++;
+
+exit:
+    return error;
+}
+
+const LeaderBase::LookupCache::Prefix *LeaderBase::LookupCache::GetContextPrefix(uint8_t aContextId) const
+{
+    return ((aContextId < kNumContexts) && (mContextIndex[aContextId] != kInvalidIndex))
+               ? &mPrefixes[mContextIndex[aContextId]]
+               : nullptr;
+}
+
 Error LeaderBase::SetNetworkData(uint8_t        aVersion,
                                  uint8_t        aStableVersion,
                                  bool           aStableOnly,
@@ -371,6 +697,7 @@ Error LeaderBase::SetNetworkData(uint8_t        aVersion,
     mLength        = tlv.GetLength();
     mVersion       = aVersion;
     mStableVersion = aStableVersion;
+    InvalidateLookupCache();
 
     if (aStableOnly)
     {
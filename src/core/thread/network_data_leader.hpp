@@ -274,22 +274,122 @@ public:
                        uint8_t &      aServiceId) const;
 
 protected:
+    /**
+     * This method invalidates the lookup cache used by context and route lookups.
+     *
+     * This method MUST be called whenever the Network Data TLVs are changed. The cache is also rebuilt on a Network
+     * Data version change, but not every change of the TLVs is followed by one (e.g., a registration failing after
+     * some of the entries were already removed).
+     *
+     */
+    void InvalidateLookupCache(void);
+
     uint8_t mStableVersion;
     uint8_t mVersion;
 
 private:
+    friend class LeaderTester;
+
     using FilterIndexes = MeshCoP::SteeringData::HashBitIndexes;
 
+    /**
+     * This class holds the Prefix TLV information used by context and route lookups, compiled from the Network Data
+     * TLVs so that per-packet lookups do not need to parse them.
+     *
+     */
+    class LookupCache
+    {
+    public:
+        struct Route
+        {
+            uint16_t mRloc16;
+            int8_t   mPreference;
+        };
+
+        struct Prefix
+        {
+            const Route *GetRoutes(const LookupCache &aCache) const { return &aCache.mRoutes[mRoutesStart]; }
+            const Route *GetDefaultRoutes(const LookupCache &aCache) const
+            {
+                return &aCache.mRoutes[mDefaultRoutesStart];
+            }
+
+            Ip6::Prefix mPrefix;
+            uint8_t     mDomainId;
+            uint8_t     mContextId;
+            bool        mHasContext : 1;
+            bool        mCompress : 1;
+            bool        mOnMesh : 1;
+            uint8_t     mRoutesStart;        // External routes (Has Route entries), index into `mRoutes`.
+            uint8_t     mNumRoutes;          //
+            uint8_t     mDefaultRoutesStart; // Border Router entries with default route flag, index into `mRoutes`.
+            uint8_t     mNumDefaultRoutes;   //
+        };
+
+        LookupCache(void) { Invalidate(); }
+
+        void Invalidate(void) { mState = kStateInvalid; }
+        bool IsUpToDate(uint8_t aVersion, uint8_t aStableVersion) const
+        {
+            return (mState != kStateInvalid) && (mVersion == aVersion) && (mStableVersion == aStableVersion);
+        }
+        bool IsUsable(void) const { return mState == kStateValid; }
+        void Build(const LeaderBase &aLeader);
+
+        const Prefix *GetPrefixesStart(void) const { return &mPrefixes[0]; }
+        const Prefix *GetPrefixesEnd(void) const { return &mPrefixes[mNumPrefixes]; }
+        const Prefix *GetContextPrefix(uint8_t aContextId) const;
+
+    private:
+        enum : uint8_t
+        {
+            kMaxPrefixes  = OPENTHREAD_CONFIG_NETDATA_LOOKUP_CACHE_MAX_PREFIXES,
+            kMaxRoutes    = OPENTHREAD_CONFIG_NETDATA_LOOKUP_CACHE_MAX_ROUTES,
+            kNumContexts  = 16,
+            kInvalidIndex = 0xff,
+        };
+
+        enum State : uint8_t
+        {
+            kStateInvalid,  // Needs to be rebuilt.
+            kStateValid,    // Matches the Network Data.
+            kStateOverflow, // Network Data did not fit, lookups parse the TLVs.
+        };
+
+        Error AddPrefix(const PrefixTlv &aPrefixTlv);
+        Error AddRoute(uint16_t aRloc16, int8_t aPreference);
+
+        State   mState;
+        uint8_t mVersion;
+        uint8_t mStableVersion;
+        uint8_t mNumPrefixes;
+        uint8_t mNumRoutes;
+        uint8_t mContextIndex[kNumContexts];
+        Prefix  mPrefixes[kMaxPrefixes];
+        Route   mRoutes[kMaxRoutes];
+    };
+
+    const LookupCache *GetLookupCache(void) const;
+
     const PrefixTlv *FindNextMatchingPrefix(const Ip6::Address &aAddress, const PrefixTlv *aPrevTlv) const;
 
     void RemoveCommissioningData(void);
 
+    bool  IsRoutePreferred(int8_t aPreference, uint16_t aRloc16, int8_t aOtherPreference, uint16_t aOtherRloc16) const;
     Error ExternalRouteLookup(uint8_t             aDomainId,
                               const Ip6::Address &aDestination,
                               uint8_t *           aPrefixMatchLength,
                               uint16_t *          aRloc16) const;
+    Error ExternalRouteLookup(const LookupCache & aCache,
+                              uint8_t             aDomainId,
+                              const Ip6::Address &aDestination,
+                              uint8_t *           aPrefixMatchLength,
+                              uint16_t *          aRloc16) const;
     Error DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t *aRloc16) const;
+    Error DefaultRouteLookup(const LookupCache &aCache, const LookupCache::Prefix &aPrefix, uint16_t *aRloc16) const;
     Error SteeringDataCheck(const FilterIndexes &aFilterIndexes) const;
+
+    LookupCache mLookupCache;
 };
 
 /**
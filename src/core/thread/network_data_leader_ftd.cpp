@@ -742,6 +742,8 @@ Error Leader::AddPrefix(const PrefixTlv &aPrefix, ChangedFlags &aChangedFlags)
     Error      error     = kErrorNone;
     PrefixTlv *dstPrefix = FindPrefix(aPrefix.GetPrefix(), aPrefix.GetPrefixLength());
 
+    InvalidateLookupCache();
+
     if (dstPrefix == nullptr)
     {
         dstPrefix = static_cast<PrefixTlv *>(AppendTlv(PrefixTlv::CalculateSize(aPrefix.GetPrefixLength())));
@@ -790,6 +792,8 @@ Error Leader::AddService(const ServiceTlv &aService, ChangedFlags &aChangedFlags
         FindService(aService.GetEnterpriseNumber(), aService.GetServiceData(), aService.GetServiceDataLength());
     const ServerTlv *server;
 
+    InvalidateLookupCache();
+
     if (dstService == nullptr)
     {
         uint8_t serviceId;
@@ -1056,6 +1060,8 @@ void Leader::RemoveRloc(uint16_t       aRloc16,
 
     NetworkDataTlv *cur = GetTlvsStart();
 
+    InvalidateLookupCache();
+
     while (cur < GetTlvsEnd())
     {
         switch (cur->GetType())
@@ -1260,6 +1266,8 @@ void Leader::RemoveContext(uint8_t aContextId)
     NetworkDataTlv *start = GetTlvsStart();
     PrefixTlv *     prefix;
 
+    InvalidateLookupCache();
+
     while ((prefix = FindTlv<PrefixTlv>(start, GetTlvsEnd())) != nullptr)
     {
         RemoveContext(*prefix, aContextId);
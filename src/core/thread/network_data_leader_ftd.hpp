@@ -174,6 +174,8 @@ public:
     Error RemoveStaleChildEntries(Coap::ResponseHandler aHandler, void *aContext);
 
 private:
+    friend class LeaderTester;
+
     class ChangedFlags
     {
     public:
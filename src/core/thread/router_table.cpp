@@ -194,6 +194,8 @@ void RouterTable::UpdateAllocation(void)
         router.Clear();
         router.SetRloc16(0xffff);
     }
+
+    Get<Mle::MleRouter>().InvalidateFib();
 }
 
 Router *RouterTable::Allocate(void)
@@ -89,6 +89,17 @@ void Neighbor::Init(Instance &aInstance)
     SetState(kStateInvalid);
 }
 
+void Neighbor::SetState(State aState)
+{
+    VerifyOrExit(GetState() != aState);
+
+    mState = static_cast<uint8_t>(aState);
+    Get<Mle::MleRouter>().InvalidateFib();
+
+exit:
+    return;
+}
+
 bool Neighbor::IsStateValidOrAttaching(void) const
 {
     bool rval = false;
@@ -500,4 +511,37 @@ void Router::Clear(void)
     Init(instance);
 }
 
+void Router::SetNextHop(uint8_t aRouterId)
+{
+    VerifyOrExit(mNextHop != aRouterId);
+
+    mNextHop = aRouterId;
+    Get<Mle::MleRouter>().InvalidateFib();
+
+exit:
+    return;
+}
+
+void Router::SetLinkQualityOut(uint8_t aLinkQuality)
+{
+    VerifyOrExit(mLinkQualityOut != aLinkQuality);
+
+    mLinkQualityOut = aLinkQuality;
+    Get<Mle::MleRouter>().InvalidateFib();
+
+exit:
+    return;
+}
+
+void Router::SetCost(uint8_t aCost)
+{
+    VerifyOrExit(mCost != aCost);
+
+    mCost = aCost;
+    Get<Mle::MleRouter>().InvalidateFib();
+
+exit:
+    return;
+}
+
 } // namespace ot
@@ -219,7 +219,7 @@ public:
      * @param[in]  aState  The state value.
      *
      */
-    void SetState(State aState) { mState = static_cast<uint8_t>(aState); }
+    void SetState(State aState);
 
     /**
      * This method indicates whether the neighbor is in the Invalid state.
@@ -1363,7 +1363,7 @@ public:
      * @param[in]  aRouterId  The router ID of the next hop to this router.
      *
      */
-    void SetNextHop(uint8_t aRouterId) { mNextHop = aRouterId; }
+    void SetNextHop(uint8_t aRouterId);
 
     /**
      * This method gets the link quality out value for this router.
@@ -1379,7 +1379,7 @@ public:
      * @param[in]  aLinkQuality  The link quality out value for this router.
      *
      */
-    void SetLinkQualityOut(uint8_t aLinkQuality) { mLinkQualityOut = aLinkQuality; }
+    void SetLinkQualityOut(uint8_t aLinkQuality);
 
     /**
      * This method get the route cost to this router.
@@ -1395,7 +1395,7 @@ public:
      * @param[in]  aCost  The router cost to this router.
      *
      */
-    void SetCost(uint8_t aCost) { mCost = aCost; }
+    void SetCost(uint8_t aCost);
 
 private:
     uint8_t mNextHop;            ///< The next hop towards this router
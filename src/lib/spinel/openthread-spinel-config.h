@@ -55,4 +55,19 @@
 #define OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT 0
 #endif
 
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_ASYNC_SET_ENABLE
+ *
+ * Define 1 to send spinel property sets whose result is not needed by the caller (e.g., PAN ID, addresses, MAC keys,
+ * frame counter) without blocking for the response. The responses are processed as they arrive and multiple such
+ * requests can be outstanding, one per spinel transaction id.
+ *
+ * A failed set is only detected after the caller has continued, and is handled as an RCP failure (the RCP is
+ * restored when `OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT` is non-zero, otherwise the process exits).
+ *
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_ASYNC_SET_ENABLE
+#define OPENTHREAD_SPINEL_CONFIG_ASYNC_SET_ENABLE 0
+#endif
+
 #endif // OPENTHREAD_SPINEL_CONFIG_H_
@@ -104,6 +104,51 @@ namespace Spinel {
 template <typename InterfaceType, typename ProcessContextType> class RadioSpinel
 {
 public:
+    /**
+     * This structure represents the spinel request statistics of a property.
+     *
+     */
+    struct PropertyStats
+    {
+        enum
+        {
+            kNumRttBuckets = 8, ///< Number of round-trip time histogram buckets.
+        };
+
+        spinel_prop_key_t mKey;              ///< The property key.
+        uint32_t          mNumResponses;     ///< Number of responses received for requests.
+        uint32_t          mNumAsyncFailures; ///< Number of requests sent without waiting which failed.
+        uint32_t          mMaxRtt;           ///< Max round-trip time of a request (in microseconds).
+
+        /**
+         * The request round-trip time histogram. Bucket 0 counts RTTs shorter than 1 ms, bucket `i` (0 < i < 7) counts
+         * RTTs in `[2^(i-1), 2^i)` ms, and the last bucket counts RTTs of 64 ms or longer.
+         *
+         */
+        uint32_t mRttHistogram[kNumRttBuckets];
+    };
+
+    /**
+     * This structure represents the spinel request statistics.
+     *
+     * The round-trip times are kept per property, for the first `kMaxProperties` properties requested. Responses for
+     * other properties are only counted in `mNumResponses`.
+     *
+     */
+    struct RequestStats
+    {
+        enum
+        {
+            kMaxProperties = 32, ///< Max number of properties with round-trip time statistics.
+        };
+
+        uint32_t      mNumResponses;               ///< Number of responses received for requests.
+        uint32_t      mNumAsyncRequests;           ///< Number of requests sent without waiting for the response.
+        uint32_t      mNumAsyncFailures;           ///< Number of requests sent without waiting which failed.
+        uint8_t       mNumProperties;              ///< Number of entries in `mProperties`.
+        PropertyStats mProperties[kMaxProperties]; ///< The statistics of each property, in the order first requested.
+    };
+
     /**
      * This constructor initializes the spinel based OpenThread transceiver.
      *
@@ -741,9 +786,18 @@ public:
      */
     otError SetChannelMaxTransmitPower(uint8_t aChannel, int8_t aPower);
 
+    /**
+     * This method returns the spinel request statistics.
+     *
+     * @returns A reference to the spinel request statistics.
+     *
+     */
+    const RequestStats &GetRequestStats(void) const { return mRequestStats; }
+
 private:
     enum
     {
+        kMaxTids               = 16,   ///< Number of spinel transaction ids (zero is used for notifications).
         kMaxSpinelFrame        = SpinelInterface::kMaxFrameSize,
         kMaxWaitTime           = 2000, ///< Max time to wait for response in milliseconds.
         kVersionStringSize     = 128,  ///< Max size of version string.
@@ -856,6 +910,24 @@ private:
      */
     otError Remove(spinel_prop_key_t aKey, const char *aFormat, ...);
 
+    /**
+     * This method tries to update a spinel property of OpenThread transceiver without waiting for the response.
+     *
+     * The response is processed when it is received. A failure reported in the response (or no response within
+     * `kMaxWaitTime`) is handled as an RCP failure. If `OPENTHREAD_SPINEL_CONFIG_ASYNC_SET_ENABLE` is not enabled,
+     * this method behaves the same as `Set()`.
+     *
+     * @param[in]   aKey        Spinel property key.
+     * @param[in]   aFormat     Spinel formatter to pack property value.
+     * @param[in]   ...         Variable arguments list.
+     *
+     * @retval  OT_ERROR_NONE               Successfully sent the request.
+     * @retval  OT_ERROR_BUSY               Failed due to no available transaction id.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received for earlier requests.
+     *
+     */
+    otError SetAsync(spinel_prop_key_t aKey, const char *aFormat, ...);
+
     spinel_tid_t GetNextTid(void);
     void         FreeTid(spinel_tid_t tid) { mCmdTidsInUse &= ~(1 << tid); }
 
@@ -909,6 +981,18 @@ private:
     void HandleResponse(const uint8_t *aBuffer, uint16_t aLength);
     void HandleTransmitDone(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
     void HandleWaitingResponse(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
+    void HandleAsyncResponse(spinel_tid_t      aTid,
+                             uint32_t          aCommand,
+                             spinel_prop_key_t aKey,
+                             const uint8_t *   aBuffer,
+                             uint16_t          aLength);
+    void           UpdateRequestStats(spinel_tid_t aTid);
+    PropertyStats *GetPropertyStats(spinel_prop_key_t aKey);
+#if OPENTHREAD_SPINEL_CONFIG_ASYNC_SET_ENABLE
+    otError RequestAsyncV(uint32_t aCommand, spinel_prop_key_t aKey, const char *aFormat, va_list aArgs);
+    otError WaitAsyncResponse(void);
+    void    CheckAsyncTimeout(void);
+#endif
 
     void RadioReceive(void);
 
@@ -939,6 +1023,11 @@ private:
     va_list           mPropertyArgs;    ///< The arguments pack or unpack spinel property of current transaction.
     uint32_t          mExpectedCommand; ///< Expected response command of current transaction.
     otError           mError;           ///< The result of current transaction.
+    uint16_t          mAsyncTids;       ///< Transaction ids of requests sent without waiting for response.
+
+    spinel_prop_key_t mTidKeys[kMaxTids];      ///< The property key of each outstanding transaction.
+    uint64_t          mTidSentTimes[kMaxTids]; ///< The send time of each outstanding transaction.
+    RequestStats      mRequestStats;
 
     uint8_t       mRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t       mTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
@@ -184,6 +184,7 @@ RadioSpinel<InterfaceType, ProcessContextType>::RadioSpinel(void)
     , mPropertyFormat(nullptr)
     , mExpectedCommand(0)
     , mError(OT_ERROR_NONE)
+    , mAsyncTids(0)
     , mTransmitFrame(nullptr)
     , mShortAddress(0)
     , mPanId(0xffff)
@@ -217,6 +218,7 @@ RadioSpinel<InterfaceType, ProcessContextType>::RadioSpinel(void)
     , mRadioTimeOffset(0)
 {
     mVersion[0] = '\0';
+    memset(&mRequestStats, 0, sizeof(mRequestStats));
 }
 
 template <typename InterfaceType, typename ProcessContextType>
@@ -566,10 +568,20 @@ void RadioSpinel<InterfaceType, ProcessContextType>::HandleResponse(const uint8_
 
     if (mWaitingTid == SPINEL_HEADER_GET_TID(header))
     {
+        UpdateRequestStats(mWaitingTid);
         HandleWaitingResponse(cmd, key, data, static_cast<uint16_t>(len));
         FreeTid(mWaitingTid);
         mWaitingTid = 0;
     }
+    else if ((mAsyncTids & (1 << SPINEL_HEADER_GET_TID(header))) != 0)
+    {
+        spinel_tid_t tid = SPINEL_HEADER_GET_TID(header);
+
+        UpdateRequestStats(tid);
+        mAsyncTids &= ~(1 << tid);
+        FreeTid(tid);
+        HandleAsyncResponse(tid, cmd, key, data, static_cast<uint16_t>(len));
+    }
     else if (mTxRadioTid == SPINEL_HEADER_GET_TID(header))
     {
         if (mState == kStateTransmitting)
@@ -822,6 +834,99 @@ exit:
     LogIfFail("Error processing result", mError);
 }
 
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::HandleAsyncResponse(spinel_tid_t      aTid,
+                                                                         uint32_t          aCommand,
+                                                                         spinel_prop_key_t aKey,
+                                                                         const uint8_t *   aBuffer,
+                                                                         uint16_t          aLength)
+{
+    otError error = OT_ERROR_NONE;
+
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status;
+        spinel_ssize_t  unpacked = spinel_datatype_unpack(aBuffer, aLength, "i", &status);
+
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        error = SpinelStatusToOtError(status);
+    }
+    else if (aKey != mTidKeys[aTid] || aCommand != SPINEL_CMD_PROP_VALUE_IS)
+    {
+        error = OT_ERROR_DROP;
+    }
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        PropertyStats *propertyStats = GetPropertyStats(mTidKeys[aTid]);
+
+        if (propertyStats != nullptr)
+        {
+            propertyStats->mNumAsyncFailures++;
+        }
+
+        mRequestStats.mNumAsyncFailures++;
+        otLogCritPlat("Failed to set %s: %s", spinel_prop_key_to_cstr(mTidKeys[aTid]), otThreadErrorToString(error));
+
+        // The caller of an asynchronous set does not expect a failure,
+        // so it is handled the same way as an RCP failure.
+        HandleRcpTimeout();
+    }
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::UpdateRequestStats(spinel_tid_t aTid)
+{
+    uint64_t       rtt           = otPlatTimeGet() - mTidSentTimes[aTid];
+    uint8_t        bucket        = 0;
+    PropertyStats *propertyStats = GetPropertyStats(mTidKeys[aTid]);
+
+    mRequestStats.mNumResponses++;
+
+    VerifyOrExit(propertyStats != nullptr);
+
+    for (uint64_t bound = US_PER_MS; rtt >= bound && bucket < PropertyStats::kNumRttBuckets - 1; bound <<= 1)
+    {
+        bucket++;
+    }
+
+    propertyStats->mNumResponses++;
+    propertyStats->mRttHistogram[bucket]++;
+
+    if (rtt > propertyStats->mMaxRtt)
+    {
+        propertyStats->mMaxRtt = static_cast<uint32_t>(OT_MIN(rtt, static_cast<uint64_t>(UINT32_MAX)));
+    }
+
+exit:
+    return;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+typename RadioSpinel<InterfaceType, ProcessContextType>::PropertyStats *RadioSpinel<InterfaceType, ProcessContextType>::
+    GetPropertyStats(spinel_prop_key_t aKey)
+{
+    PropertyStats *propertyStats = nullptr;
+
+    for (uint8_t i = 0; i < mRequestStats.mNumProperties; i++)
+    {
+        if (mRequestStats.mProperties[i].mKey == aKey)
+        {
+            ExitNow(propertyStats = &mRequestStats.mProperties[i]);
+        }
+    }
+
+    VerifyOrExit(mRequestStats.mNumProperties < RequestStats::kMaxProperties);
+
+    propertyStats = &mRequestStats.mProperties[mRequestStats.mNumProperties++];
+    memset(propertyStats, 0, sizeof(*propertyStats));
+    propertyStats->mKey = aKey;
+
+exit:
+    return propertyStats;
+}
+
 template <typename InterfaceType, typename ProcessContextType>
 void RadioSpinel<InterfaceType, ProcessContextType>::HandleValueIs(spinel_prop_key_t aKey,
                                                                    const uint8_t *   aBuffer,
@@ -1103,6 +1208,10 @@ void RadioSpinel<InterfaceType, ProcessContextType>::Process(const ProcessContex
 
     ProcessRadioStateMachine();
     RecoverFromRcpFailure();
+#if OPENTHREAD_SPINEL_CONFIG_ASYNC_SET_ENABLE
+    CheckAsyncTimeout();
+    RecoverFromRcpFailure();
+#endif
     CalcRcpTimeOffset();
 }
 
@@ -1112,7 +1221,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::SetPromiscuous(bool aEna
     otError error;
 
     uint8_t mode = (aEnable ? SPINEL_MAC_PROMISCUOUS_MODE_NETWORK : SPINEL_MAC_PROMISCUOUS_MODE_OFF);
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_PROMISCUOUS_MODE, SPINEL_DATATYPE_UINT8_S, mode));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_PROMISCUOUS_MODE, SPINEL_DATATYPE_UINT8_S, mode));
     mIsPromiscuous = aEnable;
 
 exit:
@@ -1125,7 +1234,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::SetShortAddress(uint16_t
     otError error = OT_ERROR_NONE;
 
     VerifyOrExit(mShortAddress != aAddress);
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, aAddress));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, aAddress));
     mShortAddress = aAddress;
 
 exit:
@@ -1141,11 +1250,11 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::SetMacKey(uint8_t
 {
     otError error;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_RCP_MAC_KEY,
-                              SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
-                                  SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
-                              aKeyIdMode, aKeyId, aPrevKey.m8, sizeof(otMacKey), aCurrKey.m8, sizeof(otMacKey),
-                              aNextKey.m8, sizeof(otMacKey)));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_RCP_MAC_KEY,
+                                   SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
+                                       SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
+                                   aKeyIdMode, aKeyId, aPrevKey.m8, sizeof(otMacKey), aCurrKey.m8, sizeof(otMacKey),
+                                   aNextKey.m8, sizeof(otMacKey)));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     mKeyIdMode = aKeyIdMode;
@@ -1165,7 +1274,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::SetMacFrameCounter(uint3
 {
     otError error;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S, aMacFrameCounter));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S, aMacFrameCounter));
 
 exit:
     return error;
@@ -1184,7 +1293,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::SetExtendedAddress(const
 {
     otError error;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
     mExtendedAddress = aExtAddress;
 
 exit:
@@ -1197,7 +1306,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::SetPanId(uint16_t aPanId
     otError error = OT_ERROR_NONE;
 
     VerifyOrExit(mPanId != aPanId);
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, aPanId));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, aPanId));
     mPanId = aPanId;
 
 exit:
@@ -1207,7 +1316,7 @@ exit:
 template <typename InterfaceType, typename ProcessContextType>
 otError RadioSpinel<InterfaceType, ProcessContextType>::EnableSrcMatch(bool aEnable)
 {
-    return Set(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, aEnable);
+    return SetAsync(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, aEnable);
 }
 
 template <typename InterfaceType, typename ProcessContextType>
@@ -1313,7 +1422,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::ClearSrcMatchShortEntrie
 {
     otError error;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, nullptr));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, nullptr));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     mSrcMatchShortEntryCount = 0;
@@ -1328,7 +1437,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::ClearSrcMatchExtEntries(
 {
     otError error;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, nullptr));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, nullptr));
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     mSrcMatchExtEntryCount = 0;
@@ -1588,6 +1697,33 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::Set(spinel_prop_key_t aK
     return error;
 }
 
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::SetAsync(spinel_prop_key_t aKey, const char *aFormat, ...)
+{
+    otError error;
+
+    assert(mWaitingTid == 0);
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    do
+    {
+        RecoverFromRcpFailure();
+#endif
+        va_start(mPropertyArgs, aFormat);
+#if OPENTHREAD_SPINEL_CONFIG_ASYNC_SET_ENABLE
+        error = RequestAsyncV(SPINEL_CMD_PROP_VALUE_SET, aKey, aFormat, mPropertyArgs);
+#else
+        error = RequestWithExpectedCommandV(SPINEL_CMD_PROP_VALUE_IS, SPINEL_CMD_PROP_VALUE_SET, aKey, aFormat,
+                                            mPropertyArgs);
+#endif
+        va_end(mPropertyArgs);
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    } while (mRcpFailed);
+#endif
+
+    return error;
+}
+
 template <typename InterfaceType, typename ProcessContextType>
 otError RadioSpinel<InterfaceType, ProcessContextType>::Insert(spinel_prop_key_t aKey, const char *aFormat, ...)
 {
@@ -1669,16 +1805,75 @@ exit:
     return mError;
 }
 
+#if OPENTHREAD_SPINEL_CONFIG_ASYNC_SET_ENABLE
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::WaitAsyncResponse(void)
+{
+    otError  error   = OT_ERROR_NONE;
+    uint16_t pending = mAsyncTids;
+    uint64_t end     = otPlatTimeGet() + kMaxWaitTime * US_PER_MS;
+
+    while (pending != 0 && (mAsyncTids & pending) == pending)
+    {
+        uint64_t now = otPlatTimeGet();
+        uint64_t remain;
+
+        if (end <= now)
+        {
+            HandleRcpTimeout();
+            ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
+        }
+
+        remain = end - now;
+
+        if (mSpinelInterface.WaitForFrame(remain) != OT_ERROR_NONE)
+        {
+            HandleRcpTimeout();
+            ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
+        }
+    }
+
+exit:
+    return error;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::CheckAsyncTimeout(void)
+{
+    uint64_t now = otPlatTimeGet();
+
+    for (spinel_tid_t tid = 1; tid < kMaxTids && mAsyncTids != 0; tid++)
+    {
+        if ((mAsyncTids & (1 << tid)) != 0 && now >= mTidSentTimes[tid] + kMaxWaitTime * US_PER_MS)
+        {
+            otLogCritPlat("No response to set %s", spinel_prop_key_to_cstr(mTidKeys[tid]));
+            HandleRcpTimeout();
+            break;
+        }
+    }
+}
+#endif // OPENTHREAD_SPINEL_CONFIG_ASYNC_SET_ENABLE
+
 template <typename InterfaceType, typename ProcessContextType>
 spinel_tid_t RadioSpinel<InterfaceType, ProcessContextType>::GetNextTid(void)
 {
     spinel_tid_t tid = 0;
 
-    if (((1 << mCmdNextTid) & mCmdTidsInUse) == 0)
+    // Search for an unused transaction id starting from `mCmdNextTid`,
+    // since requests sent without waiting may still be outstanding.
+
+    for (uint8_t i = 1; i < kMaxTids; i++)
     {
-        tid         = mCmdNextTid;
+        spinel_tid_t candidate = mCmdNextTid;
+
         mCmdNextTid = SPINEL_GET_NEXT_TID(mCmdNextTid);
-        mCmdTidsInUse |= (1 << tid);
+
+        if (((1 << candidate) & mCmdTidsInUse) == 0)
+        {
+            tid = candidate;
+            mCmdTidsInUse |= (1 << tid);
+            break;
+        }
     }
 
     return tid;
@@ -1761,9 +1956,11 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::RequestV(uint32_t
     }
     else
     {
-        mWaitingKey = aKey;
-        mWaitingTid = tid;
-        error       = WaitResponse();
+        mWaitingKey        = aKey;
+        mWaitingTid        = tid;
+        mTidKeys[tid]      = aKey;
+        mTidSentTimes[tid] = otPlatTimeGet();
+        error              = WaitResponse();
     }
 
 exit:
@@ -1783,6 +1980,44 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::Request(uint32_t
     return status;
 }
 
+#if OPENTHREAD_SPINEL_CONFIG_ASYNC_SET_ENABLE
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::RequestAsyncV(uint32_t          aCommand,
+                                                                      spinel_prop_key_t aKey,
+                                                                      const char *      aFormat,
+                                                                      va_list           aArgs)
+{
+    otError      error = OT_ERROR_NONE;
+    spinel_tid_t tid   = GetNextTid();
+
+    if (tid == 0)
+    {
+        // All transaction ids are in use, wait for an outstanding
+        // request to complete.
+        SuccessOrExit(error = WaitAsyncResponse());
+        tid = GetNextTid();
+    }
+
+    VerifyOrExit(tid > 0, error = OT_ERROR_BUSY);
+
+    error = SendCommand(aCommand, aKey, tid, aFormat, aArgs);
+
+    if (error != OT_ERROR_NONE)
+    {
+        FreeTid(tid);
+        ExitNow();
+    }
+
+    mTidKeys[tid]      = aKey;
+    mTidSentTimes[tid] = otPlatTimeGet();
+    mAsyncTids |= (1 << tid);
+    mRequestStats.mNumAsyncRequests++;
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_SPINEL_CONFIG_ASYNC_SET_ENABLE
+
 template <typename InterfaceType, typename ProcessContextType>
 otError RadioSpinel<InterfaceType, ProcessContextType>::RequestWithPropertyFormat(const char *      aPropertyFormat,
                                                                                   uint32_t          aCommand,
@@ -2219,6 +2454,7 @@ void RadioSpinel<InterfaceType, ProcessContextType>::RecoverFromRcpFailure(void)
     mCmdNextTid   = 1;
     mTxRadioTid   = 0;
     mWaitingTid   = 0;
+    mAsyncTids    = 0;
     mWaitingKey   = SPINEL_PROP_LAST_STATUS;
     mError        = OT_ERROR_NONE;
     mIsReady      = false;
@@ -66,6 +66,7 @@
 #include <common/code_utils.hpp>
 #include <common/logging.hpp>
 #include <lib/platform/exit_code.h>
+#include <lib/spinel/spinel.h>
 #include <openthread/openthread-system.h>
 #include <openthread/platform/misc.h>
 
@@ -296,6 +297,39 @@ static void PrintRadioUrl(void *aContext, uint8_t aArgsLength, char *aArgs[])
     otCliOutputFormat("%s\r\nDone\r\n", config->mRadioUrl);
 }
 
+static void PrintRcpRequestStats(void *aContext, uint8_t aArgsLength, char *aArgs[])
+{
+    (void)aContext;
+    (void)aArgsLength;
+    (void)aArgs;
+
+    otSysRcpRequestStats stats;
+
+    otSysGetRcpRequestStats(&stats);
+
+    otCliOutputFormat("responses: %u\r\n", stats.mNumResponses);
+    otCliOutputFormat("async requests: %u\r\n", stats.mNumAsyncRequests);
+    otCliOutputFormat("async failures: %u\r\n", stats.mNumAsyncFailures);
+
+    for (uint8_t i = 0; i < stats.mNumProperties; i++)
+    {
+        const otSysRcpPropertyStats *property = &stats.mProperties[i];
+
+        otCliOutputFormat("%s: responses %u, async failures %u, max rtt %uus, rtt histogram",
+                          spinel_prop_key_to_cstr((spinel_prop_key_t)property->mKey), property->mNumResponses,
+                          property->mNumAsyncFailures, property->mMaxRtt);
+
+        for (uint8_t bucket = 0; bucket < OT_SYS_RCP_RTT_HISTOGRAM_SIZE; bucket++)
+        {
+            otCliOutputFormat(" %u", property->mRttHistogram[bucket]);
+        }
+
+        otCliOutputFormat("\r\n");
+    }
+
+    otCliOutputFormat("Done\r\n");
+}
+
 static otInstance *InitInstance(PosixConfig *aConfig)
 {
     otInstance *instance = NULL;
@@ -346,7 +380,10 @@ int main(int argc, char *argv[])
     otInstance * instance;
     int          rval = 0;
     PosixConfig  config;
-    otCliCommand radioUrlCommand = {"radiourl", PrintRadioUrl};
+    otCliCommand userCommands[] = {
+        {"radiourl", PrintRadioUrl},
+        {"rcpstats", PrintRcpRequestStats},
+    };
 
 #ifdef __linux__
     // Ensure we terminate this process if the
@@ -371,7 +408,7 @@ int main(int argc, char *argv[])
 #if !OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE
     otAppCliInit(instance);
 #endif
-    otCliSetUserCommands(&radioUrlCommand, 1, &config.mPlatformConfig);
+    otCliSetUserCommands(userCommands, OT_ARRAY_LENGTH(userCommands), &config.mPlatformConfig);
 
     while (true)
     {
@@ -39,65 +39,357 @@
 #include <unistd.h>
 
 #include <openthread/cli.h>
+#include <openthread/thread.h>
 
 #include "cli/cli_config.h"
 #include "common/code_utils.hpp"
+#include "posix/platform/mainloop.hpp"
 
 #if OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE
 
 #define OPENTHREAD_POSIX_DAEMON_SOCKET_LOCK OPENTHREAD_POSIX_CONFIG_DAEMON_SOCKET_BASENAME ".lock"
 static_assert(sizeof(OPENTHREAD_POSIX_DAEMON_SOCKET_NAME) < sizeof(sockaddr_un::sun_path),
               "OpenThread daemon socket name too long!");
+static_assert(OPENTHREAD_POSIX_CONFIG_DAEMON_MAX_SESSIONS > 0, "At least one daemon session is required!");
+static_assert(OPENTHREAD_POSIX_CONFIG_DAEMON_SESSION_OUTPUT_BUFFER_SIZE > OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH &&
+                  OPENTHREAD_POSIX_CONFIG_DAEMON_SESSION_OUTPUT_BUFFER_SIZE <= UINT16_MAX,
+              "Invalid daemon session output buffer size!");
 
-static int sListenSocket  = -1;
-static int sDaemonLock    = -1;
-static int sSessionSocket = -1;
+static const char kSubscribeCommand[] = "subscribe";
 
-static int OutputFormatV(void *aContext, const char *aFormat, va_list aArguments)
+/**
+ * This structure represents a client connected to the daemon socket.
+ *
+ */
+struct DaemonSession
 {
-    OT_UNUSED_VARIABLE(aContext);
+    int      mFd;
+    bool     mSubscribed;   ///< Read-only session which only receives state change events.
+    bool     mDiscarding;   ///< The input line exceeded the input buffer and is being dropped.
+    bool     mLastWasCr;    ///< The last line ended with `\r`, so a following `\n` is not an empty line.
+    uint16_t mInputLength;  ///< Number of bytes received but not yet processed in `mInput`.
+    uint16_t mOutputLength; ///< Number of bytes pending in `mOutput`.
+    char     mInput[OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH];
+    char     mOutput[OPENTHREAD_POSIX_CONFIG_DAEMON_SESSION_OUTPUT_BUFFER_SIZE];
+};
+
+static otInstance *  sInstance     = nullptr;
+static int           sListenSocket = -1;
+static int           sDaemonLock   = -1;
+static DaemonSession sSessions[OPENTHREAD_POSIX_CONFIG_DAEMON_MAX_SESSIONS];
+
+// The session whose command is being processed by the CLI.
+static DaemonSession *sCurrentSession = nullptr;
+
+// The session which issued the last command, receives asynchronous CLI output (e.g. ping replies).
+static DaemonSession *sLastSession = nullptr;
+
+static void CloseSession(DaemonSession &aSession)
+{
+    VerifyOrExit(aSession.mFd != -1);
 
-    char buf[OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH + 1];
-    int  rval;
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    IgnoreReturnValue(ot::Posix::Mainloop::Get().Unwatch(aSession.mFd));
+#endif
+    close(aSession.mFd);
+    aSession.mFd = -1;
 
-    buf[OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH] = '\0';
+    if (sCurrentSession == &aSession)
+    {
+        sCurrentSession = nullptr;
+    }
 
-    rval = vsnprintf(buf, sizeof(buf) - 1, aFormat, aArguments);
+    if (sLastSession == &aSession)
+    {
+        sLastSession = nullptr;
+    }
 
-    VerifyOrExit(rval >= 0, otLogWarnPlat("Failed to format CLI output: %s", strerror(errno)));
+exit:
+    return;
+}
 
-    VerifyOrExit(sSessionSocket != -1, otLogDebgPlat("%s", buf));
+static ssize_t SendNonBlocking(int aFd, const char *aBuffer, size_t aLength)
+{
+    ssize_t rval;
 
+    do
+    {
 #if defined(__linux__)
-    // Don't die on SIGPIPE
-    rval = send(sSessionSocket, buf, static_cast<size_t>(rval), MSG_NOSIGNAL);
+        // Don't die on SIGPIPE
+        rval = send(aFd, aBuffer, aLength, MSG_NOSIGNAL);
 #else
-    rval = static_cast<int>(write(sSessionSocket, buf, static_cast<size_t>(rval)));
+        rval = write(aFd, aBuffer, aLength);
 #endif
+    } while (rval == -1 && errno == EINTR);
+
+    if (rval == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+        rval = 0;
+    }
+
+    return rval;
+}
+
+static void FlushSession(DaemonSession &aSession)
+{
+    ssize_t rval;
+
+    VerifyOrExit(aSession.mFd != -1 && aSession.mOutputLength > 0);
+
+    rval = SendNonBlocking(aSession.mFd, aSession.mOutput, aSession.mOutputLength);
 
     if (rval < 0)
     {
         otLogWarnPlat("Failed to write CLI output: %s", strerror(errno));
-        close(sSessionSocket);
-        sSessionSocket = -1;
+        CloseSession(aSession);
+        ExitNow();
+    }
+
+    aSession.mOutputLength -= static_cast<uint16_t>(rval);
+    memmove(aSession.mOutput, aSession.mOutput + rval, aSession.mOutputLength);
+
+exit:
+    return;
+}
+
+/**
+ * This function queues output to a session.
+ *
+ * Output is coalesced in the session output buffer and written when the mainloop is updated, or earlier if the
+ * buffer runs out of space. A client which does not drain its socket fast enough to keep the output buffer from
+ * overflowing is disconnected, rather than silently losing output.
+ *
+ */
+static void WriteSession(DaemonSession &aSession, const char *aBuffer, size_t aLength)
+{
+    VerifyOrExit(aSession.mFd != -1);
+
+    if (aLength > sizeof(aSession.mOutput) - aSession.mOutputLength)
+    {
+        FlushSession(aSession);
+        VerifyOrExit(aSession.mFd != -1);
+    }
+
+    if (aLength > sizeof(aSession.mOutput) - aSession.mOutputLength)
+    {
+        otLogWarnPlat("Session %d output buffer overflow, closing", aSession.mFd);
+        CloseSession(aSession);
+        ExitNow();
+    }
+
+    memcpy(aSession.mOutput + aSession.mOutputLength, aBuffer, aLength);
+    aSession.mOutputLength += static_cast<uint16_t>(aLength);
+
+exit:
+    return;
+}
+
+static void WriteSessionError(DaemonSession &aSession, otError aError)
+{
+    char buf[64];
+    int  length;
+
+    // Same format as the CLI, so that `ot-ctl` recognizes the end of the response.
+    length = snprintf(buf, sizeof(buf), "Error %d: %s\r\n", aError, otThreadErrorToString(aError));
+    WriteSession(aSession, buf, static_cast<size_t>(length));
+}
+
+static int OutputFormatV(void *aContext, const char *aFormat, va_list aArguments)
+{
+    OT_UNUSED_VARIABLE(aContext);
+
+    char           buf[OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH + 1];
+    DaemonSession *session = (sCurrentSession != nullptr) ? sCurrentSession : sLastSession;
+    int            rval;
+
+    buf[OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH] = '\0';
+
+    rval = vsnprintf(buf, sizeof(buf) - 1, aFormat, aArguments);
+
+    VerifyOrExit(rval >= 0, otLogWarnPlat("Failed to format CLI output: %s", strerror(errno)));
+
+    VerifyOrExit(session != nullptr, otLogDebgPlat("%s", buf));
+
+    if (static_cast<size_t>(rval) > sizeof(buf) - 2)
+    {
+        rval = static_cast<int>(sizeof(buf) - 2);
     }
 
+    WriteSession(*session, buf, static_cast<size_t>(rval));
+
 exit:
     return rval;
 }
 
-static void InitializeSessionSocket(void)
+static const char *DeviceRoleToString(otDeviceRole aRole)
 {
-    int newSessionSocket;
-    int rval;
+    const char *roleString = "unknown";
 
-    VerifyOrExit((newSessionSocket = accept(sListenSocket, nullptr, nullptr)) != -1, rval = -1);
+    switch (aRole)
+    {
+    case OT_DEVICE_ROLE_DISABLED:
+        roleString = "disabled";
+        break;
+    case OT_DEVICE_ROLE_DETACHED:
+        roleString = "detached";
+        break;
+    case OT_DEVICE_ROLE_CHILD:
+        roleString = "child";
+        break;
+    case OT_DEVICE_ROLE_ROUTER:
+        roleString = "router";
+        break;
+    case OT_DEVICE_ROLE_LEADER:
+        roleString = "leader";
+        break;
+    }
+
+    return roleString;
+}
+
+static void ProcessLine(DaemonSession &aSession, char *aLine)
+{
+    if (aSession.mSubscribed)
+    {
+        WriteSessionError(aSession, OT_ERROR_INVALID_STATE);
+        ExitNow();
+    }
+
+    otLogInfoPlat("> %s", aLine);
+
+    if (strcmp(aLine, kSubscribeCommand) == 0)
+    {
+        char buf[64];
+        int  length;
+
+        length = snprintf(buf, sizeof(buf), "Subscribed: role %s\r\n",
+                          DeviceRoleToString(otThreadGetDeviceRole(sInstance)));
+        aSession.mSubscribed = true;
+        WriteSession(aSession, buf, static_cast<size_t>(length));
+        ExitNow();
+    }
+
+    sCurrentSession = &aSession;
+    sLastSession    = &aSession;
+    otCliInputLine(aLine);
+    otCliOutputFormat("> ");
+    sCurrentSession = nullptr;
+
+exit:
+    return;
+}
+
+static uint16_t FindLineEnd(const DaemonSession &aSession)
+{
+    uint16_t length = 0;
+
+    while (length < aSession.mInputLength && aSession.mInput[length] != '\r' && aSession.mInput[length] != '\n')
+    {
+        length++;
+    }
+
+    return length;
+}
+
+static bool HasInputLine(const DaemonSession &aSession)
+{
+    return FindLineEnd(aSession) < aSession.mInputLength;
+}
+
+/**
+ * This function processes the complete lines received by a session.
+ *
+ * A single read may carry several lines, or only part of one. Lines are processed one by one, and only while the
+ * output of the previous line has been fully written, so a client pipelining commands without reading the responses
+ * is throttled instead of overflowing its output buffer.
+ *
+ */
+static void ProcessInput(DaemonSession &aSession)
+{
+    while (aSession.mFd != -1 && aSession.mOutputLength == 0)
+    {
+        uint16_t length = FindLineEnd(aSession);
+        bool     isCr;
+
+        if (length == aSession.mInputLength)
+        {
+            if (length == sizeof(aSession.mInput))
+            {
+                aSession.mDiscarding  = true;
+                aSession.mInputLength = 0;
+            }
+
+            break;
+        }
+
+        isCr                    = (aSession.mInput[length] == '\r');
+        aSession.mInput[length] = '\0';
+
+        if (aSession.mDiscarding)
+        {
+            otLogWarnPlat("Daemon input line too long, dropped");
+            WriteSessionError(aSession, OT_ERROR_NO_BUFS);
+            WriteSession(aSession, "> ", sizeof("> ") - 1);
+            aSession.mDiscarding = false;
+        }
+        else if (length > 0 || !aSession.mLastWasCr || isCr)
+        {
+            ProcessLine(aSession, aSession.mInput);
+        }
+
+        VerifyOrExit(aSession.mFd != -1);
+
+        aSession.mLastWasCr = isCr;
+        aSession.mInputLength -= length + 1;
+        memmove(aSession.mInput, aSession.mInput + length + 1, aSession.mInputLength);
+
+        FlushSession(aSession);
+    }
+
+exit:
+    return;
+}
+
+static void ReadSession(DaemonSession &aSession)
+{
+    ssize_t rval;
+
+    rval = read(aSession.mFd, aSession.mInput + aSession.mInputLength, sizeof(aSession.mInput) - aSession.mInputLength);
+
+    if (rval <= 0)
+    {
+        if (rval < 0)
+        {
+            VerifyOrExit(errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR);
+            otLogWarnPlat("Daemon read: %s", strerror(errno));
+        }
+
+        CloseSession(aSession);
+        ExitNow();
+    }
+
+    aSession.mInputLength += static_cast<uint16_t>(rval);
+    ProcessInput(aSession);
+
+exit:
+    return;
+}
+
+static int SetSessionSocketOptions(int aFd)
+{
+    int rval;
 
-    VerifyOrExit((rval = fcntl(newSessionSocket, F_GETFD, 0)) != -1);
+    VerifyOrExit((rval = fcntl(aFd, F_GETFD, 0)) != -1);
 
     rval |= FD_CLOEXEC;
 
-    VerifyOrExit((rval = fcntl(newSessionSocket, F_SETFD, rval)) != -1);
+    VerifyOrExit((rval = fcntl(aFd, F_SETFD, rval)) != -1);
+
+    VerifyOrExit((rval = fcntl(aFd, F_GETFL, 0)) != -1);
+
+    rval |= O_NONBLOCK;
+
+    VerifyOrExit((rval = fcntl(aFd, F_SETFL, rval)) != -1);
 
 #ifndef __linux__
     // some platforms (macOS, Solaris) don't have MSG_NOSIGNAL
@@ -105,31 +397,74 @@ static void InitializeSessionSocket(void)
     // if we have SO_NOSIGPIPE, then set it. Otherwise, we're going
     // to simply ignore it.
 #if defined(SO_NOSIGPIPE)
-    rval = setsockopt(newSessionSocket, SOL_SOCKET, SO_NOSIGPIPE, &rval, sizeof(rval));
+    rval = setsockopt(aFd, SOL_SOCKET, SO_NOSIGPIPE, &rval, sizeof(rval));
     VerifyOrExit(rval != -1);
 #else
 #warning "no support for MSG_NOSIGNAL or SO_NOSIGPIPE"
 #endif
 #endif // __linux__
 
-    if (sSessionSocket != -1)
+exit:
+    return rval;
+}
+
+static void InitializeSessionSocket(void)
+{
+    static const char kTooManySessions[] = "Error 5: Busy\r\n";
+
+    DaemonSession *session = nullptr;
+    int            newSessionSocket;
+    int            rval;
+
+    VerifyOrExit((newSessionSocket = accept(sListenSocket, nullptr, nullptr)) != -1, rval = -1);
+
+    VerifyOrExit((rval = SetSessionSocketOptions(newSessionSocket)) != -1);
+
+    for (DaemonSession &candidate : sSessions)
     {
-        close(sSessionSocket);
+        if (candidate.mFd == -1)
+        {
+            session = &candidate;
+            break;
+        }
+    }
+
+    if (session == nullptr)
+    {
+        otLogWarnPlat("Too many daemon sessions, rejecting new session");
+        IgnoreReturnValue(SendNonBlocking(newSessionSocket, kTooManySessions, sizeof(kTooManySessions) - 1));
+        close(newSessionSocket);
+        ExitNow();
+    }
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    if (ot::Posix::Mainloop::Get().Watch(newSessionSocket, EPOLLIN | EPOLLPRI, nullptr, nullptr) != OT_ERROR_NONE)
+    {
+        otLogWarnPlat("Failed to watch session socket, rejecting new session");
+        close(newSessionSocket);
+        ExitNow(session = nullptr);
     }
-    sSessionSocket = newSessionSocket;
+#endif
+
+    memset(session, 0, sizeof(*session));
+    session->mFd = newSessionSocket;
 
 exit:
     if (rval == -1)
     {
-        otLogWarnPlat("Failed to initialize session socket: %s", strerror(errno));
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+            otLogWarnPlat("Failed to initialize session socket: %s", strerror(errno));
+        }
+
         if (newSessionSocket != -1)
         {
             close(newSessionSocket);
         }
     }
-    else
+    else if (session != nullptr)
     {
-        otLogInfoPlat("Session socket is ready", strerror(errno));
+        otLogInfoPlat("Session socket %d is ready", newSessionSocket);
     }
 }
 
@@ -141,6 +476,11 @@ void platformDaemonEnable(otInstance *aInstance)
     // This allows implementing pseudo reset.
     VerifyOrExit(sListenSocket == -1);
 
+    for (DaemonSession &session : sSessions)
+    {
+        session.mFd = -1;
+    }
+
     sListenSocket = SocketWithCloseExec(AF_UNIX, SOCK_STREAM, 0, kSocketNonBlock);
 
     if (sListenSocket == -1)
@@ -174,15 +514,17 @@ void platformDaemonEnable(otInstance *aInstance)
         DieNowWithMessage("bind", OT_EXIT_ERROR_ERRNO);
     }
 
-    //
-    // only accept 1 connection.
-    //
-    ret = listen(sListenSocket, 1);
+    ret = listen(sListenSocket, OPENTHREAD_POSIX_CONFIG_DAEMON_MAX_SESSIONS);
     if (ret == -1)
     {
         DieNowWithMessage("listen", OT_EXIT_ERROR_ERRNO);
     }
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    SuccessOrDie(ot::Posix::Mainloop::Get().Watch(sListenSocket, EPOLLIN | EPOLLPRI, nullptr, nullptr));
+#endif
+
+    sInstance = aInstance;
     otCliInit(aInstance, OutputFormatV, aInstance);
 
 exit:
@@ -191,14 +533,18 @@ exit:
 
 void platformDaemonDisable(void)
 {
-    if (sSessionSocket != -1)
+    for (DaemonSession &session : sSessions)
     {
-        close(sSessionSocket);
-        sSessionSocket = -1;
+        // Best effort to deliver pending output, e.g. the response to `reset`.
+        FlushSession(session);
+        CloseSession(session);
     }
 
     if (sListenSocket != -1)
     {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+        IgnoreReturnValue(ot::Posix::Mainloop::Get().Unwatch(sListenSocket));
+#endif
         close(sListenSocket);
         sListenSocket = -1;
     }
@@ -217,8 +563,34 @@ void platformDaemonDisable(void)
     }
 }
 
+void platformDaemonStateChange(otInstance *aInstance, otChangedFlags aFlags)
+{
+    char buf[64];
+    int  length;
+
+    VerifyOrExit(sListenSocket != -1);
+
+    length = snprintf(buf, sizeof(buf), "State changed: flags 0x%08lx role %s\r\n", static_cast<unsigned long>(aFlags),
+                      DeviceRoleToString(otThreadGetDeviceRole(aInstance)));
+
+    for (DaemonSession &session : sSessions)
+    {
+        if (session.mFd != -1 && session.mSubscribed)
+        {
+            WriteSession(session, buf, static_cast<size_t>(length));
+        }
+    }
+
+exit:
+    return;
+}
+
 void platformDaemonUpdate(otSysMainloopContext *aContext)
 {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    // The sockets are watched by the mainloop, which reports them in the fd sets when they are ready.
+    OT_UNUSED_VARIABLE(aContext);
+#else
     if (sListenSocket != -1)
     {
         FD_SET(sListenSocket, &aContext->mReadFdSet);
@@ -229,16 +601,44 @@ void platformDaemonUpdate(otSysMainloopContext *aContext)
             aContext->mMaxFd = sListenSocket;
         }
     }
+#endif
 
-    if (sSessionSocket != -1)
+    for (DaemonSession &session : sSessions)
     {
-        FD_SET(sSessionSocket, &aContext->mReadFdSet);
-        FD_SET(sSessionSocket, &aContext->mErrorFdSet);
+        if (session.mFd == -1)
+        {
+            continue;
+        }
+
+        // Output queued since the last update, e.g. asynchronous CLI output or state changes.
+        FlushSession(session);
+
+        if (session.mFd == -1)
+        {
+            continue;
+        }
+
+        // Stop reading from a session until its pending output has been written and its pending lines processed.
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+        SuccessOrDie(ot::Posix::Mainloop::Get().Modify(
+            session.mFd, EPOLLPRI | ((session.mOutputLength > 0 || HasInputLine(session)) ? EPOLLOUT : EPOLLIN)));
+#else
+        FD_SET(session.mFd, &aContext->mErrorFdSet);
 
-        if (aContext->mMaxFd < sSessionSocket)
+        if (session.mOutputLength > 0 || HasInputLine(session))
         {
-            aContext->mMaxFd = sSessionSocket;
+            FD_SET(session.mFd, &aContext->mWriteFdSet);
         }
+        else
+        {
+            FD_SET(session.mFd, &aContext->mReadFdSet);
+        }
+
+        if (aContext->mMaxFd < session.mFd)
+        {
+            aContext->mMaxFd = session.mFd;
+        }
+#endif
     }
 
     return;
@@ -246,48 +646,46 @@ void platformDaemonUpdate(otSysMainloopContext *aContext)
 
 void platformDaemonProcess(const otSysMainloopContext *aContext)
 {
-    ssize_t rval;
-
     VerifyOrExit(sListenSocket != -1);
 
     if (FD_ISSET(sListenSocket, &aContext->mErrorFdSet))
     {
         DieNowWithMessage("daemon socket error", OT_EXIT_FAILURE);
     }
-    else if (FD_ISSET(sListenSocket, &aContext->mReadFdSet))
-    {
-        InitializeSessionSocket();
-    }
 
-    VerifyOrExit(sSessionSocket != -1);
-
-    if (FD_ISSET(sSessionSocket, &aContext->mErrorFdSet))
-    {
-        close(sSessionSocket);
-        sSessionSocket = -1;
-    }
-    else if (FD_ISSET(sSessionSocket, &aContext->mReadFdSet))
+    for (DaemonSession &session : sSessions)
     {
-        uint8_t buffer[OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH];
+        int fd = session.mFd;
 
-        rval = read(sSessionSocket, buffer, sizeof(buffer));
+        if (fd == -1)
+        {
+            continue;
+        }
 
-        if (rval > 0)
+        if (FD_ISSET(fd, &aContext->mErrorFdSet))
         {
-            buffer[rval] = '\0';
-            otLogInfoPlat("> %s", reinterpret_cast<const char *>(buffer));
-            otCliInputLine(reinterpret_cast<char *>(buffer));
-            otCliOutputFormat("> ");
+            CloseSession(session);
+            continue;
         }
-        else
+
+        if (FD_ISSET(fd, &aContext->mWriteFdSet))
         {
-            if (rval < 0)
-            {
-                otLogWarnPlat("Daemon read: %s", strerror(errno));
-            }
-            close(sSessionSocket);
-            sSessionSocket = -1;
+            FlushSession(session);
+
+            // Resume processing the lines left over while output was pending.
+            ProcessInput(session);
         }
+
+        if (session.mFd != -1 && FD_ISSET(fd, &aContext->mReadFdSet))
+        {
+            ReadSession(session);
+        }
+    }
+
+    // Accept new sessions last, the fd sets were not populated with their descriptors.
+    if (FD_ISSET(sListenSocket, &aContext->mReadFdSet))
+    {
+        InitializeSessionSocket();
     }
 
 exit:
@@ -59,6 +59,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "posix/platform/mainloop.hpp"
 
 #ifdef __APPLE__
 
@@ -167,6 +168,10 @@ otError HdlcInterface::Init(const RadioUrl &aRadioUrl)
         ExitNow(error = OT_ERROR_INVALID_ARGS);
     }
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    SuccessOrDie(Mainloop::Get().Watch(mSockFd, EPOLLIN, nullptr, nullptr));
+#endif
+
 exit:
     return error;
 }
@@ -180,6 +185,9 @@ void HdlcInterface::Deinit(void)
 {
     VerifyOrExit(mSockFd != -1);
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    IgnoreReturnValue(Mainloop::Get().Unwatch(mSockFd));
+#endif
     VerifyOrExit(0 == close(mSockFd), perror("close RCP"));
     VerifyOrExit(-1 != wait(nullptr) || errno == ECHILD, perror("wait RCP"));
 
@@ -335,12 +343,18 @@ void HdlcInterface::UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, int &aM
     OT_UNUSED_VARIABLE(aWriteFdSet);
     OT_UNUSED_VARIABLE(aTimeout);
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    // The socket is watched by the mainloop, which reports it in the read set when it is readable.
+    OT_UNUSED_VARIABLE(aReadFdSet);
+    OT_UNUSED_VARIABLE(aMaxFd);
+#else
     FD_SET(mSockFd, &aReadFdSet);
 
     if (aMaxFd < mSockFd)
     {
         aMaxFd = mSockFd;
     }
+#endif
 }
 
 void HdlcInterface::Process(const RadioProcessContext &aContext)
@@ -153,6 +153,117 @@ void otSysMainloopProcess(otInstance *aInstance, const otSysMainloopContext *aMa
  */
 const char *otSysGetRadioUrlHelpString(void);
 
+/**
+ * This structure represents the counters of the Thread network interface.
+ *
+ * Transmit counters account for packets read from the interface and sent to the Thread network, receive counters
+ * account for packets received from the Thread network and written to the interface.
+ *
+ */
+typedef struct otSysNetifCounters
+{
+    uint64_t mTxPackets; ///< The number of packets sent to the Thread network.
+    uint64_t mTxBytes;   ///< The number of bytes sent to the Thread network.
+    uint64_t mTxDrops;   ///< The number of packets read from the interface which could not be sent.
+    uint64_t mRxPackets; ///< The number of packets written to the interface.
+    uint64_t mRxBytes;   ///< The number of bytes written to the interface.
+    uint64_t mRxDrops;   ///< The number of packets which could not be written to the interface.
+} otSysNetifCounters;
+
+/**
+ * This function returns the counters of the Thread network interface.
+ *
+ * @note This function is only available when the platform network interface is enabled.
+ *
+ * @returns A pointer to the Thread network interface counters.
+ *
+ */
+const otSysNetifCounters *otSysGetNetifCounters(void);
+
+/**
+ * The number of buckets in the batch size histograms of `otSysTrelCounters`.
+ *
+ * The buckets count system calls which carried 1, 2-3, 4-7, 8-15, and 16 or more packets, respectively.
+ *
+ */
+#define OT_SYS_TREL_BATCH_HISTOGRAM_SIZE 5
+
+/**
+ * This structure represents the counters of the TREL UDP6 platform.
+ *
+ */
+typedef struct otSysTrelCounters
+{
+    uint64_t mTxPackets;  ///< The number of packets sent.
+    uint64_t mTxBytes;    ///< The number of bytes sent.
+    uint64_t mTxRejected; ///< The number of packets rejected because the tx queue was full.
+    uint64_t mTxDrops;    ///< The number of queued packets dropped because they could not be sent.
+    uint64_t mRxPackets;  ///< The number of packets received.
+    uint64_t mRxBytes;    ///< The number of bytes received.
+    uint64_t mRxDrops;    ///< The number of packets dropped because they were larger than the receive buffer.
+    uint32_t mTxBatchSizes[OT_SYS_TREL_BATCH_HISTOGRAM_SIZE]; ///< Histogram of the number of packets per send call.
+    uint32_t mRxBatchSizes[OT_SYS_TREL_BATCH_HISTOGRAM_SIZE]; ///< Histogram of the number of packets per receive call.
+} otSysTrelCounters;
+
+/**
+ * This function returns the counters of the TREL UDP6 platform.
+ *
+ * @note This function is only available when TREL radio link is enabled.
+ *
+ * @returns A pointer to the TREL UDP6 platform counters.
+ *
+ */
+const otSysTrelCounters *otSysGetTrelCounters(void);
+
+/**
+ * The number of buckets in the round-trip time histograms of `otSysRcpPropertyStats`.
+ *
+ * Bucket 0 counts round-trip times shorter than 1 ms, bucket `i` (0 < i < 7) counts round-trip times in
+ * `[2^(i-1), 2^i)` ms, and the last bucket counts round-trip times of 64 ms or longer.
+ *
+ */
+#define OT_SYS_RCP_RTT_HISTOGRAM_SIZE 8
+
+/**
+ * The max number of properties in `otSysRcpRequestStats`.
+ *
+ */
+#define OT_SYS_RCP_MAX_PROPERTY_STATS 32
+
+/**
+ * This structure represents the statistics of the spinel requests to the RCP for a property.
+ *
+ */
+typedef struct otSysRcpPropertyStats
+{
+    uint32_t mKey;                                        ///< The spinel property key.
+    uint32_t mNumResponses;                               ///< The number of responses received.
+    uint32_t mNumAsyncFailures;                           ///< The number of failed sets sent without waiting.
+    uint32_t mMaxRtt;                                     ///< The max round-trip time (in microseconds).
+    uint32_t mRttHistogram[OT_SYS_RCP_RTT_HISTOGRAM_SIZE]; ///< The round-trip time histogram.
+} otSysRcpPropertyStats;
+
+/**
+ * This structure represents the statistics of the spinel requests to the RCP.
+ *
+ */
+typedef struct otSysRcpRequestStats
+{
+    uint32_t              mNumResponses;     ///< The number of responses received.
+    uint32_t              mNumAsyncRequests; ///< The number of property sets sent without waiting for the response.
+    uint32_t              mNumAsyncFailures; ///< The number of property sets sent without waiting which failed.
+    uint8_t               mNumProperties;    ///< The number of entries in `mProperties`.
+    otSysRcpPropertyStats mProperties[OT_SYS_RCP_MAX_PROPERTY_STATS]; ///< The statistics of each property.
+} otSysRcpRequestStats;
+
+/**
+ * This function gets the statistics of the spinel requests to the RCP.
+ *
+ * @param[out]  aStats  A pointer to where the statistics are placed.
+ *
+ */
+void otSysGetRcpRequestStats(otSysRcpRequestStats *aStats);
+
 extern otPlatResetReason gPlatResetReason;
 
 #ifdef __cplusplus
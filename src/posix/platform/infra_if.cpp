@@ -58,6 +58,7 @@
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "lib/platform/exit_code.h"
+#include "posix/platform/mainloop.hpp"
 
 static char     sInfraIfName[IFNAMSIZ];
 static uint32_t sInfraIfIndex       = 0;
@@ -268,6 +269,11 @@ uint32_t platformInfraIfInit(otInstance *aInstance, const char *aIfName)
 
     sNetLinkSocket = CreateNetLinkSocket();
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    SuccessOrDie(ot::Posix::Mainloop::Get().Watch(sInfraIfIcmp6Socket, EPOLLIN, nullptr, nullptr));
+    SuccessOrDie(ot::Posix::Mainloop::Get().Watch(sNetLinkSocket, EPOLLIN, nullptr, nullptr));
+#endif
+
     return sInfraIfIndex;
 }
 
@@ -275,12 +281,18 @@ void platformInfraIfDeinit(void)
 {
     if (sInfraIfIcmp6Socket != -1)
     {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+        IgnoreReturnValue(ot::Posix::Mainloop::Get().Unwatch(sInfraIfIcmp6Socket));
+#endif
         close(sInfraIfIcmp6Socket);
         sInfraIfIcmp6Socket = -1;
     }
 
     if (sNetLinkSocket != -1)
     {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+        IgnoreReturnValue(ot::Posix::Mainloop::Get().Unwatch(sNetLinkSocket));
+#endif
         close(sNetLinkSocket);
         sNetLinkSocket = -1;
     }
@@ -293,11 +305,17 @@ void platformInfraIfUpdateFdSet(fd_set &aReadFdSet, int &aMaxFd)
     VerifyOrExit(sInfraIfIcmp6Socket != -1);
     VerifyOrExit(sNetLinkSocket != -1);
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    // The sockets are watched by the mainloop, which reports them in the read set when they are readable.
+    OT_UNUSED_VARIABLE(aReadFdSet);
+    OT_UNUSED_VARIABLE(aMaxFd);
+#else
     FD_SET(sInfraIfIcmp6Socket, &aReadFdSet);
     aMaxFd = OT_MAX(aMaxFd, sInfraIfIcmp6Socket);
 
     FD_SET(sNetLinkSocket, &aReadFdSet);
     aMaxFd = OT_MAX(aMaxFd, sNetLinkSocket);
+#endif
 
 exit:
     return;
@@ -33,43 +33,454 @@
 #include <stdarg.h>
 #include <syslog.h>
 
+#if OPENTHREAD_POSIX_CONFIG_LOG_DEFERRED_ENABLE
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <atomic>
+#endif
+
 #include <openthread/platform/logging.h>
 
+#include "common/code_utils.hpp"
+
 #if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED
-void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...)
-{
-    OT_UNUSED_VARIABLE(aLogRegion);
 
-    va_list args;
+static int logLevelToPriority(otLogLevel aLogLevel)
+{
+    int priority;
 
     switch (aLogLevel)
     {
     case OT_LOG_LEVEL_NONE:
-        aLogLevel = LOG_ALERT;
+        priority = LOG_ALERT;
         break;
     case OT_LOG_LEVEL_CRIT:
-        aLogLevel = LOG_CRIT;
+        priority = LOG_CRIT;
         break;
     case OT_LOG_LEVEL_WARN:
-        aLogLevel = LOG_WARNING;
+        priority = LOG_WARNING;
         break;
     case OT_LOG_LEVEL_NOTE:
-        aLogLevel = LOG_NOTICE;
+        priority = LOG_NOTICE;
         break;
     case OT_LOG_LEVEL_INFO:
-        aLogLevel = LOG_INFO;
+        priority = LOG_INFO;
         break;
     case OT_LOG_LEVEL_DEBG:
-        aLogLevel = LOG_DEBUG;
+        priority = LOG_DEBUG;
         break;
     default:
         assert(false);
-        aLogLevel = LOG_DEBUG;
+        priority = LOG_DEBUG;
         break;
     }
 
+    return priority;
+}
+
+#if OPENTHREAD_POSIX_CONFIG_LOG_DEFERRED_ENABLE
+
+/*
+ * Deferred logging.
+ *
+ * Log lines are formatted by the calling thread into a slot of a bounded lock-free ring and written to syslog by a
+ * writer thread, so the mainloop never blocks on the syslog socket or on stderr. Each slot carries a sequence number
+ * which tells whether it is free for the producer owning ring position `n` (sequence `n`) or holds a line ready for
+ * the writer (sequence `n + 1`). When the ring is full the line is dropped and counted, and the writer reports the
+ * number of dropped lines once it catches up.
+ *
+ * As syslog stamps a line with the time it is written out, the time of the event is captured with the line and written
+ * as a `[hh:mm:ss.uuuuuu]` prefix.
+ *
+ */
+
+enum
+{
+    kLogRingSize = OPENTHREAD_POSIX_CONFIG_LOG_DEFERRED_RING_SIZE,
+    kLogLineSize = OPENTHREAD_CONFIG_LOG_MAX_SIZE + sizeof(OPENTHREAD_CONFIG_LOG_SUFFIX),
+};
+
+static_assert((kLogRingSize & (kLogRingSize - 1)) == 0, "OPENTHREAD_POSIX_CONFIG_LOG_DEFERRED_RING_SIZE is invalid");
+
+struct LogRecord
+{
+    std::atomic<uint32_t> mSequence;
+    int                   mPriority;
+    struct timespec       mTime;
+    char                  mLine[kLogLineSize];
+};
+
+static LogRecord             sLogRing[kLogRingSize];
+static std::atomic<uint32_t> sLogHead;
+static uint32_t              sLogTail;
+static std::atomic<uint32_t> sLogDroppedCount;
+static std::atomic<bool>     sLogWriterWaiting;
+static std::atomic<bool>     sLogStopped;
+static pthread_once_t        sLogOnce  = PTHREAD_ONCE_INIT;
+static pthread_mutex_t       sLogMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t        sLogCond  = PTHREAD_COND_INITIALIZER;
+static pthread_t             sLogWriter;
+
+static bool logRecordIsReady(uint32_t aPosition)
+{
+    return sLogRing[aPosition % kLogRingSize].mSequence.load() == aPosition + 1;
+}
+
+static void *logWriterMain(void *aContext)
+{
+    uint32_t reportedDroppedCount = 0;
+    uint32_t droppedCount;
+
+    OT_UNUSED_VARIABLE(aContext);
+
+    while (true)
+    {
+        LogRecord &record = sLogRing[sLogTail % kLogRingSize];
+
+        if (logRecordIsReady(sLogTail))
+        {
+            struct tm time;
+
+            localtime_r(&record.mTime.tv_sec, &time);
+            syslog(record.mPriority, "[%02d:%02d:%02d.%06ld] %s", time.tm_hour, time.tm_min, time.tm_sec,
+                   record.mTime.tv_nsec / 1000, record.mLine);
+            record.mSequence.store(sLogTail + kLogRingSize, std::memory_order_release);
+            sLogTail++;
+            continue;
+        }
+
+        droppedCount = sLogDroppedCount.load(std::memory_order_relaxed);
+
+        if (droppedCount != reportedDroppedCount)
+        {
+            syslog(LOG_WARNING, "%u log lines dropped", droppedCount - reportedDroppedCount);
+            reportedDroppedCount = droppedCount;
+        }
+
+        if (sLogStopped.load())
+        {
+            break;
+        }
+
+        // Producers only take the mutex to signal the writer while it is waiting, so the ring is checked again after
+        // announcing the wait to not miss a line pushed in between.
+        pthread_mutex_lock(&sLogMutex);
+        sLogWriterWaiting.store(true);
+
+        if (!logRecordIsReady(sLogTail) && !sLogStopped.load())
+        {
+            pthread_cond_wait(&sLogCond, &sLogMutex);
+        }
+
+        sLogWriterWaiting.store(false);
+        pthread_mutex_unlock(&sLogMutex);
+    }
+
+    return nullptr;
+}
+
+static void logWriterWake(void)
+{
+    pthread_mutex_lock(&sLogMutex);
+    pthread_cond_signal(&sLogCond);
+    pthread_mutex_unlock(&sLogMutex);
+}
+
+static void logWriterStop(void)
+{
+    VerifyOrExit(!sLogStopped.exchange(true));
+
+    logWriterWake();
+    pthread_join(sLogWriter, nullptr);
+
+exit:
+    return;
+}
+
+static void logWriterStopInChild(void)
+{
+    // The writer thread does not exist in a forked child, which logs synchronously.
+    sLogStopped.store(true);
+}
+
+static void logWriterStart(void)
+{
+    for (uint32_t i = 0; i < kLogRingSize; i++)
+    {
+        sLogRing[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+
+    if (pthread_create(&sLogWriter, nullptr, logWriterMain, nullptr) != 0)
+    {
+        sLogStopped.store(true);
+        ExitNow();
+    }
+
+    pthread_atfork(nullptr, nullptr, logWriterStopInChild);
+    atexit(logWriterStop);
+
+exit:
+    return;
+}
+
+static void logDeferred(int aPriority, const char *aFormat, va_list aArgs)
+{
+    uint32_t        position;
+    LogRecord *     record;
+    struct timespec now;
+
+    clock_gettime(CLOCK_REALTIME, &now);
+    pthread_once(&sLogOnce, logWriterStart);
+
+    if (sLogStopped.load(std::memory_order_relaxed))
+    {
+        vsyslog(aPriority, aFormat, aArgs);
+        ExitNow();
+    }
+
+    position = sLogHead.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        int32_t diff;
+
+        record = &sLogRing[position % kLogRingSize];
+        diff   = static_cast<int32_t>(record->mSequence.load(std::memory_order_acquire) - position);
+
+        if (diff == 0)
+        {
+            if (sLogHead.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            sLogDroppedCount.fetch_add(1, std::memory_order_relaxed);
+            ExitNow();
+        }
+        else
+        {
+            position = sLogHead.load(std::memory_order_relaxed);
+        }
+    }
+
+    record->mPriority = aPriority;
+    record->mTime     = now;
+    vsnprintf(record->mLine, sizeof(record->mLine), aFormat, aArgs);
+    record->mSequence.store(position + 1);
+
+    if (sLogWriterWaiting.load())
+    {
+        logWriterWake();
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_POSIX_CONFIG_LOG_DEFERRED_ENABLE
+
+void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...)
+{
+    OT_UNUSED_VARIABLE(aLogRegion);
+
+    va_list args;
+
     va_start(args, aFormat);
-    vsyslog(aLogLevel, aFormat, args);
+#if OPENTHREAD_POSIX_CONFIG_LOG_DEFERRED_ENABLE
+    logDeferred(logLevelToPriority(aLogLevel), aFormat, args);
+#else
+    vsyslog(logLevelToPriority(aLogLevel), aFormat, args);
+#endif
     va_end(args);
 }
+
+#if SELF_TEST && OPENTHREAD_POSIX_CONFIG_LOG_DEFERRED_ENABLE
+
+#include <unistd.h>
+
+static const char kSelfTestMarker[] = "self-test";
+static const int  kNumBursts        = 200;
+static const int  kBurstLength      = 64;
+static const int  kBurstGapUs       = 2000;
+static const int  kNumLines         = kNumBursts * kBurstLength;
+static const int  kNumFloodLines    = kLogRingSize * 4;
+static const int  kNumQueuedLines   = kLogRingSize / 2;
+
+static uint64_t selfTestGetNow(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL + static_cast<uint64_t>(now.tv_nsec);
+}
+
+static void selfTestLog(bool aDeferred, const char *aFormat, ...)
+{
+    va_list args;
+
+    va_start(args, aFormat);
+
+    if (aDeferred)
+    {
+        logDeferred(LOG_DEBUG, aFormat, args);
+    }
+    else
+    {
+        vsyslog(LOG_DEBUG, aFormat, args);
+    }
+
+    va_end(args);
+}
+
+static void selfTestBenchmark(const char *aName, bool aDeferred)
+{
+    uint32_t droppedCount = sLogDroppedCount.load();
+    uint64_t totalLatency = 0;
+    uint64_t maxLatency   = 0;
+
+    // Bursts of debug level lines, as logged for a burst of received frames, with mainloop idle time in between.
+    for (int i = 0; i < kNumBursts; i++)
+    {
+        for (int j = 0; j < kBurstLength; j++)
+        {
+            uint64_t start = selfTestGetNow();
+            uint64_t latency;
+
+            selfTestLog(aDeferred, "[DEBG]-MAC-----: %s: Frame rx, len:%d, seqnum:%d, type:Data, sec:yes, rss:-%d",
+                        kSelfTestMarker, 40 + j, i * kBurstLength + j, 50 + j % 30);
+
+            latency = selfTestGetNow() - start;
+            totalLatency += latency;
+            maxLatency = (latency > maxLatency) ? latency : maxLatency;
+        }
+
+        usleep(kBurstGapUs);
+    }
+
+    printf("%-8s %d lines in bursts of %d: latency avg %6.2f us, max %8.2f us, %u dropped\n", aName, kNumLines,
+           kBurstLength, static_cast<double>(totalLatency) / kNumLines / 1000, static_cast<double>(maxLatency) / 1000,
+           sLogDroppedCount.load() - droppedCount);
+}
+
+static uint64_t selfTestGetMicrosecondOfDay(const struct timespec &aTime)
+{
+    struct tm time;
+
+    localtime_r(&aTime.tv_sec, &time);
+
+    return ((time.tm_hour * 60ULL + time.tm_min) * 60 + time.tm_sec) * 1000000 +
+           static_cast<uint64_t>(aTime.tv_nsec) / 1000;
+}
+
+static const char      kSelfTestEventMarker[] = "self-test: event";
+static struct timespec sSelfTestEventBefore;
+static struct timespec sSelfTestEventAfter;
+
+static void selfTestLogEvent(void)
+{
+    // Let the writer catch up so the event line is not dropped, then queue lines ahead of the event line so the
+    // writer writes it out some time after it is logged.
+    usleep(100 * 1000);
+
+    for (int i = 0; i < kNumQueuedLines; i++)
+    {
+        selfTestLog(true, "%s: queued %d", kSelfTestMarker, i);
+    }
+
+    clock_gettime(CLOCK_REALTIME, &sSelfTestEventBefore);
+    selfTestLog(true, "%s", kSelfTestEventMarker);
+    clock_gettime(CLOCK_REALTIME, &sSelfTestEventAfter);
+}
+
+static void selfTestVerifyEventTime(FILE *aFile)
+{
+    // The event line carries the time it was logged at, whenever the writer wrote it out.
+    char     line[kLogLineSize + 64];
+    uint64_t before = selfTestGetMicrosecondOfDay(sSelfTestEventBefore);
+    uint64_t after  = selfTestGetMicrosecondOfDay(sSelfTestEventAfter);
+    bool     found  = false;
+
+    rewind(aFile);
+
+    while (fgets(line, sizeof(line), aFile) != nullptr)
+    {
+        const char *  prefix = strchr(line, '[');
+        unsigned int  hour, minute, second;
+        unsigned long microsecond;
+        uint64_t      eventTime;
+
+        if (strstr(line, kSelfTestEventMarker) == nullptr)
+        {
+            continue;
+        }
+
+        assert(prefix != nullptr);
+        assert(sscanf(prefix, "[%u:%u:%u.%lu]", &hour, &minute, &second, &microsecond) == 4);
+        eventTime = ((hour * 60ULL + minute) * 60 + second) * 1000000 + microsecond;
+
+        // The check is skipped when the line was logged across midnight.
+        assert(before > after || (before <= eventTime && eventTime <= after));
+        found = true;
+    }
+
+    assert(found);
+}
+
+static int selfTestCountLines(FILE *aFile)
+{
+    char line[kLogLineSize + 64];
+    int  count = 0;
+
+    rewind(aFile);
+
+    while (fgets(line, sizeof(line), aFile) != nullptr)
+    {
+        count += (strstr(line, kSelfTestMarker) != nullptr) ? 1 : 0;
+    }
+
+    return count;
+}
+
+int main(void)
+{
+    FILE *output = tmpfile();
+
+    assert(output != nullptr);
+    assert(dup2(fileno(output), STDERR_FILENO) == STDERR_FILENO);
+    openlog("test-logging", LOG_PERROR, LOG_USER);
+
+    selfTestBenchmark("sync", false);
+    selfTestBenchmark("deferred", true);
+    selfTestLogEvent();
+
+    // Lines pushed faster than the writer can ship them are dropped and counted.
+    for (int i = 0; i < kNumFloodLines; i++)
+    {
+        selfTestLog(true, "%s: flood %d", kSelfTestMarker, i);
+    }
+
+    // Stopping the writer flushes the ring, so every line not counted as dropped is written out.
+    logWriterStop();
+    selfTestVerifyEventTime(output);
+    assert(selfTestCountLines(output) + static_cast<int>(sLogDroppedCount.load()) ==
+           2 * kNumLines + kNumFloodLines + kNumQueuedLines + 1);
+
+    // Once the writer is stopped lines are written synchronously.
+    otPlatLog(OT_LOG_LEVEL_DEBG, OT_LOG_REGION_PLATFORM, "%s: after stop", kSelfTestMarker);
+    assert(selfTestCountLines(output) + static_cast<int>(sLogDroppedCount.load()) ==
+           2 * kNumLines + kNumFloodLines + kNumQueuedLines + 2);
+
+    printf("%u lines dropped in total\n", sLogDroppedCount.load());
+    printf("Logging tests passed\n");
+
+    return 0;
+}
+
+#endif // SELF_TEST && OPENTHREAD_POSIX_CONFIG_LOG_DEFERRED_ENABLE
+
 #endif // OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED
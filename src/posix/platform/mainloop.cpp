@@ -0,0 +1,602 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the epoll based mainloop of the posix platform.
+ */
+
+#include "mainloop.hpp"
+#include "platform-posix.h"
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/select.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+
+#ifndef SELF_TEST
+#define SELF_TEST 0
+#endif
+
+namespace ot {
+namespace Posix {
+
+Mainloop Mainloop::sMainloop;
+
+Mainloop::Mainloop(void)
+    : mEpollFd(-1)
+    , mNumEvents(0)
+{
+    for (Watcher &watcher : mWatchers)
+    {
+        watcher.mFd = -1;
+    }
+}
+
+otError Mainloop::Init(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mEpollFd < 0);
+
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrExit(mEpollFd >= 0, error = OT_ERROR_FAILED);
+
+exit:
+    return error;
+}
+
+void Mainloop::Deinit(void)
+{
+    VerifyOrExit(mEpollFd >= 0);
+
+    close(mEpollFd);
+    mEpollFd   = -1;
+    mNumEvents = 0;
+
+    for (Watcher &watcher : mWatchers)
+    {
+        watcher.mFd = -1;
+    }
+
+exit:
+    return;
+}
+
+Mainloop::Watcher *Mainloop::FindWatcher(int aFd)
+{
+    Watcher *found = nullptr;
+
+    for (Watcher &watcher : mWatchers)
+    {
+        if (watcher.mFd == aFd)
+        {
+            found = &watcher;
+            break;
+        }
+    }
+
+    return found;
+}
+
+otError Mainloop::Watch(int aFd, uint32_t aEvents, Handler aHandler, void *aContext)
+{
+    otError            error = OT_ERROR_NONE;
+    Watcher *          watcher;
+    struct epoll_event event;
+
+    VerifyOrExit(mEpollFd >= 0, error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(aFd >= 0, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(FindWatcher(aFd) == nullptr, error = OT_ERROR_ALREADY);
+
+    watcher = FindWatcher(-1);
+    VerifyOrExit(watcher != nullptr, error = OT_ERROR_NO_BUFS);
+
+    memset(&event, 0, sizeof(event));
+    event.events   = aEvents;
+    event.data.ptr = watcher;
+    VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, aFd, &event) == 0, error = OT_ERROR_FAILED);
+
+    watcher->mFd      = aFd;
+    watcher->mEvents  = aEvents;
+    watcher->mHandler = aHandler;
+    watcher->mContext = aContext;
+
+exit:
+    return error;
+}
+
+otError Mainloop::Modify(int aFd, uint32_t aEvents)
+{
+    otError            error   = OT_ERROR_NONE;
+    Watcher *          watcher = (aFd >= 0) ? FindWatcher(aFd) : nullptr;
+    struct epoll_event event;
+
+    VerifyOrExit(watcher != nullptr, error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(watcher->mEvents != aEvents);
+
+    memset(&event, 0, sizeof(event));
+    event.events   = aEvents;
+    event.data.ptr = watcher;
+    VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_MOD, aFd, &event) == 0, error = OT_ERROR_FAILED);
+
+    watcher->mEvents = aEvents;
+
+exit:
+    return error;
+}
+
+otError Mainloop::Unwatch(int aFd)
+{
+    otError  error   = OT_ERROR_NONE;
+    Watcher *watcher = (aFd >= 0) ? FindWatcher(aFd) : nullptr;
+
+    VerifyOrExit(watcher != nullptr, error = OT_ERROR_NOT_FOUND);
+
+    IgnoreReturnValue(epoll_ctl(mEpollFd, EPOLL_CTL_DEL, aFd, nullptr));
+    watcher->mFd = -1;
+
+    // Drop the pending events of the watcher, the slot may be reused before `Process()` reaches them.
+    for (int i = 0; i < mNumEvents; i++)
+    {
+        if (mEvents[i].data.ptr == watcher)
+        {
+            mEvents[i].data.ptr = nullptr;
+        }
+    }
+
+exit:
+    return error;
+}
+
+void Mainloop::UpdateFdSet(otSysMainloopContext &aMainloop) const
+{
+    assert(mEpollFd >= 0);
+
+    FD_SET(mEpollFd, &aMainloop.mReadFdSet);
+
+    if (aMainloop.mMaxFd < mEpollFd)
+    {
+        aMainloop.mMaxFd = mEpollFd;
+    }
+}
+
+bool Mainloop::HasOtherFds(const otSysMainloopContext &aMainloop) const
+{
+    bool hasOtherFds = (aMainloop.mMaxFd > mEpollFd) || FD_ISSET(mEpollFd, &aMainloop.mWriteFdSet) ||
+                       FD_ISSET(mEpollFd, &aMainloop.mErrorFdSet);
+
+    for (int fd = 0; !hasOtherFds && fd < mEpollFd; fd++)
+    {
+        hasOtherFds = FD_ISSET(fd, &aMainloop.mReadFdSet) || FD_ISSET(fd, &aMainloop.mWriteFdSet) ||
+                      FD_ISSET(fd, &aMainloop.mErrorFdSet);
+    }
+
+    return hasOtherFds;
+}
+
+int Mainloop::Poll(otSysMainloopContext &aMainloop)
+{
+    int rval;
+
+    mNumEvents = 0;
+
+    UpdateFdSet(aMainloop);
+
+    if (!HasOtherFds(aMainloop))
+    {
+        uint64_t timeout = static_cast<uint64_t>(aMainloop.mTimeout.tv_sec) * US_PER_S +
+                           static_cast<uint64_t>(aMainloop.mTimeout.tv_usec);
+
+        // Round up so that a deadline is never missed by waking up (and busy looping) early.
+        timeout = (timeout + US_PER_MS - 1) / US_PER_MS;
+
+        rval = epoll_wait(mEpollFd, mEvents, kMaxEvents, (timeout > INT32_MAX) ? INT32_MAX : static_cast<int>(timeout));
+
+        if (rval > 0)
+        {
+            mNumEvents = rval;
+            rval       = 1;
+        }
+        else
+        {
+            FD_CLR(mEpollFd, &aMainloop.mReadFdSet);
+        }
+    }
+    else
+    {
+        rval = select(aMainloop.mMaxFd + 1, &aMainloop.mReadFdSet, &aMainloop.mWriteFdSet, &aMainloop.mErrorFdSet,
+                      &aMainloop.mTimeout);
+    }
+
+    return rval;
+}
+
+void Mainloop::ReportEvents(const Watcher &aWatcher, uint32_t aEvents, otSysMainloopContext &aMainloop)
+{
+    if ((aWatcher.mEvents & EPOLLIN) && (aEvents & (EPOLLIN | EPOLLERR | EPOLLHUP)))
+    {
+        FD_SET(aWatcher.mFd, &aMainloop.mReadFdSet);
+    }
+
+    if ((aWatcher.mEvents & EPOLLOUT) && (aEvents & (EPOLLOUT | EPOLLERR | EPOLLHUP)))
+    {
+        FD_SET(aWatcher.mFd, &aMainloop.mWriteFdSet);
+    }
+
+    if ((aWatcher.mEvents & EPOLLPRI) && (aEvents & EPOLLPRI))
+    {
+        FD_SET(aWatcher.mFd, &aMainloop.mErrorFdSet);
+    }
+
+    if (aMainloop.mMaxFd < aWatcher.mFd)
+    {
+        aMainloop.mMaxFd = aWatcher.mFd;
+    }
+}
+
+void Mainloop::Process(otSysMainloopContext &aMainloop)
+{
+    VerifyOrExit(mEpollFd >= 0 && FD_ISSET(mEpollFd, &aMainloop.mReadFdSet));
+
+    if (mNumEvents == 0)
+    {
+        // The fd_sets were polled by the embedder (e.g. with its own `select()`) rather than by `Poll()`.
+        mNumEvents = epoll_wait(mEpollFd, mEvents, kMaxEvents, 0);
+        VerifyOrExit(mNumEvents > 0);
+    }
+
+    for (int i = 0; i < mNumEvents; i++)
+    {
+        Watcher *watcher = static_cast<Watcher *>(mEvents[i].data.ptr);
+
+        if (watcher == nullptr)
+        {
+            continue;
+        }
+
+        if (watcher->mHandler != nullptr)
+        {
+            watcher->mHandler(watcher->mContext, mEvents[i].events);
+        }
+        else
+        {
+            ReportEvents(*watcher, mEvents[i].events, aMainloop);
+        }
+    }
+
+exit:
+    mNumEvents = 0;
+}
+
+} // namespace Posix
+} // namespace ot
+
+#if SELF_TEST
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <time.h>
+
+using ot::Posix::Mainloop;
+
+static const int kNumIdleFds    = 256;
+static const int kNumIterations = 20000;
+static const int kNumSamples    = 2000;
+static const int kSampleGapUs   = 200;
+
+static int      sIdlePipes[kNumIdleFds][2];
+static int      sActivePipe[2];
+static uint32_t sNumHandled;
+static uint64_t sTotalLatency;
+static uint64_t sMaxLatency;
+
+static uint64_t selfTestGetNow(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL + static_cast<uint64_t>(now.tv_nsec);
+}
+
+static void selfTestReadActive(void)
+{
+    uint64_t sent;
+    uint64_t latency;
+
+    while (read(sActivePipe[0], &sent, sizeof(sent)) == sizeof(sent))
+    {
+        latency = selfTestGetNow() - sent;
+        sTotalLatency += latency;
+        sMaxLatency = (latency > sMaxLatency) ? latency : sMaxLatency;
+        sNumHandled++;
+    }
+}
+
+static void selfTestHandleActive(void *aContext, uint32_t aEvents)
+{
+    assert(aContext == &sActivePipe);
+    assert(aEvents & EPOLLIN);
+    OT_UNUSED_VARIABLE(aContext);
+    OT_UNUSED_VARIABLE(aEvents);
+
+    selfTestReadActive();
+}
+
+static void selfTestHandleIdle(void *aContext, uint32_t aEvents)
+{
+    OT_UNUSED_VARIABLE(aContext);
+    OT_UNUSED_VARIABLE(aEvents);
+
+    assert(false);
+}
+
+static void selfTestWrite(void)
+{
+    uint64_t now = selfTestGetNow();
+
+    assert(write(sActivePipe[1], &now, sizeof(now)) == sizeof(now));
+}
+
+static void *selfTestWriter(void *aContext)
+{
+    OT_UNUSED_VARIABLE(aContext);
+
+    for (int i = 0; i < kNumSamples; i++)
+    {
+        usleep(kSampleGapUs);
+        selfTestWrite();
+    }
+
+    return nullptr;
+}
+
+/**
+ * This function runs one iteration of a select() based mainloop, where every module adds its file descriptors to the
+ * fd_sets and checks them after select() returns.
+ *
+ */
+static void selfTestSelectIteration(void)
+{
+    otSysMainloopContext mainloop;
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+    mainloop.mMaxFd           = -1;
+    mainloop.mTimeout.tv_sec  = 1;
+    mainloop.mTimeout.tv_usec = 0;
+
+    for (int(&idlePipe)[2] : sIdlePipes)
+    {
+        FD_SET(idlePipe[0], &mainloop.mReadFdSet);
+        FD_SET(idlePipe[0], &mainloop.mErrorFdSet);
+        mainloop.mMaxFd = (idlePipe[0] > mainloop.mMaxFd) ? idlePipe[0] : mainloop.mMaxFd;
+    }
+
+    FD_SET(sActivePipe[0], &mainloop.mReadFdSet);
+    FD_SET(sActivePipe[0], &mainloop.mErrorFdSet);
+    mainloop.mMaxFd = (sActivePipe[0] > mainloop.mMaxFd) ? sActivePipe[0] : mainloop.mMaxFd;
+
+    assert(select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                  &mainloop.mTimeout) > 0);
+
+    for (int(&idlePipe)[2] : sIdlePipes)
+    {
+        assert(!FD_ISSET(idlePipe[0], &mainloop.mReadFdSet));
+        assert(!FD_ISSET(idlePipe[0], &mainloop.mErrorFdSet));
+        OT_UNUSED_VARIABLE(idlePipe);
+    }
+
+    if (FD_ISSET(sActivePipe[0], &mainloop.mReadFdSet))
+    {
+        selfTestReadActive();
+    }
+}
+
+static void selfTestEpollIteration(void)
+{
+    otSysMainloopContext mainloop;
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+    mainloop.mMaxFd           = -1;
+    mainloop.mTimeout.tv_sec  = 1;
+    mainloop.mTimeout.tv_usec = 0;
+
+    assert(Mainloop::Get().Poll(mainloop) > 0);
+    Mainloop::Get().Process(mainloop);
+}
+
+static void selfTestBenchmark(const char *aName, void (*aIteration)(void))
+{
+    uint64_t  start;
+    uint64_t  elapsed;
+    pthread_t writer;
+
+    // Wake-up cost: the active file descriptor is always ready when polling.
+    sNumHandled = 0;
+    start       = selfTestGetNow();
+
+    for (int i = 0; i < kNumIterations; i++)
+    {
+        selfTestWrite();
+        aIteration();
+    }
+
+    elapsed = selfTestGetNow() - start;
+    assert(sNumHandled == kNumIterations);
+
+    // Wake-up latency: another thread writes to the active file descriptor while the mainloop is waiting.
+    sNumHandled   = 0;
+    sTotalLatency = 0;
+    sMaxLatency   = 0;
+    assert(pthread_create(&writer, nullptr, selfTestWriter, nullptr) == 0);
+
+    while (sNumHandled < kNumSamples)
+    {
+        aIteration();
+    }
+
+    assert(pthread_join(writer, nullptr) == 0);
+
+    printf("%-6s with %d idle fds: %6.2f us/iteration, latency avg %6.2f us, max %7.2f us\n", aName, kNumIdleFds,
+           static_cast<double>(elapsed) / kNumIterations / 1000,
+           static_cast<double>(sTotalLatency) / kNumSamples / 1000, static_cast<double>(sMaxLatency) / 1000);
+}
+
+static uint32_t sNumUnwatchHandled;
+
+static void selfTestHandleUnwatch(void *aContext, uint32_t aEvents)
+{
+    int *fds = static_cast<int *>(aContext);
+
+    OT_UNUSED_VARIABLE(aEvents);
+
+    // Unwatching the other file descriptor must discard its pending event.
+    assert(Mainloop::Get().Unwatch(fds[0]) == OT_ERROR_NONE);
+    assert(Mainloop::Get().Unwatch(fds[1]) == OT_ERROR_NONE);
+    sNumUnwatchHandled++;
+}
+
+static void selfTestMainloop(void)
+{
+    Mainloop &           mainloop = Mainloop::Get();
+    otSysMainloopContext context;
+    int                  pipes[2][2];
+    int                  readFds[2];
+
+    assert(pipe(pipes[0]) == 0 && pipe(pipes[1]) == 0);
+    readFds[0] = pipes[0][0];
+    readFds[1] = pipes[1][0];
+
+    assert(mainloop.Watch(readFds[0], EPOLLIN, selfTestHandleUnwatch, readFds) == OT_ERROR_NONE);
+    assert(mainloop.Watch(readFds[0], EPOLLIN, selfTestHandleUnwatch, readFds) == OT_ERROR_ALREADY);
+    assert(mainloop.Watch(readFds[1], EPOLLIN, selfTestHandleUnwatch, readFds) == OT_ERROR_NONE);
+    assert(write(pipes[0][1], "a", 1) == 1 && write(pipes[1][1], "b", 1) == 1);
+
+    // A legacy file descriptor in the fd_sets is reported together with the watched ones.
+    FD_ZERO(&context.mReadFdSet);
+    FD_ZERO(&context.mWriteFdSet);
+    FD_ZERO(&context.mErrorFdSet);
+    FD_SET(pipes[0][1], &context.mWriteFdSet);
+    context.mMaxFd           = pipes[0][1];
+    context.mTimeout.tv_sec  = 1;
+    context.mTimeout.tv_usec = 0;
+
+    assert(mainloop.Poll(context) == 2);
+    assert(FD_ISSET(pipes[0][1], &context.mWriteFdSet));
+    mainloop.Process(context);
+    assert(sNumUnwatchHandled == 1);
+    assert(mainloop.Unwatch(readFds[0]) == OT_ERROR_NOT_FOUND);
+
+    // The timeout expires when nothing is ready.
+    FD_ZERO(&context.mReadFdSet);
+    FD_ZERO(&context.mWriteFdSet);
+    context.mMaxFd           = -1;
+    context.mTimeout.tv_sec  = 0;
+    context.mTimeout.tv_usec = 1000;
+    assert(mainloop.Poll(context) == 0);
+
+    // A file descriptor watched without a handler is reported in the fd_sets.
+    assert(mainloop.Watch(readFds[0], EPOLLIN | EPOLLPRI, nullptr, nullptr) == OT_ERROR_NONE);
+    assert(write(pipes[0][1], "c", 1) == 1);
+    FD_ZERO(&context.mReadFdSet);
+    FD_ZERO(&context.mErrorFdSet);
+    context.mMaxFd           = -1;
+    context.mTimeout.tv_sec  = 1;
+    context.mTimeout.tv_usec = 0;
+    assert(mainloop.Poll(context) == 1);
+    mainloop.Process(context);
+    assert(FD_ISSET(readFds[0], &context.mReadFdSet));
+    assert(!FD_ISSET(readFds[0], &context.mErrorFdSet));
+    assert(context.mMaxFd >= readFds[0]);
+    assert(mainloop.Unwatch(readFds[0]) == OT_ERROR_NONE);
+
+    // An embedder waiting with its own `select()` on the context wakes up for a watched file descriptor.
+    assert(mainloop.Watch(readFds[0], EPOLLIN, selfTestHandleUnwatch, readFds) == OT_ERROR_NONE);
+    assert(mainloop.Watch(readFds[1], EPOLLIN, selfTestHandleUnwatch, readFds) == OT_ERROR_NONE);
+    FD_ZERO(&context.mReadFdSet);
+    context.mMaxFd           = -1;
+    context.mTimeout.tv_sec  = 1;
+    context.mTimeout.tv_usec = 0;
+    mainloop.UpdateFdSet(context);
+    assert(context.mMaxFd >= 0);
+    assert(select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                  &context.mTimeout) == 1);
+    mainloop.Process(context);
+    assert(sNumUnwatchHandled == 2);
+
+    for (int(&fds)[2] : pipes)
+    {
+        close(fds[0]);
+        close(fds[1]);
+    }
+}
+
+int main(void)
+{
+    assert(Mainloop::Get().Init() == OT_ERROR_NONE);
+
+    selfTestMainloop();
+
+    for (int(&idlePipe)[2] : sIdlePipes)
+    {
+        assert(pipe(idlePipe) == 0);
+    }
+
+    assert(pipe2(sActivePipe, O_NONBLOCK) == 0);
+
+    selfTestBenchmark("select", selfTestSelectIteration);
+
+    for (int(&idlePipe)[2] : sIdlePipes)
+    {
+        assert(Mainloop::Get().Watch(idlePipe[0], EPOLLIN, selfTestHandleIdle, nullptr) == OT_ERROR_NONE);
+    }
+
+    assert(Mainloop::Get().Watch(sActivePipe[0], EPOLLIN, selfTestHandleActive, &sActivePipe) == OT_ERROR_NONE);
+
+    selfTestBenchmark("epoll", selfTestEpollIteration);
+
+    Mainloop::Get().Deinit();
+    printf("Mainloop tests passed\n");
+
+    return 0;
+}
+
+#endif // SELF_TEST
+
+#endif // OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
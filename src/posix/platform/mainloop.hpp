@@ -0,0 +1,230 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the epoll based mainloop of the posix platform.
+ */
+
+#ifndef OT_POSIX_PLATFORM_MAINLOOP_HPP_
+#define OT_POSIX_PLATFORM_MAINLOOP_HPP_
+
+#include "openthread-posix-config.h"
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
+#ifndef __linux__
+#error "OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE requires Linux"
+#endif
+
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+#error "OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE is not supported with OPENTHREAD_POSIX_VIRTUAL_TIME"
+#endif
+
+#include <stdint.h>
+#include <sys/epoll.h>
+
+#include <openthread/error.h>
+#include <openthread/openthread-system.h>
+
+#include "core/common/non_copyable.hpp"
+
+namespace ot {
+namespace Posix {
+
+/**
+ * This class implements an epoll based mainloop.
+ *
+ * File descriptors registered with `Watch()` stay registered with the kernel and are only processed when they are
+ * ready, so the cost of a wake-up does not depend on the number of idle file descriptors. A watched file descriptor
+ * either has a handler, which is invoked from `Process()`, or its readiness is reported by `Process()` in the fd_sets
+ * of the mainloop context, so that modules keep checking it with FD_ISSET().
+ *
+ * File descriptors added to the `otSysMainloopContext` fd_sets (e.g., by embedders) are still supported: `Poll()` then
+ * waits for them with `select()` together with the epoll file descriptor, and reports their readiness in the fd_sets
+ * as before.
+ *
+ */
+class Mainloop : private NonCopyable
+{
+public:
+    /**
+     * This function pointer is called when a watched file descriptor is ready.
+     *
+     * @param[in]  aContext  The context given to `Watch()`.
+     * @param[in]  aEvents   The ready events (a combination of EPOLLIN, EPOLLOUT, EPOLLERR and EPOLLHUP).
+     *
+     */
+    typedef void (*Handler)(void *aContext, uint32_t aEvents);
+
+    /**
+     * This static method returns the mainloop.
+     *
+     * @returns A reference to the mainloop.
+     *
+     */
+    static Mainloop &Get(void) { return sMainloop; }
+
+    /**
+     * This method initializes the mainloop.
+     *
+     * @retval OT_ERROR_NONE    Successfully initialized the mainloop.
+     * @retval OT_ERROR_FAILED  Failed to create the epoll file descriptor.
+     *
+     */
+    otError Init(void);
+
+    /**
+     * This method deinitializes the mainloop.
+     *
+     * All watched file descriptors are unwatched (but not closed).
+     *
+     */
+    void Deinit(void);
+
+    /**
+     * This method starts watching a file descriptor.
+     *
+     * When @p aHandler is nullptr, the readiness of @p aFd is reported in the fd_sets of the mainloop context passed
+     * to `Process()`: EPOLLIN in the read fd_set, EPOLLOUT in the write fd_set and EPOLLPRI in the error fd_set (an
+     * error or hang-up is reported as readable and writable, as `select()` does).
+     *
+     * @param[in]  aFd       The file descriptor.
+     * @param[in]  aEvents   The events to wait for (EPOLLIN, EPOLLOUT and/or EPOLLPRI, optionally with EPOLLET when
+     *                       the handler always drains the file descriptor).
+     * @param[in]  aHandler  The function to call when @p aFd is ready, or nullptr to report it in the fd_sets.
+     * @param[in]  aContext  An arbitrary context passed to @p aHandler.
+     *
+     * @retval OT_ERROR_NONE           Successfully started watching @p aFd.
+     * @retval OT_ERROR_ALREADY        @p aFd is already watched.
+     * @retval OT_ERROR_NO_BUFS        Reached the maximum number of watched file descriptors.
+     * @retval OT_ERROR_INVALID_STATE  The mainloop is not initialized.
+     * @retval OT_ERROR_FAILED         Failed to register @p aFd with epoll.
+     *
+     */
+    otError Watch(int aFd, uint32_t aEvents, Handler aHandler, void *aContext);
+
+    /**
+     * This method changes the events to wait for on a watched file descriptor.
+     *
+     * @param[in]  aFd      The file descriptor.
+     * @param[in]  aEvents  The events to wait for.
+     *
+     * @retval OT_ERROR_NONE       Successfully changed the events.
+     * @retval OT_ERROR_NOT_FOUND  @p aFd is not watched.
+     * @retval OT_ERROR_FAILED     Failed to modify the epoll registration.
+     *
+     */
+    otError Modify(int aFd, uint32_t aEvents);
+
+    /**
+     * This method stops watching a file descriptor.
+     *
+     * This method must be called before @p aFd is closed. Pending events of @p aFd are discarded, so it is safe to call
+     * from a handler.
+     *
+     * @param[in]  aFd  The file descriptor.
+     *
+     * @retval OT_ERROR_NONE       Successfully stopped watching @p aFd.
+     * @retval OT_ERROR_NOT_FOUND  @p aFd is not watched.
+     *
+     */
+    otError Unwatch(int aFd);
+
+    /**
+     * This method adds the epoll file descriptor to the read fd_set of a mainloop context.
+     *
+     * The epoll file descriptor is readable whenever a watched file descriptor is ready, so embedders waiting on the
+     * fd_sets with their own `select()` wake up for the watched file descriptors too.
+     *
+     * @param[inout]  aMainloop  The mainloop context.
+     *
+     */
+    void UpdateFdSet(otSysMainloopContext &aMainloop) const;
+
+    /**
+     * This method waits until a watched file descriptor or a file descriptor in the mainloop context is ready, or the
+     * timeout of the mainloop context expires.
+     *
+     * When the epoll file descriptor is the only one in the fd_sets, this method waits with `epoll_wait()`, otherwise
+     * with `select()`.
+     *
+     * @param[inout]  aMainloop  The mainloop context. On return, the fd_sets only contain the ready file descriptors.
+     *
+     * @returns The number of ready file descriptors in the fd_sets, or -1 on error (with `errno` set).
+     *
+     */
+    int Poll(otSysMainloopContext &aMainloop);
+
+    /**
+     * This method invokes the handlers of the watched file descriptors that are ready, and reports the ready file
+     * descriptors watched without a handler in the fd_sets of @p aMainloop.
+     *
+     * Nothing is done unless the epoll file descriptor is ready in @p aMainloop, which may have been polled either by
+     * `Poll()` or by the embedder.
+     *
+     * @param[inout]  aMainloop  The mainloop context.
+     *
+     */
+    void Process(otSysMainloopContext &aMainloop);
+
+private:
+    enum
+    {
+        kMaxWatchers = OPENTHREAD_POSIX_CONFIG_MAINLOOP_MAX_WATCHERS,
+        kMaxEvents   = OPENTHREAD_POSIX_CONFIG_MAINLOOP_MAX_WATCHERS,
+    };
+
+    struct Watcher
+    {
+        int      mFd;
+        uint32_t mEvents;
+        Handler  mHandler;
+        void *   mContext;
+    };
+
+    Mainloop(void);
+
+    Watcher *   FindWatcher(int aFd);
+    bool        HasOtherFds(const otSysMainloopContext &aMainloop) const;
+    static void ReportEvents(const Watcher &aWatcher, uint32_t aEvents, otSysMainloopContext &aMainloop);
+
+    static Mainloop sMainloop;
+
+    int                mEpollFd;
+    int                mNumEvents;
+    struct epoll_event mEvents[kMaxEvents];
+    Watcher            mWatchers[kMaxWatchers];
+};
+
+} // namespace Posix
+} // namespace ot
+
+#endif // OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
+#endif // OT_POSIX_PLATFORM_MAINLOOP_HPP_
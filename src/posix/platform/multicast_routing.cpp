@@ -47,6 +47,7 @@
 #include <openthread/backbone_router_ftd.h>
 
 #include "core/common/logging.hpp"
+#include "posix/platform/mainloop.hpp"
 
 namespace ot {
 namespace Posix {
@@ -142,8 +143,14 @@ void MulticastRoutingManager::UpdateFdSet(fd_set &aReadFdSet, int &aMaxFd) const
 {
     VerifyOrExit(IsEnabled());
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    // The socket is watched by the mainloop, which reports it in the read set when it is readable.
+    OT_UNUSED_VARIABLE(aReadFdSet);
+    OT_UNUSED_VARIABLE(aMaxFd);
+#else
     FD_SET(mMulticastRouterSock, &aReadFdSet);
     aMaxFd = OT_MAX(aMaxFd, mMulticastRouterSock);
+#endif
 
 exit:
     return;
@@ -200,12 +207,19 @@ void MulticastRoutingManager::InitMulticastRouterSock(void)
     VerifyOrDie(mif6ctl.mif6c_pifi > 0, OT_EXIT_ERROR_ERRNO);
     VerifyOrDie(0 == setsockopt(mMulticastRouterSock, IPPROTO_IPV6, MRT6_ADD_MIF, &mif6ctl, sizeof(mif6ctl)),
                 OT_EXIT_ERROR_ERRNO);
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    SuccessOrDie(Mainloop::Get().Watch(mMulticastRouterSock, EPOLLIN, nullptr, nullptr));
+#endif
 }
 
 void MulticastRoutingManager::FinalizeMulticastRouterSock(void)
 {
     VerifyOrExit(IsEnabled());
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    IgnoreReturnValue(Mainloop::Get().Unwatch(mMulticastRouterSock));
+#endif
     close(mMulticastRouterSock);
     mMulticastRouterSock = -1;
 
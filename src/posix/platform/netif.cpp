@@ -152,6 +152,7 @@ char         gNetifName[IFNAMSIZ];
 
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
 #include "posix/platform/ip6_utils.hpp"
+#include "posix/platform/mainloop.hpp"
 
 using namespace ot::Posix::Ip6Utils;
 
@@ -245,6 +246,7 @@ enum
 #endif
 
 static constexpr size_t kMaxIp6Size = OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH;
+static otSysNetifCounters sNetifCounters;
 #if defined(RTM_NEWLINK) && defined(RTM_DELLINK)
 static bool sIsSyncingState = false;
 #endif
@@ -550,6 +552,9 @@ static void processReceive(otMessage *aMessage, void *aContext)
 
     VerifyOrExit(write(sTunFd, packet, length) == length, perror("write"); error = OT_ERROR_FAILED);
 
+    sNetifCounters.mRxPackets++;
+    sNetifCounters.mRxBytes += length;
+
 exit:
     otMessageFree(aMessage);
 
@@ -559,11 +564,23 @@ exit:
     }
     else
     {
+        sNetifCounters.mRxDrops++;
         otLogWarnPlat("%s: %s", __func__, otThreadErrorToString(error));
     }
 }
 
-static void processTransmit(otInstance *aInstance)
+/**
+ * This function reads one packet from the tunnel device and sends it to the Thread network.
+ *
+ * @param[in]  aInstance  The OpenThread instance structure.
+ *
+ * @retval OT_ERROR_NONE           Successfully sent a packet.
+ * @retval OT_ERROR_NOT_FOUND      No packet is pending on the tunnel device.
+ * @retval OT_ERROR_FAILED         Failed to read from the tunnel device.
+ * @retval OT_ERROR_NO_BUFS        A packet was read but dropped due to insufficient message buffers.
+ *
+ */
+static otError transmitPacket(otInstance *aInstance)
 {
     otMessage *message = nullptr;
     ssize_t    rval;
@@ -571,9 +588,8 @@ static void processTransmit(otInstance *aInstance)
     otError    error  = OT_ERROR_NONE;
     size_t     offset = 0;
 
-    assert(sInstance == aInstance);
-
     rval = read(sTunFd, packet, sizeof(packet));
+    VerifyOrExit(rval >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK), error = OT_ERROR_NOT_FOUND);
     VerifyOrExit(rval > 0, error = OT_ERROR_FAILED);
 
     message = otIp6NewMessage(aInstance, nullptr);
@@ -606,12 +622,39 @@ exit:
 
     if (error == OT_ERROR_NONE)
     {
+        sNetifCounters.mTxPackets++;
+        sNetifCounters.mTxBytes += static_cast<uint64_t>(rval);
         otLogInfoPlat("%s: %s", __func__, otThreadErrorToString(error));
     }
-    else
+    else if (error != OT_ERROR_NOT_FOUND)
     {
+        if (rval > 0)
+        {
+            sNetifCounters.mTxDrops++;
+        }
+
         otLogWarnPlat("%s: %s", __func__, otThreadErrorToString(error));
     }
+
+    return error;
+}
+
+static void processTransmit(otInstance *aInstance)
+{
+    assert(sInstance == aInstance);
+
+    // Drain pending packets, bounded so that a busy interface cannot starve other file descriptors.
+    for (uint16_t i = 0; i < OPENTHREAD_POSIX_CONFIG_NETIF_TX_BATCH_SIZE; i++)
+    {
+        otError error = transmitPacket(aInstance);
+
+        // Stop on running out of message buffers as well, as reading more packets would only drop them. They are
+        // left in the tunnel device to be read once buffers are freed.
+        if (error == OT_ERROR_NOT_FOUND || error == OT_ERROR_FAILED || error == OT_ERROR_NO_BUFS)
+        {
+            break;
+        }
+    }
 }
 
 #define kAddAddress true
@@ -1116,6 +1159,14 @@ exit:
 
 void platformNetifDeinit(void)
 {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    IgnoreReturnValue(ot::Posix::Mainloop::Get().Unwatch(sTunFd));
+    IgnoreReturnValue(ot::Posix::Mainloop::Get().Unwatch(sNetlinkFd));
+#if OPENTHREAD_POSIX_USE_MLD_MONITOR
+    IgnoreReturnValue(ot::Posix::Mainloop::Get().Unwatch(sMLDMonitorFd));
+#endif
+#endif
+
     if (sTunFd != -1)
     {
         close(sTunFd);
@@ -1447,6 +1498,35 @@ static void platformConfigureNetLink(void)
 #endif // defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
 }
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+static void handleFdReady(void *aContext, uint32_t aEvents)
+{
+    int *fd = static_cast<int *>(aContext);
+
+    // Same as with select(), errors are reported by the read and only exceptional conditions are fatal.
+    if (aEvents & EPOLLPRI)
+    {
+        close(*fd);
+        DieNow(OT_EXIT_FAILURE);
+    }
+
+    if (fd == &sTunFd)
+    {
+        processTransmit(sInstance);
+    }
+    else if (fd == &sNetlinkFd)
+    {
+        processNetlinkEvent(sInstance);
+    }
+#if OPENTHREAD_POSIX_USE_MLD_MONITOR
+    else if (fd == &sMLDMonitorFd)
+    {
+        processMLDEvent(sInstance);
+    }
+#endif
+}
+#endif // OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
 void platformNetifInit(otInstance *aInstance, const char *aInterfaceName)
 {
     sIpFd = SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_IP, kSocketNonBlock);
@@ -1463,6 +1543,13 @@ void platformNetifInit(otInstance *aInstance, const char *aInterfaceName)
 #endif
 #if OPENTHREAD_POSIX_USE_MLD_MONITOR
     mldListenerInit();
+#endif
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    SuccessOrDie(ot::Posix::Mainloop::Get().Watch(sTunFd, EPOLLIN | EPOLLPRI, handleFdReady, &sTunFd));
+    SuccessOrDie(ot::Posix::Mainloop::Get().Watch(sNetlinkFd, EPOLLIN | EPOLLPRI, handleFdReady, &sNetlinkFd));
+#if OPENTHREAD_POSIX_USE_MLD_MONITOR
+    SuccessOrDie(ot::Posix::Mainloop::Get().Watch(sMLDMonitorFd, EPOLLIN | EPOLLPRI, handleFdReady, &sMLDMonitorFd));
+#endif
 #endif
 
     otIp6SetReceiveFilterEnabled(aInstance, true);
@@ -1476,6 +1563,7 @@ void platformNetifInit(otInstance *aInstance, const char *aInterfaceName)
     sInstance = aInstance;
 }
 
+#if !OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
 void platformNetifUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, fd_set *aErrorFdSet, int *aMaxFd)
 {
     OT_UNUSED_VARIABLE(aWriteFdSet);
@@ -1560,6 +1648,12 @@ void platformNetifProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, c
 exit:
     return;
 }
+#endif // !OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
+const otSysNetifCounters *otSysGetNetifCounters(void)
+{
+    return &sNetifCounters;
+}
 
 otError otPlatGetNetif(otInstance *aInstance, const char **outNetIfName, unsigned int *outNetIfIndex)
 {
@@ -76,6 +76,44 @@
 #endif
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_TREL_USE_MMSG
+ *
+ * Defines whether the TREL UDP6 platform sends and receives batches of packets with `sendmmsg()` and `recvmmsg()`
+ * system calls, or with one `sendmsg()` or `recvmsg()` call per packet.
+ *
+ * Use of `sendmmsg()` and `recvmmsg()` is enabled by default on linux-based platforms.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_TREL_USE_MMSG
+#ifdef __linux__
+#define OPENTHREAD_CONFIG_POSIX_TREL_USE_MMSG 1
+#else
+#define OPENTHREAD_CONFIG_POSIX_TREL_USE_MMSG 0
+#endif
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_TREL_BATCH_SIZE
+ *
+ * The maximum number of packets the TREL UDP6 platform sends or receives per system call.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_TREL_BATCH_SIZE
+#define OPENTHREAD_CONFIG_POSIX_TREL_BATCH_SIZE 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_TREL_TX_QUEUE_SIZE
+ *
+ * The maximum number of packets the TREL UDP6 platform queues while its socket is not ready to send. Queue entries
+ * are allocated on demand. When the queue is full, new packets are rejected with `OT_ERROR_NO_BUFS`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_TREL_TX_QUEUE_SIZE
+#define OPENTHREAD_CONFIG_POSIX_TREL_TX_QUEUE_SIZE 32
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_DAEMON_SOCKET_BASENAME
  *
@@ -96,6 +134,28 @@
 #define OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_DAEMON_MAX_SESSIONS
+ *
+ * Define the maximum number of clients simultaneously connected to the POSIX daemon.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_DAEMON_MAX_SESSIONS
+#define OPENTHREAD_POSIX_CONFIG_DAEMON_MAX_SESSIONS 8
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_DAEMON_SESSION_OUTPUT_BUFFER_SIZE
+ *
+ * Define the size of the per-session buffer holding output not yet accepted by the client socket.
+ *
+ * A client falling behind by more than this many bytes is disconnected.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_DAEMON_SESSION_OUTPUT_BUFFER_SIZE
+#define OPENTHREAD_POSIX_CONFIG_DAEMON_SESSION_OUTPUT_BUFFER_SIZE 4096
+#endif
+
 /**
  * RCP bus UART.
  *
@@ -151,6 +211,74 @@
 #define OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_NETIF_TX_BATCH_SIZE
+ *
+ * The maximum number of packets read from the Thread network interface and sent to the Thread network on each
+ * mainloop iteration.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_NETIF_TX_BATCH_SIZE
+#define OPENTHREAD_POSIX_CONFIG_NETIF_TX_BATCH_SIZE 16
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACT_SIZE
+ *
+ * The minimum size in bytes the settings update log may grow to before it is compacted into a new settings snapshot.
+ * The log is also allowed to grow up to the size of the current snapshot.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACT_SIZE
+#define OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACT_SIZE 4096
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+ *
+ * Define as 1 to wait for file descriptors with epoll instead of select() in the mainloop (Linux only).
+ *
+ * Modules register their file descriptors once and are only processed when ready. File descriptors added to
+ * `otSysMainloopContext` by `otSysMainloopUpdate()` callers are still waited for with select().
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MAINLOOP_MAX_WATCHERS
+ *
+ * The maximum number of file descriptors watched by the epoll based mainloop.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MAINLOOP_MAX_WATCHERS
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_MAX_WATCHERS 32
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_LOG_DEFERRED_ENABLE
+ *
+ * Define as 1 to write platform logs to syslog from a separate writer thread.
+ *
+ * Log lines are formatted by the logging thread and queued in a lock-free ring, so logging does not block the
+ * mainloop on syslog. Lines are dropped and counted when the ring is full.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_LOG_DEFERRED_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_LOG_DEFERRED_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_LOG_DEFERRED_RING_SIZE
+ *
+ * The number of log lines queued for the deferred log writer thread. Must be a power of two.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_LOG_DEFERRED_RING_SIZE
+#define OPENTHREAD_POSIX_CONFIG_LOG_DEFERRED_RING_SIZE 256
+#endif
+
 #ifdef __APPLE__
 
 /**
@@ -573,6 +573,15 @@ void platformDaemonUpdate(otSysMainloopContext *aContext);
  */
 void platformDaemonProcess(const otSysMainloopContext *aContext);
 
+/**
+ * This function notifies the daemon sessions subscribed to state changes.
+ *
+ * @param[in]   aInstance   The OpenThread instance structure.
+ * @param[in]   aFlags      The state flags that have changed.
+ *
+ */
+void platformDaemonStateChange(otInstance *aInstance, otChangedFlags aFlags);
+
 #ifdef __cplusplus
 }
 #endif
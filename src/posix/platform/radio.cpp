@@ -247,6 +247,34 @@ bool otPlatRadioGetPromiscuous(otInstance *aInstance)
     return sRadioSpinel.IsPromiscuous();
 }
 
+void otSysGetRcpRequestStats(otSysRcpRequestStats *aStats)
+{
+    const auto &stats = sRadioSpinel.GetRequestStats();
+
+    static_assert(OT_ARRAY_LENGTH(aStats->mProperties) == OT_ARRAY_LENGTH(stats.mProperties),
+                  "OT_SYS_RCP_MAX_PROPERTY_STATS is incorrect");
+
+    memset(aStats, 0, sizeof(*aStats));
+    aStats->mNumResponses     = stats.mNumResponses;
+    aStats->mNumAsyncRequests = stats.mNumAsyncRequests;
+    aStats->mNumAsyncFailures = stats.mNumAsyncFailures;
+    aStats->mNumProperties    = stats.mNumProperties;
+
+    for (uint8_t i = 0; i < stats.mNumProperties; i++)
+    {
+        otSysRcpPropertyStats &property = aStats->mProperties[i];
+
+        static_assert(sizeof(property.mRttHistogram) == sizeof(stats.mProperties[i].mRttHistogram),
+                      "OT_SYS_RCP_RTT_HISTOGRAM_SIZE is incorrect");
+
+        property.mKey              = stats.mProperties[i].mKey;
+        property.mNumResponses     = stats.mProperties[i].mNumResponses;
+        property.mNumAsyncFailures = stats.mProperties[i].mNumAsyncFailures;
+        property.mMaxRtt           = stats.mProperties[i].mMaxRtt;
+        memcpy(property.mRttHistogram, stats.mProperties[i].mRttHistogram, sizeof(property.mRttHistogram));
+    }
+}
+
 void platformRadioUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, int *aMaxFd, struct timeval *aTimeout)
 {
     uint64_t now      = otPlatTimeGet();
@@ -40,6 +40,7 @@
 #include <inttypes.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -54,11 +55,88 @@
 #include "common/code_utils.hpp"
 #include "common/encoding.hpp"
 
+/*
+ * Settings are kept in memory, sorted by key with values of the same key kept in the order they were added, so that
+ * reads never access the file system.
+ *
+ * On disk, the data file holds a snapshot of all settings as a sequence of (key, length, value) records and is only
+ * ever replaced atomically through the swap file. Each update made since the snapshot was taken is appended to the log
+ * file as a single checksummed entry and synced before the update returns. The log header identifies the snapshot it
+ * applies to, so the log is discarded if a crash happens after a new snapshot was persisted but before the log was
+ * reset. A torn entry at the end of the log is an update which never returned and is dropped. Once the log outgrows
+ * both the snapshot and OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACT_SIZE, it is compacted into a new snapshot.
+ *
+ */
+
+#ifndef SELF_TEST
+#define SELF_TEST 0
+#endif
+
 static const size_t kMaxFileNameSize = sizeof(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH) + 32;
 
-static int sSettingsFd = -1;
+static const uint32_t kLogMagic     = 0x4c53544f; // "OTSL"
+static const uint32_t kChecksumInit = 2166136261u;
+
+enum
+{
+    kLogOpAdd    = 1,
+    kLogOpSet    = 2,
+    kLogOpDelete = 3,
+};
+
+struct LogHeader
+{
+    uint32_t mMagic;
+    uint32_t mSnapshotSize;
+    uint32_t mSnapshotChecksum;
+};
+
+struct LogEntryHeader
+{
+    uint32_t mChecksum; ///< Checksum of the remaining header fields and the value.
+    uint16_t mKey;
+    uint16_t mLength;
+    int16_t  mIndex;
+    uint8_t  mOperation;
+    uint8_t  mReserved;
+};
+
+struct SettingsRecord
+{
+    uint16_t mKey;
+    uint16_t mLength;
+    uint8_t *mValue;
+};
+
+static int             sSettingsFd      = -1;
+static int             sLogFd           = -1;
+static off_t           sLogSize         = 0;
+static size_t          sSnapshotSize    = 0;
+static SettingsRecord *sRecords         = nullptr;
+static size_t          sNumRecords      = 0;
+static size_t          sRecordsCapacity = 0;
+
+#if SELF_TEST
+static const int kCrashExitCode  = 3;
+static int       sCrashCountdown = 0;
 
-static otError platformSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex, int *aSwapFd);
+static bool shouldCrash(void)
+{
+    return sCrashCountdown > 0 && --sCrashCountdown == 0;
+}
+
+static void crashPoint(void)
+{
+    if (shouldCrash())
+    {
+        _exit(kCrashExitCode);
+    }
+}
+#else
+static void crashPoint(void)
+{
+}
+#endif
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
 static const uint16_t *sKeys       = nullptr;
@@ -88,7 +166,7 @@ exit:
 }
 #endif
 
-static void getSettingsFileName(otInstance *aInstance, char aFileName[kMaxFileNameSize], bool aSwap)
+static void getSettingsFileName(otInstance *aInstance, char aFileName[kMaxFileNameSize], const char *aExtension)
 {
     const char *offset = getenv("PORT_OFFSET");
     uint64_t    nodeId;
@@ -96,121 +174,496 @@ static void getSettingsFileName(otInstance *aInstance, char aFileName[kMaxFileNa
     otPlatRadioGetIeeeEui64(aInstance, reinterpret_cast<uint8_t *>(&nodeId));
     nodeId = ot::Encoding::BigEndian::HostSwap64(nodeId);
     snprintf(aFileName, kMaxFileNameSize, OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH "/%s_%" PRIx64 ".%s",
-             offset == nullptr ? "0" : offset, nodeId, (aSwap ? "swap" : "data"));
+             offset == nullptr ? "0" : offset, nodeId, aExtension);
 }
 
-static int swapOpen(otInstance *aInstance)
+static uint32_t checksum(uint32_t aChecksum, const void *aData, size_t aLength)
 {
-    char fileName[kMaxFileNameSize];
-    int  fd;
+    const uint8_t *data = static_cast<const uint8_t *>(aData);
 
-    getSettingsFileName(aInstance, fileName, true);
+    // FNV-1a
+    while (aLength-- > 0)
+    {
+        aChecksum = (aChecksum ^ *data++) * 16777619u;
+    }
 
-    fd = open(fileName, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
-    VerifyOrDie(fd != -1, OT_EXIT_ERROR_ERRNO);
+    return aChecksum;
+}
 
-    return fd;
+static void writeAll(int aFd, const void *aBuffer, size_t aLength)
+{
+#if SELF_TEST
+    if (shouldCrash())
+    {
+        // Simulate a torn write.
+        IgnoreReturnValue(write(aFd, aBuffer, aLength / 2));
+        _exit(kCrashExitCode);
+    }
+#endif
+
+    VerifyOrDie(write(aFd, aBuffer, aLength) == static_cast<ssize_t>(aLength), OT_EXIT_ERROR_ERRNO);
 }
 
 /**
- * This function reads @p aLength bytes from the data file and appends to the swap file.
+ * This function reads the whole content of a file.
+ *
+ * @param[in]   aFd     The file descriptor.
+ * @param[out]  aSize   A reference to return the size of the file.
  *
- * @param[in]   aFd     The file descriptor of the current swap file.
- * @param[in]   aLength Number of bytes to copy.
+ * @returns A pointer to a buffer allocated with malloc() holding the file content, must be released with free().
  *
  */
-static void swapWrite(otInstance *aInstance, int aFd, uint16_t aLength)
+static uint8_t *readAll(int aFd, size_t &aSize)
 {
-    OT_UNUSED_VARIABLE(aInstance);
+    struct stat st;
+    uint8_t *   buffer;
+    size_t      offset = 0;
+
+    VerifyOrDie(fstat(aFd, &st) == 0, OT_EXIT_ERROR_ERRNO);
+    aSize  = static_cast<size_t>(st.st_size);
+    buffer = static_cast<uint8_t *>(malloc(aSize + 1));
+    VerifyOrDie(buffer != nullptr, OT_EXIT_FAILURE);
+
+    while (offset < aSize)
+    {
+        ssize_t rval = pread(aFd, buffer + offset, aSize - offset, static_cast<off_t>(offset));
+
+        VerifyOrDie(rval > 0, OT_EXIT_ERROR_ERRNO);
+        offset += static_cast<size_t>(rval);
+    }
+
+    return buffer;
+}
+
+static size_t recordsLowerBound(uint16_t aKey)
+{
+    size_t low  = 0;
+    size_t high = sNumRecords;
+
+    while (low < high)
+    {
+        size_t mid = (low + high) / 2;
+
+        if (sRecords[mid].mKey < aKey)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+static size_t recordsUpperBound(uint16_t aKey)
+{
+    size_t low  = 0;
+    size_t high = sNumRecords;
+
+    while (low < high)
+    {
+        size_t mid = (low + high) / 2;
+
+        if (sRecords[mid].mKey <= aKey)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+static void recordsAdd(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    size_t          position = recordsUpperBound(aKey);
+    SettingsRecord *record;
+
+    if (sNumRecords == sRecordsCapacity)
+    {
+        size_t          capacity = (sRecordsCapacity == 0) ? 16 : sRecordsCapacity * 2;
+        SettingsRecord *records  = static_cast<SettingsRecord *>(realloc(sRecords, capacity * sizeof(SettingsRecord)));
+
+        VerifyOrDie(records != nullptr, OT_EXIT_FAILURE);
+        sRecords         = records;
+        sRecordsCapacity = capacity;
+    }
+
+    memmove(&sRecords[position + 1], &sRecords[position], (sNumRecords - position) * sizeof(SettingsRecord));
+    sNumRecords++;
+
+    record          = &sRecords[position];
+    record->mKey    = aKey;
+    record->mLength = aValueLength;
+    record->mValue  = static_cast<uint8_t *>(malloc(aValueLength + 1u));
+    VerifyOrDie(record->mValue != nullptr, OT_EXIT_FAILURE);
+
+    if (aValueLength > 0)
+    {
+        memcpy(record->mValue, aValue, aValueLength);
+    }
+}
+
+static void recordsRemove(size_t aPosition)
+{
+    free(sRecords[aPosition].mValue);
+    sNumRecords--;
+    memmove(&sRecords[aPosition], &sRecords[aPosition + 1], (sNumRecords - aPosition) * sizeof(SettingsRecord));
+}
+
+/**
+ * This function removes a setting from the in-memory settings.
+ *
+ * @param[in]  aKey       The key associated with the requested setting.
+ * @param[in]  aIndex     The index of the value to be removed. If set to -1, all values for this aKey will be removed.
+ *
+ * @retval OT_ERROR_NONE        The given key and index was found and removed successfully.
+ * @retval OT_ERROR_NOT_FOUND   The given key or index was not found in the setting store.
+ *
+ */
+static otError recordsDelete(uint16_t aKey, int aIndex)
+{
+    otError error = OT_ERROR_NOT_FOUND;
+    size_t  begin = recordsLowerBound(aKey);
+    size_t  end   = recordsUpperBound(aKey);
 
-    const size_t kBlockSize = 512;
-    uint8_t      buffer[kBlockSize];
+    if (aIndex == -1)
+    {
+        VerifyOrExit(begin < end);
 
-    while (aLength > 0)
+        while (end > begin)
+        {
+            recordsRemove(--end);
+        }
+    }
+    else
     {
-        uint16_t count = aLength >= sizeof(buffer) ? sizeof(buffer) : aLength;
-        ssize_t  rval  = read(sSettingsFd, buffer, count);
+        VerifyOrExit(aIndex >= 0 && static_cast<size_t>(aIndex) < end - begin);
+        recordsRemove(begin + static_cast<size_t>(aIndex));
+    }
+
+    error = OT_ERROR_NONE;
+
+exit:
+    return error;
+}
 
-        VerifyOrDie(rval > 0, OT_EXIT_FAILURE);
-        count = static_cast<uint16_t>(rval);
-        rval  = write(aFd, buffer, count);
-        assert(rval == count);
-        VerifyOrDie(rval == count, OT_EXIT_FAILURE);
-        aLength -= count;
+static void recordsClear(void)
+{
+    while (sNumRecords > 0)
+    {
+        free(sRecords[--sNumRecords].mValue);
     }
 }
 
+static int swapOpen(otInstance *aInstance)
+{
+    char fileName[kMaxFileNameSize];
+    int  fd;
+
+    getSettingsFileName(aInstance, fileName, "swap");
+
+    fd = open(fileName, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    VerifyOrDie(fd != -1, OT_EXIT_ERROR_ERRNO);
+
+    return fd;
+}
+
 static void swapPersist(otInstance *aInstance, int aFd)
 {
     char swapFile[kMaxFileNameSize];
     char dataFile[kMaxFileNameSize];
 
-    getSettingsFileName(aInstance, swapFile, true);
-    getSettingsFileName(aInstance, dataFile, false);
+    getSettingsFileName(aInstance, swapFile, "swap");
+    getSettingsFileName(aInstance, dataFile, "data");
 
     VerifyOrDie(0 == close(sSettingsFd), OT_EXIT_ERROR_ERRNO);
+    crashPoint();
     VerifyOrDie(0 == fsync(aFd), OT_EXIT_ERROR_ERRNO);
+    crashPoint();
     VerifyOrDie(0 == rename(swapFile, dataFile), OT_EXIT_ERROR_ERRNO);
+    crashPoint();
 
     sSettingsFd = aFd;
 }
 
-static void swapDiscard(otInstance *aInstance, int aFd)
+/**
+ * This function starts a new, empty log for the snapshot with given size and checksum.
+ *
+ */
+static void logReset(size_t aSnapshotSize, uint32_t aSnapshotChecksum)
 {
-    char swapFileName[kMaxFileNameSize];
+    LogHeader header;
+
+    header.mMagic            = kLogMagic;
+    header.mSnapshotSize     = static_cast<uint32_t>(aSnapshotSize);
+    header.mSnapshotChecksum = aSnapshotChecksum;
+
+    VerifyOrDie(0 == ftruncate(sLogFd, 0), OT_EXIT_ERROR_ERRNO);
+    crashPoint();
+    writeAll(sLogFd, &header, sizeof(header));
+    crashPoint();
+    VerifyOrDie(0 == fsync(sLogFd), OT_EXIT_ERROR_ERRNO);
 
-    VerifyOrDie(0 == close(aFd), OT_EXIT_ERROR_ERRNO);
-    getSettingsFileName(aInstance, swapFileName, true);
-    VerifyOrDie(0 == unlink(swapFileName), OT_EXIT_ERROR_ERRNO);
+    sLogSize      = sizeof(header);
+    sSnapshotSize = aSnapshotSize;
 }
 
-void otPlatSettingsInit(otInstance *aInstance)
+static void logAppend(uint8_t aOperation, uint16_t aKey, int aIndex, const uint8_t *aValue, uint16_t aValueLength)
 {
-    otError error = OT_ERROR_NONE;
+    size_t          size   = sizeof(LogEntryHeader) + aValueLength;
+    uint8_t *       buffer = static_cast<uint8_t *>(malloc(size));
+    LogEntryHeader *header = reinterpret_cast<LogEntryHeader *>(buffer);
 
-#if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
-    otPosixSecureSettingsInit(aInstance);
-#endif
+    VerifyOrDie(buffer != nullptr, OT_EXIT_FAILURE);
+
+    header->mKey       = aKey;
+    header->mLength    = aValueLength;
+    header->mIndex     = static_cast<int16_t>(aIndex);
+    header->mOperation = aOperation;
+    header->mReserved  = 0;
 
+    if (aValueLength > 0)
     {
-        struct stat st;
+        memcpy(buffer + sizeof(LogEntryHeader), aValue, aValueLength);
+    }
 
-        if (stat(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH, &st) == -1)
-        {
-            mkdir(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH, 0755);
-        }
+    header->mChecksum = checksum(kChecksumInit, &header->mKey, size - offsetof(LogEntryHeader, mKey));
+
+    // The whole entry is written with a single call so that a crash leaves at most one torn entry at the end.
+    writeAll(sLogFd, buffer, size);
+    crashPoint();
+    VerifyOrDie(0 == fsync(sLogFd), OT_EXIT_ERROR_ERRNO);
+    sLogSize += static_cast<off_t>(size);
+
+    free(buffer);
+}
+
+/**
+ * This function writes all settings to a new snapshot and starts a new log for it.
+ *
+ */
+static void settingsCompact(otInstance *aInstance)
+{
+    size_t   size = 0;
+    uint8_t *buffer;
+    uint8_t *cur;
+    int      swapFd;
+
+    for (size_t i = 0; i < sNumRecords; i++)
+    {
+        size += sizeof(sRecords[i].mKey) + sizeof(sRecords[i].mLength) + sRecords[i].mLength;
     }
 
+    buffer = static_cast<uint8_t *>(malloc(size + 1));
+    VerifyOrDie(buffer != nullptr, OT_EXIT_FAILURE);
+    cur = buffer;
+
+    for (size_t i = 0; i < sNumRecords; i++)
     {
-        char fileName[kMaxFileNameSize];
+        memcpy(cur, &sRecords[i].mKey, sizeof(sRecords[i].mKey));
+        cur += sizeof(sRecords[i].mKey);
+        memcpy(cur, &sRecords[i].mLength, sizeof(sRecords[i].mLength));
+        cur += sizeof(sRecords[i].mLength);
+        memcpy(cur, sRecords[i].mValue, sRecords[i].mLength);
+        cur += sRecords[i].mLength;
+    }
 
-        getSettingsFileName(aInstance, fileName, false);
-        sSettingsFd = open(fileName, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    swapFd = swapOpen(aInstance);
+    writeAll(swapFd, buffer, size);
+    swapPersist(aInstance, swapFd);
+    logReset(size, checksum(kChecksumInit, buffer, size));
+
+    free(buffer);
+}
+
+static void settingsCompactIfNeeded(otInstance *aInstance)
+{
+    size_t limit = OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACT_SIZE;
+
+    if (limit < sSnapshotSize)
+    {
+        limit = sSnapshotSize;
+    }
+
+    if (sLogSize > static_cast<off_t>(sizeof(LogHeader) + limit))
+    {
+        settingsCompact(aInstance);
     }
+}
 
-    VerifyOrDie(sSettingsFd != -1, OT_EXIT_ERROR_ERRNO);
+/**
+ * This function loads the snapshot from the data file.
+ *
+ * @param[out]  aChecksum   A reference to return the checksum of the snapshot.
+ *
+ * @returns The size of the snapshot.
+ *
+ */
+static size_t snapshotLoad(uint32_t &aChecksum)
+{
+    otError  error = OT_ERROR_NONE;
+    size_t   size;
+    size_t   offset = 0;
+    uint8_t *buffer = readAll(sSettingsFd, size);
 
-    for (off_t size = lseek(sSettingsFd, 0, SEEK_END), offset = lseek(sSettingsFd, 0, SEEK_SET); offset < size;)
+    while (offset < size)
     {
         uint16_t key;
         uint16_t length;
-        ssize_t  rval;
-
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
 
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
+        VerifyOrExit(size - offset >= sizeof(key) + sizeof(length), error = OT_ERROR_PARSE);
+        memcpy(&key, buffer + offset, sizeof(key));
+        offset += sizeof(key);
+        memcpy(&length, buffer + offset, sizeof(length));
+        offset += sizeof(length);
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
+        VerifyOrExit(size - offset >= length, error = OT_ERROR_PARSE);
+        recordsAdd(key, buffer + offset, length);
+        offset += length;
     }
 
 exit:
     if (error == OT_ERROR_PARSE)
     {
         VerifyOrDie(ftruncate(sSettingsFd, 0) == 0, OT_EXIT_ERROR_ERRNO);
+        recordsClear();
+        size = 0;
     }
+
+    aChecksum = checksum(kChecksumInit, buffer, size);
+    free(buffer);
+
+    return size;
+}
+
+/**
+ * This function applies a log entry to the in-memory settings.
+ *
+ * @param[in]  aEntry   A pointer to the log entry.
+ * @param[in]  aSize    The number of bytes available at @p aEntry.
+ *
+ * @returns The size of the entry, or zero if it is torn or corrupted.
+ *
+ */
+static size_t logReplay(const uint8_t *aEntry, size_t aSize)
+{
+    size_t         size = 0;
+    LogEntryHeader header;
+    const uint8_t *value = aEntry + sizeof(header);
+
+    VerifyOrExit(aSize >= sizeof(header));
+    memcpy(&header, aEntry, sizeof(header));
+    VerifyOrExit(aSize - sizeof(header) >= header.mLength);
+    VerifyOrExit(header.mChecksum == checksum(kChecksumInit, aEntry + offsetof(LogEntryHeader, mKey),
+                                              sizeof(header) - offsetof(LogEntryHeader, mKey) + header.mLength));
+
+    switch (header.mOperation)
+    {
+    case kLogOpSet:
+        IgnoreError(recordsDelete(header.mKey, -1));
+        OT_FALL_THROUGH;
+
+    case kLogOpAdd:
+        recordsAdd(header.mKey, value, header.mLength);
+        break;
+
+    case kLogOpDelete:
+        IgnoreError(recordsDelete(header.mKey, header.mIndex));
+        break;
+
+    default:
+        ExitNow();
+    }
+
+    size = sizeof(header) + header.mLength;
+
+exit:
+    return size;
+}
+
+/**
+ * This function replays the log on top of the snapshot, or starts a new log if it does not belong to the snapshot.
+ *
+ */
+static void logLoad(size_t aSnapshotSize, uint32_t aSnapshotChecksum)
+{
+    size_t    size;
+    size_t    offset = sizeof(LogHeader);
+    uint8_t * buffer = readAll(sLogFd, size);
+    LogHeader header;
+
+    if (size >= sizeof(header))
+    {
+        memcpy(&header, buffer, sizeof(header));
+    }
+
+    if (size < sizeof(header) || header.mMagic != kLogMagic || header.mSnapshotSize != aSnapshotSize ||
+        header.mSnapshotChecksum != aSnapshotChecksum)
+    {
+        logReset(aSnapshotSize, aSnapshotChecksum);
+        ExitNow();
+    }
+
+    while (offset < size)
+    {
+        size_t length = logReplay(buffer + offset, size - offset);
+
+        if (length == 0)
+        {
+            // Drop the torn entry of an update interrupted by a crash.
+            VerifyOrDie(ftruncate(sLogFd, static_cast<off_t>(offset)) == 0, OT_EXIT_ERROR_ERRNO);
+            VerifyOrDie(fsync(sLogFd) == 0, OT_EXIT_ERROR_ERRNO);
+            break;
+        }
+
+        offset += length;
+    }
+
+    sLogSize      = static_cast<off_t>(offset);
+    sSnapshotSize = aSnapshotSize;
+
+exit:
+    free(buffer);
+}
+
+void otPlatSettingsInit(otInstance *aInstance)
+{
+    size_t   snapshotSize;
+    uint32_t snapshotChecksum;
+
+#if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
+    otPosixSecureSettingsInit(aInstance);
+#endif
+
+    {
+        struct stat st;
+
+        if (stat(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH, &st) == -1)
+        {
+            mkdir(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH, 0755);
+        }
+    }
+
+    {
+        char fileName[kMaxFileNameSize];
+
+        getSettingsFileName(aInstance, fileName, "data");
+        sSettingsFd = open(fileName, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+        VerifyOrDie(sSettingsFd != -1, OT_EXIT_ERROR_ERRNO);
+
+        getSettingsFileName(aInstance, fileName, "log");
+        sLogFd = open(fileName, O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0600);
+        VerifyOrDie(sLogFd != -1, OT_EXIT_ERROR_ERRNO);
+    }
+
+    snapshotSize = snapshotLoad(snapshotChecksum);
+    logLoad(snapshotSize, snapshotChecksum);
 }
 
 void otPlatSettingsDeinit(otInstance *aInstance)
@@ -223,15 +676,23 @@ void otPlatSettingsDeinit(otInstance *aInstance)
 
     assert(sSettingsFd != -1);
     VerifyOrDie(close(sSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(close(sLogFd) == 0, OT_EXIT_ERROR_ERRNO);
+    sSettingsFd = -1;
+    sLogFd      = -1;
+
+    recordsClear();
+    free(sRecords);
+    sRecords         = nullptr;
+    sRecordsCapacity = 0;
 }
 
 otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError     error  = OT_ERROR_NOT_FOUND;
-    const off_t size   = lseek(sSettingsFd, 0, SEEK_END);
-    off_t       offset = lseek(sSettingsFd, 0, SEEK_SET);
+    otError               error = OT_ERROR_NOT_FOUND;
+    size_t                begin;
+    const SettingsRecord *record;
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     if (isCriticalKey(aKey))
@@ -240,59 +701,28 @@ otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint
     }
 #endif
 
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
+    begin = recordsLowerBound(aKey);
+    VerifyOrExit(aIndex >= 0 && begin + static_cast<size_t>(aIndex) < recordsUpperBound(aKey));
+    record = &sRecords[begin + static_cast<size_t>(aIndex)];
+    error  = OT_ERROR_NONE;
 
-    while (offset < size)
+    if (aValueLength)
     {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
-
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
-
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
-
-        if (key == aKey)
+        if (aValue)
         {
-            if (aIndex == 0)
-            {
-                error = OT_ERROR_NONE;
-
-                if (aValueLength)
-                {
-                    if (aValue)
-                    {
-                        uint16_t readLength = (length <= *aValueLength ? length : *aValueLength);
-
-                        VerifyOrExit(read(sSettingsFd, aValue, readLength) == readLength, error = OT_ERROR_PARSE);
-                    }
-
-                    *aValueLength = length;
-                }
-
-                break;
-            }
-            else
-            {
-                --aIndex;
-            }
+            memcpy(aValue, record->mValue, record->mLength <= *aValueLength ? record->mLength : *aValueLength);
         }
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
+        *aValueLength = record->mLength;
     }
 
 exit:
-    VerifyOrDie(error != OT_ERROR_PARSE, OT_EXIT_FAILURE);
     return error;
 }
 
 otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
-    int     swapFd = -1;
-    otError error  = OT_ERROR_NONE;
+    otError error = OT_ERROR_NONE;
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     if (isCriticalKey(aKey))
@@ -301,23 +731,10 @@ otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *a
     }
 #endif
 
-    switch (platformSettingsDelete(aInstance, aKey, -1, &swapFd))
-    {
-    case OT_ERROR_NONE:
-    case OT_ERROR_NOT_FOUND:
-        break;
-
-    default:
-        assert(false);
-        break;
-    }
-
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                    write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                    write(swapFd, aValue, aValueLength) == aValueLength,
-                OT_EXIT_FAILURE);
-
-    swapPersist(aInstance, swapFd);
+    logAppend(kLogOpSet, aKey, 0, aValue, aValueLength);
+    IgnoreError(recordsDelete(aKey, -1));
+    recordsAdd(aKey, aValue, aValueLength);
+    settingsCompactIfNeeded(aInstance);
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
 exit:
@@ -327,11 +744,7 @@ exit:
 
 otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
-    OT_UNUSED_VARIABLE(aInstance);
-
-    otError error  = OT_ERROR_NONE;
-    off_t   size   = lseek(sSettingsFd, 0, SEEK_END);
-    int     swapFd = swapOpen(aInstance);
+    otError error = OT_ERROR_NONE;
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     if (isCriticalKey(aKey))
@@ -340,18 +753,9 @@ otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *a
     }
 #endif
 
-    if (size > 0)
-    {
-        VerifyOrDie(0 == lseek(sSettingsFd, 0, SEEK_SET), OT_EXIT_ERROR_ERRNO);
-        swapWrite(aInstance, swapFd, static_cast<uint16_t>(size));
-    }
-
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                    write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                    write(swapFd, aValue, aValueLength) == aValueLength,
-                OT_EXIT_FAILURE);
-
-    swapPersist(aInstance, swapFd);
+    logAppend(kLogOpAdd, aKey, 0, aValue, aValueLength);
+    recordsAdd(aKey, aValue, aValueLength);
+    settingsCompactIfNeeded(aInstance);
 
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
 exit:
@@ -366,132 +770,181 @@ otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
 #if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
     if (isCriticalKey(aKey))
     {
-        error = otPosixSecureSettingsDelete(aInstance, aKey, aIndex);
+        ExitNow(error = otPosixSecureSettingsDelete(aInstance, aKey, aIndex));
     }
-    else
 #endif
-    {
-        error = platformSettingsDelete(aInstance, aKey, aIndex, nullptr);
-    }
 
+    SuccessOrExit(error = recordsDelete(aKey, aIndex));
+    logAppend(kLogOpDelete, aKey, aIndex, nullptr, 0);
+    settingsCompactIfNeeded(aInstance);
+
+exit:
     return error;
 }
 
-/**
- * This function removes a setting either from swap file or persisted file.
- *
- * @param[in]  aInstance  The OpenThread instance structure.
- * @param[in]  aKey       The key associated with the requested setting.
- * @param[in]  aIndex     The index of the value to be removed. If set to -1, all values for this aKey will be removed.
- * @param[out] aSwapFd    A optional pointer to receive file descriptor of the generated swap file descriptor.
- *
- * @note
- *   If @p aSwapFd is null, operate deleting on the setting file.
- *   If @p aSwapFd is not null, operate on the swap file, and aSwapFd will point to the swap file descriptor.
- *
- * @retval OT_ERROR_NONE        The given key and index was found and removed successfully.
- * @retval OT_ERROR_NOT_FOUND   The given key or index was not found in the setting store.
- *
- */
-static otError platformSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex, int *aSwapFd)
+void otPlatSettingsWipe(otInstance *aInstance)
 {
-    OT_UNUSED_VARIABLE(aInstance);
+#if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
+    otPosixSecureSettingsWipe(aInstance);
+#endif
+
+    recordsClear();
+    settingsCompact(aInstance);
+}
 
-    otError error  = OT_ERROR_NOT_FOUND;
-    off_t   size   = lseek(sSettingsFd, 0, SEEK_END);
-    off_t   offset = lseek(sSettingsFd, 0, SEEK_SET);
-    int     swapFd = swapOpen(aInstance);
+#if SELF_TEST
 
-    assert(swapFd != -1);
-    assert(offset == 0);
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
+#include <sys/wait.h>
 
-    while (offset < size)
-    {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
+void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
+{
+    OT_UNUSED_VARIABLE(aInstance);
 
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
+    memset(aIeeeEui64, 0, sizeof(uint64_t));
+}
 
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
+static const uint16_t kSelfTestMaxKey      = 4;
+static const size_t   kSelfTestMaxDumpSize = 16384;
+static uint8_t        sSelfTestData[60];
 
-        offset += sizeof(key) + sizeof(length) + length;
+typedef void (*SelfTestOperation)(otInstance *aInstance);
 
-        if (aKey == key)
+/**
+ * This function serializes all settings of keys below kSelfTestMaxKey.
+ *
+ */
+static size_t selfTestDump(otInstance *aInstance, uint8_t *aBuffer)
+{
+    size_t length = 0;
+
+    for (uint16_t key = 0; key < kSelfTestMaxKey; key++)
+    {
+        for (int index = 0;; index++)
         {
-            if (aIndex == 0)
+            uint16_t valueLength = sizeof(sSelfTestData);
+
+            assert(length + sizeof(key) + sizeof(valueLength) + valueLength <= kSelfTestMaxDumpSize);
+
+            if (otPlatSettingsGet(aInstance, key, index, aBuffer + length + sizeof(key) + sizeof(valueLength),
+                                  &valueLength) != OT_ERROR_NONE)
             {
-                VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-                swapWrite(aInstance, swapFd, static_cast<uint16_t>(size - offset));
-                error = OT_ERROR_NONE;
                 break;
             }
-            else if (aIndex == -1)
-            {
-                VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-                error = OT_ERROR_NONE;
-                continue;
-            }
-            else
-            {
-                --aIndex;
-            }
+
+            memcpy(aBuffer + length, &key, sizeof(key));
+            memcpy(aBuffer + length + sizeof(key), &valueLength, sizeof(valueLength));
+            length += sizeof(key) + sizeof(valueLength) + valueLength;
         }
+    }
 
-        rval = write(swapFd, &key, sizeof(key));
-        assert(rval == sizeof(key));
-        VerifyOrDie(rval == sizeof(key), OT_EXIT_FAILURE);
+    return length;
+}
 
-        rval = write(swapFd, &length, sizeof(length));
-        assert(rval == sizeof(length));
-        VerifyOrDie(rval == sizeof(length), OT_EXIT_FAILURE);
+static void selfTestPrepare(otInstance *aInstance)
+{
+    otPlatSettingsWipe(aInstance);
+    assert(otPlatSettingsSet(aInstance, 0, sSelfTestData, sizeof(sSelfTestData)) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(aInstance, 0, sSelfTestData, sizeof(sSelfTestData) / 2) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(aInstance, 1, sSelfTestData, sizeof(sSelfTestData) / 3) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(aInstance, 2, sSelfTestData, sizeof(sSelfTestData) / 4) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(aInstance, 2, sSelfTestData, sizeof(sSelfTestData) / 5) == OT_ERROR_NONE);
+}
 
-        swapWrite(aInstance, swapFd, length);
-    }
+static void selfTestPrepareFullLog(otInstance *aInstance)
+{
+    const size_t kEntrySize = sizeof(LogEntryHeader) + sizeof(sSelfTestData);
 
-exit:
-    VerifyOrDie(error != OT_ERROR_PARSE, OT_EXIT_FAILURE);
+    selfTestPrepare(aInstance);
 
-    if (aSwapFd != nullptr)
-    {
-        *aSwapFd = swapFd;
-    }
-    else if (error == OT_ERROR_NONE)
-    {
-        swapPersist(aInstance, swapFd);
-    }
-    else if (error == OT_ERROR_NOT_FOUND)
+    // Fill the log such that the next addition triggers compaction.
+    while (sLogSize + kEntrySize <= sizeof(LogHeader) + OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACT_SIZE)
     {
-        swapDiscard(aInstance, swapFd);
+        assert(otPlatSettingsAdd(aInstance, 3, sSelfTestData, sizeof(sSelfTestData)) == OT_ERROR_NONE);
     }
+}
 
-    return error;
+static void selfTestAdd(otInstance *aInstance)
+{
+    assert(otPlatSettingsAdd(aInstance, 1, sSelfTestData, sizeof(sSelfTestData)) == OT_ERROR_NONE);
 }
 
-void otPlatSettingsWipe(otInstance *aInstance)
+static void selfTestSet(otInstance *aInstance)
 {
-    OT_UNUSED_VARIABLE(aInstance);
-#if OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
-    otPosixSecureSettingsWipe(aInstance);
-#endif
+    assert(otPlatSettingsSet(aInstance, 0, sSelfTestData, sizeof(sSelfTestData) / 6) == OT_ERROR_NONE);
+}
 
-    VerifyOrDie(0 == ftruncate(sSettingsFd, 0), OT_EXIT_ERROR_ERRNO);
+static void selfTestDeleteOne(otInstance *aInstance)
+{
+    assert(otPlatSettingsDelete(aInstance, 0, 1) == OT_ERROR_NONE);
 }
 
-#ifndef SELF_TEST
-#define SELF_TEST 0
-#endif
+static void selfTestDeleteAll(otInstance *aInstance)
+{
+    assert(otPlatSettingsDelete(aInstance, 2, -1) == OT_ERROR_NONE);
+}
 
-#if SELF_TEST
+static void selfTestWipe(otInstance *aInstance)
+{
+    otPlatSettingsWipe(aInstance);
+}
 
-void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
+/**
+ * This function verifies that settings hold either the state before or the state after @p aOperation when the process
+ * crashes at any point during @p aOperation, and the state after @p aOperation once it returns.
+ *
+ */
+static void selfTestCrash(otInstance *aInstance, SelfTestOperation aPrepare, SelfTestOperation aOperation)
 {
-    OT_UNUSED_VARIABLE(aInstance);
+    uint8_t before[kSelfTestMaxDumpSize];
+    uint8_t after[kSelfTestMaxDumpSize];
+    uint8_t state[kSelfTestMaxDumpSize];
+    size_t  beforeLength;
+    size_t  afterLength;
+    bool    completed = false;
+
+    otPlatSettingsInit(aInstance);
+    aPrepare(aInstance);
+    beforeLength = selfTestDump(aInstance, before);
+    aOperation(aInstance);
+    afterLength = selfTestDump(aInstance, after);
+    otPlatSettingsDeinit(aInstance);
+
+    for (int crashPoint = 1; !completed; crashPoint++)
+    {
+        pid_t  pid;
+        int    status;
+        size_t length;
 
-    memset(aIeeeEui64, 0, sizeof(uint64_t));
+        otPlatSettingsInit(aInstance);
+        aPrepare(aInstance);
+        otPlatSettingsDeinit(aInstance);
+
+        pid = fork();
+        assert(pid != -1);
+
+        if (pid == 0)
+        {
+            otPlatSettingsInit(aInstance);
+            sCrashCountdown = crashPoint;
+            aOperation(aInstance);
+            otPlatSettingsDeinit(aInstance);
+            _exit(0);
+        }
+
+        assert(waitpid(pid, &status, 0) == pid);
+        assert(WIFEXITED(status));
+        assert(WEXITSTATUS(status) == 0 || WEXITSTATUS(status) == kCrashExitCode);
+        completed = (WEXITSTATUS(status) == 0);
+
+        otPlatSettingsInit(aInstance);
+        length = selfTestDump(aInstance, state);
+        assert((length == afterLength && memcmp(state, after, length) == 0) ||
+               (!completed && length == beforeLength && memcmp(state, before, length) == 0));
+
+        // Recovery leaves the settings in a state which can be updated.
+        selfTestAdd(aInstance);
+        otPlatSettingsDeinit(aInstance);
+    }
 }
 
 int main()
@@ -501,7 +954,8 @@ int main()
 
     for (uint8_t i = 0; i < sizeof(data); ++i)
     {
-        data[i] = i;
+        data[i]          = i;
+        sSelfTestData[i] = static_cast<uint8_t>(0xff - i);
     }
 
     otPlatSettingsInit(instance);
@@ -631,6 +1085,14 @@ int main()
     otPlatSettingsWipe(instance);
     otPlatSettingsDeinit(instance);
 
+    // verify settings survive a crash at any point of an update
+    selfTestCrash(instance, selfTestPrepare, selfTestAdd);
+    selfTestCrash(instance, selfTestPrepare, selfTestSet);
+    selfTestCrash(instance, selfTestPrepare, selfTestDeleteOne);
+    selfTestCrash(instance, selfTestPrepare, selfTestDeleteAll);
+    selfTestCrash(instance, selfTestPrepare, selfTestWipe);
+    selfTestCrash(instance, selfTestPrepareFullLog, selfTestAdd);
+
     return 0;
 }
 #endif
@@ -59,6 +59,8 @@
 #include <linux/ioctl.h>
 #include <linux/spi/spidev.h>
 
+#include "posix/platform/mainloop.hpp"
+
 using ot::Spinel::SpinelInterface;
 
 namespace ot {
@@ -217,6 +219,9 @@ void SpiInterface::Deinit(void)
 
     if (mIntGpioValueFd >= 0)
     {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+        IgnoreReturnValue(Mainloop::Get().Unwatch(mIntGpioValueFd));
+#endif
         close(mIntGpioValueFd);
         mIntGpioValueFd = -1;
     }
@@ -305,6 +310,11 @@ void SpiInterface::InitIntPin(const char *aCharDev, uint8_t aLine)
     mIntGpioValueFd = SetupGpioEvent(fd, aLine, GPIOHANDLE_REQUEST_INPUT, GPIOEVENT_REQUEST_FALLING_EDGE, label);
 
     close(fd);
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    // `Process()` reads the interrupt events, so the watched line only stays readable until they are handled.
+    SuccessOrDie(Mainloop::Get().Watch(mIntGpioValueFd, EPOLLIN, nullptr, nullptr));
+#endif
 }
 
 void SpiInterface::InitSpiDev(const char *aPath, uint8_t aMode, uint32_t aSpeed)
@@ -646,6 +656,10 @@ void SpiInterface::UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, int &aMa
     struct timeval pollingTimeout = {0, kSpiPollPeriodUs};
 
     OT_UNUSED_VARIABLE(aWriteFdSet);
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    OT_UNUSED_VARIABLE(aReadFdSet);
+    OT_UNUSED_VARIABLE(aMaxFd);
+#endif
 
     if (mSpiTxIsReady)
     {
@@ -656,10 +670,12 @@ void SpiInterface::UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, int &aMa
 
     if (mIntGpioValueFd >= 0)
     {
+#if !OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
         if (aMaxFd < mIntGpioValueFd)
         {
             aMaxFd = mIntGpioValueFd;
         }
+#endif
 
         if (CheckInterrupt())
         {
@@ -671,8 +687,10 @@ void SpiInterface::UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, int &aMa
         else
         {
             // The interrupt pin was not asserted, so we wait for the interrupt pin to be asserted by adding it to the
-            // read set.
+            // read set. With epoll, the mainloop watches it and reports it in the read set.
+#if !OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
             FD_SET(mIntGpioValueFd, &aReadFdSet);
+#endif
         }
     }
     else if (timercmp(&pollingTimeout, &timeout, <))
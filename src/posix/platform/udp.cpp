@@ -56,6 +56,7 @@
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
 
 #include "posix/platform/ip6_utils.hpp"
+#include "posix/platform/mainloop.hpp"
 
 using namespace ot::Posix::Ip6Utils;
 
@@ -238,6 +239,16 @@ otError otPlatUdpSocket(otUdpSocket *aUdpSocket)
     fd = SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_UDP, kSocketNonBlock);
     VerifyOrExit(fd >= 0, error = OT_ERROR_FAILED);
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    error = ot::Posix::Mainloop::Get().Watch(fd, EPOLLIN, nullptr, nullptr);
+
+    if (error != OT_ERROR_NONE)
+    {
+        close(fd);
+        ExitNow();
+    }
+#endif
+
     aUdpSocket->mHandle = FdToHandle(fd);
 
 exit:
@@ -254,6 +265,9 @@ otError otPlatUdpClose(otUdpSocket *aUdpSocket)
     VerifyOrExit(aUdpSocket->mHandle != nullptr);
 
     fd = FdFromHandle(aUdpSocket->mHandle);
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    IgnoreReturnValue(ot::Posix::Mainloop::Get().Unwatch(fd));
+#endif
     VerifyOrExit(0 == close(fd), error = OT_ERROR_FAILED);
 
     aUdpSocket->mHandle = nullptr;
@@ -541,6 +555,12 @@ exit:
 
 void platformUdpUpdateFdSet(otInstance *aInstance, fd_set *aReadFdSet, int *aMaxFd)
 {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    // The sockets are watched by the mainloop, which reports them in the read set when they are readable.
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aReadFdSet);
+    OT_UNUSED_VARIABLE(aMaxFd);
+#else
     VerifyOrExit(gNetifIndex != 0);
 
     for (otUdpSocket *socket = otUdpGetSockets(aInstance); socket != nullptr; socket = socket->mNext)
@@ -563,6 +583,7 @@ void platformUdpUpdateFdSet(otInstance *aInstance, fd_set *aReadFdSet, int *aMax
 
 exit:
     return;
+#endif
 }
 
 void platformUdpInit(const char *aIfName)
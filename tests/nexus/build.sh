@@ -0,0 +1,57 @@
+#!/bin/bash
+#
+#  Copyright (c) 2021, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+
+set -euxo pipefail
+
+readonly OT_SRCDIR="$(cd "$(dirname "$0")/../.." && pwd)"
+readonly OT_BUILDDIR="${OT_BUILDDIR:-${OT_SRCDIR}/build/nexus}"
+
+mkdir -p "${OT_BUILDDIR}"
+cd "${OT_BUILDDIR}"
+
+cmake \
+    -DCMAKE_POSITION_INDEPENDENT_CODE=ON \
+    -DOT_BUILD_EXECUTABLES=OFF \
+    -DOT_CONFIG="${OT_SRCDIR}/tests/nexus/openthread-core-nexus-config.h" \
+    -DOT_DNS_CLIENT=ON \
+    -DOT_DNSSD_SERVER=ON \
+    -DOT_ECDSA=ON \
+    -DOT_MTD=OFF \
+    -DOT_MULTIPLE_INSTANCE=ON \
+    -DOT_NEXUS=ON \
+    -DOT_PLATFORM=external \
+    -DOT_RCP=OFF \
+    -DOT_SERVICE=ON \
+    -DOT_SRP_CLIENT=ON \
+    -DOT_SRP_SERVER=ON \
+    "$@" \
+    "${OT_SRCDIR}"
+cmake --build . -j"$(nproc)"
+
+ctest --output-on-failure
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2021, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+"""Python bindings of the Nexus in-process simulator.
+
+Example:
+
+    sim = Simulator('build/tests/nexus/libot-nexus.so')
+    leader = sim.create_node()
+    router = sim.create_node()
+    sim.form(leader)
+    sim.advance_time(10 * 1000)
+    sim.join(router, leader, 'rdn')
+    sim.advance_time(120 * 1000)
+    assert sim.get_role(router) == Simulator.ROLE_ROUTER
+"""
+
+import ctypes
+
+
+class Simulator(object):
+    ROLE_DISABLED = 0
+    ROLE_DETACHED = 1
+    ROLE_CHILD = 2
+    ROLE_ROUTER = 3
+    ROLE_LEADER = 4
+
+    RSSI_NONE = 127
+
+    def __init__(self, library_path):
+        self._lib = ctypes.CDLL(library_path)
+
+        self._lib.nexusCreateNode.restype = ctypes.c_int
+        self._lib.nexusGetNumNodes.restype = ctypes.c_uint16
+        self._lib.nexusAdvanceTime.argtypes = [ctypes.c_uint32]
+        self._lib.nexusGetNow.restype = ctypes.c_uint64
+        self._lib.nexusSetLink.argtypes = [
+            ctypes.c_uint16, ctypes.c_uint16, ctypes.c_int8, ctypes.c_uint8, ctypes.c_uint32
+        ]
+        self._lib.nexusSetSeed.argtypes = [ctypes.c_uint32]
+        self._lib.nexusSetLogEnabled.argtypes = [ctypes.c_bool]
+        self._lib.nexusNodeForm.argtypes = [ctypes.c_uint16]
+        self._lib.nexusNodeJoin.argtypes = [ctypes.c_uint16, ctypes.c_uint16, ctypes.c_char_p]
+        self._lib.nexusNodeReset.argtypes = [ctypes.c_uint16]
+        self._lib.nexusNodeGetRole.argtypes = [ctypes.c_uint16]
+
+    def create_node(self):
+        node_id = self._lib.nexusCreateNode()
+        if node_id < 0:
+            raise RuntimeError('Too many nodes')
+        return node_id
+
+    @property
+    def num_nodes(self):
+        return self._lib.nexusGetNumNodes()
+
+    @property
+    def now(self):
+        """Current virtual time in microseconds."""
+        return self._lib.nexusGetNow()
+
+    def advance_time(self, duration):
+        """Advance virtual time by `duration` milliseconds."""
+        self._lib.nexusAdvanceTime(duration)
+
+    def set_link(self, from_id, to_id, rssi=-20, loss_percent=0, latency=0):
+        self._check(self._lib.nexusSetLink(from_id, to_id, rssi, loss_percent, latency))
+
+    def set_links(self, node1, node2, rssi=-20, loss_percent=0, latency=0):
+        self.set_link(node1, node2, rssi, loss_percent, latency)
+        self.set_link(node2, node1, rssi, loss_percent, latency)
+
+    def disconnect(self, node1, node2):
+        self.set_links(node1, node2, rssi=Simulator.RSSI_NONE)
+
+    def disconnect_all_links(self):
+        self._lib.nexusDisconnectAllLinks()
+
+    def set_seed(self, seed):
+        self._lib.nexusSetSeed(seed)
+
+    def set_log_enabled(self, enabled):
+        self._lib.nexusSetLogEnabled(enabled)
+
+    def form(self, node_id):
+        self._check(self._lib.nexusNodeForm(node_id))
+
+    def join(self, node_id, network_node_id, mode='rdn'):
+        self._check(self._lib.nexusNodeJoin(node_id, network_node_id, mode.encode()))
+
+    def reset(self, node_id):
+        self._lib.nexusNodeReset(node_id)
+
+    def get_role(self, node_id):
+        return self._lib.nexusNodeGetRole(node_id)
+
+    @staticmethod
+    def _check(error):
+        if error != 0:
+            raise RuntimeError('OpenThread error %d' % error)
@@ -0,0 +1,161 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the C API of the Nexus in-process simulator.
+ */
+
+#include "nexus_api.h"
+
+#include "common/code_utils.hpp"
+
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+using namespace ot::Nexus;
+
+int nexusCreateNode(void)
+{
+    Node *node = Core::Get().CreateNode();
+
+    return (node != nullptr) ? node->GetId() : -1;
+}
+
+uint16_t nexusGetNumNodes(void)
+{
+    return Core::Get().GetNumNodes();
+}
+
+otInstance *nexusGetInstance(uint16_t aNodeId)
+{
+    Node *node = Core::Get().GetNode(aNodeId);
+
+    return (node != nullptr) ? &node->GetInstance() : nullptr;
+}
+
+void nexusAdvanceTime(uint32_t aDuration)
+{
+    Core::Get().AdvanceTime(aDuration);
+}
+
+uint64_t nexusGetNow(void)
+{
+    return Core::Get().GetNow();
+}
+
+otError nexusSetLink(uint16_t aFromId, uint16_t aToId, int8_t aRssi, uint8_t aLossPercent, uint32_t aLatency)
+{
+    otError error = OT_ERROR_NONE;
+    Node *  from  = Core::Get().GetNode(aFromId);
+    Node *  to    = Core::Get().GetNode(aToId);
+
+    VerifyOrExit((from != nullptr) && (to != nullptr) && (aLossPercent <= 100), error = OT_ERROR_INVALID_ARGS);
+    Core::Get().SetLink(*from, *to, {aRssi, aLossPercent, aLatency});
+
+exit:
+    return error;
+}
+
+void nexusDisconnectAllLinks(void)
+{
+    Core::Get().DisconnectAllLinks();
+}
+
+void nexusSetSeed(uint32_t aSeed)
+{
+    Core::Get().SetSeed(aSeed);
+}
+
+void nexusSetLogEnabled(bool aEnabled)
+{
+    Core::Get().SetLogEnabled(aEnabled);
+}
+
+otError nexusNodeForm(uint16_t aNodeId)
+{
+    otError error = OT_ERROR_NONE;
+    Node *  node  = Core::Get().GetNode(aNodeId);
+
+    VerifyOrExit(node != nullptr, error = OT_ERROR_INVALID_ARGS);
+    error = node->Form();
+
+exit:
+    return error;
+}
+
+otError nexusNodeJoin(uint16_t aNodeId, uint16_t aNetworkNodeId, const char *aMode)
+{
+    otError          error   = OT_ERROR_NONE;
+    Node *           node    = Core::Get().GetNode(aNodeId);
+    Node *           network = Core::Get().GetNode(aNetworkNodeId);
+    otLinkModeConfig mode    = {};
+
+    VerifyOrExit((node != nullptr) && (network != nullptr) && (aMode != nullptr), error = OT_ERROR_INVALID_ARGS);
+
+    for (const char *c = aMode; *c != '\0'; c++)
+    {
+        switch (*c)
+        {
+        case 'r':
+            mode.mRxOnWhenIdle = true;
+            break;
+        case 'd':
+            mode.mDeviceType = true;
+            break;
+        case 'n':
+            mode.mNetworkData = true;
+            break;
+        default:
+            ExitNow(error = OT_ERROR_INVALID_ARGS);
+        }
+    }
+
+    error = node->Join(*network, mode);
+
+exit:
+    return error;
+}
+
+void nexusNodeReset(uint16_t aNodeId)
+{
+    Node *node = Core::Get().GetNode(aNodeId);
+
+    VerifyOrExit(node != nullptr);
+    node->Reset();
+
+exit:
+    return;
+}
+
+otDeviceRole nexusNodeGetRole(uint16_t aNodeId)
+{
+    Node *node = Core::Get().GetNode(aNodeId);
+
+    return (node != nullptr) ? otThreadGetDeviceRole(&node->GetInstance()) : OT_DEVICE_ROLE_DISABLED;
+}
@@ -0,0 +1,177 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file defines the C API of the Nexus in-process simulator.
+ *
+ *   The API is intended for scripting a simulation from other languages (e.g., from Python through `ctypes`, see
+ *   `nexus.py`). Nodes are identified by the id returned from `nexusCreateNode()`.
+ */
+
+#ifndef NEXUS_API_H_
+#define NEXUS_API_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <openthread/error.h>
+#include <openthread/instance.h>
+#include <openthread/thread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * This function creates a new node.
+ *
+ * @returns The id of the new node, or a negative value if the maximum number of nodes is reached.
+ *
+ */
+int nexusCreateNode(void);
+
+/**
+ * This function gets the number of nodes.
+ *
+ * @returns The number of nodes.
+ *
+ */
+uint16_t nexusGetNumNodes(void);
+
+/**
+ * This function gets the OpenThread instance of a node.
+ *
+ * @param[in]  aNodeId  The node id.
+ *
+ * @returns A pointer to the OpenThread instance, or NULL if @p aNodeId is not valid.
+ *
+ */
+otInstance *nexusGetInstance(uint16_t aNodeId);
+
+/**
+ * This function advances the virtual time, processing all events until then.
+ *
+ * @param[in]  aDuration  The duration (in milliseconds).
+ *
+ */
+void nexusAdvanceTime(uint32_t aDuration);
+
+/**
+ * This function gets the current virtual time.
+ *
+ * @returns The current virtual time (in microseconds).
+ *
+ */
+uint64_t nexusGetNow(void);
+
+/**
+ * This function sets the one-way link from one node to another.
+ *
+ * @param[in]  aFromId       The transmitting node id.
+ * @param[in]  aToId         The receiving node id.
+ * @param[in]  aRssi         The RSSI (in dBm), or `OT_RADIO_RSSI_INVALID` to disconnect the nodes.
+ * @param[in]  aLossPercent  The probability (in percent) that a frame is lost.
+ * @param[in]  aLatency      The latency (in microseconds).
+ *
+ * @retval OT_ERROR_NONE          Successfully set the link.
+ * @retval OT_ERROR_INVALID_ARGS  A node id is not valid.
+ *
+ */
+otError nexusSetLink(uint16_t aFromId, uint16_t aToId, int8_t aRssi, uint8_t aLossPercent, uint32_t aLatency);
+
+/**
+ * This function disconnects all links between all nodes.
+ *
+ */
+void nexusDisconnectAllLinks(void);
+
+/**
+ * This function sets the seed of the random number generator shared by all nodes.
+ *
+ * @param[in]  aSeed  The seed.
+ *
+ */
+void nexusSetSeed(uint32_t aSeed);
+
+/**
+ * This function enables or disables logging.
+ *
+ * @param[in]  aEnabled  TRUE to enable logging, FALSE otherwise.
+ *
+ */
+void nexusSetLogEnabled(bool aEnabled);
+
+/**
+ * This function makes a node form a new Thread network (as leader).
+ *
+ * @param[in]  aNodeId  The node id.
+ *
+ * @returns The error from the underlying OpenThread APIs, or OT_ERROR_INVALID_ARGS if @p aNodeId is not valid.
+ *
+ */
+otError nexusNodeForm(uint16_t aNodeId);
+
+/**
+ * This function makes a node join the Thread network of another node.
+ *
+ * @param[in]  aNodeId        The node id.
+ * @param[in]  aNetworkNodeId The id of a node already in the network.
+ * @param[in]  aMode          The MLE link mode as a string of "r" (rx-on-when-idle), "d" (FTD) and "n" (full
+ *                            network data), e.g., "rdn".
+ *
+ * @returns The error from the underlying OpenThread APIs, or OT_ERROR_INVALID_ARGS if an argument is not valid.
+ *
+ */
+otError nexusNodeJoin(uint16_t aNodeId, uint16_t aNetworkNodeId, const char *aMode);
+
+/**
+ * This function resets a node.
+ *
+ * The node's settings are retained.
+ *
+ * @param[in]  aNodeId  The node id.
+ *
+ */
+void nexusNodeReset(uint16_t aNodeId);
+
+/**
+ * This function gets the device role of a node.
+ *
+ * @param[in]  aNodeId  The node id.
+ *
+ * @returns The device role, or OT_DEVICE_ROLE_DISABLED if @p aNodeId is not valid.
+ *
+ */
+otDeviceRole nexusNodeGetRole(uint16_t aNodeId);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // NEXUS_API_H_
@@ -0,0 +1,157 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the OpenThread core configuration for the Nexus in-process simulator.
+ */
+
+#ifndef OPENTHREAD_CORE_NEXUS_CONFIG_H_
+#define OPENTHREAD_CORE_NEXUS_CONFIG_H_
+
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_INFO
+ *
+ * The platform-specific string to insert into the OpenThread version string.
+ *
+ */
+#define OPENTHREAD_CONFIG_PLATFORM_INFO "NEXUS"
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_OUTPUT
+ *
+ * Nexus emits logs through `otPlatLog()` prefixed with the virtual time and the node id.
+ *
+ */
+#define OPENTHREAD_CONFIG_LOG_OUTPUT OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_LEVEL
+ *
+ * The log level used by Nexus nodes.
+ *
+ */
+#define OPENTHREAD_CONFIG_LOG_LEVEL OT_LOG_LEVEL_INFO
+
+/**
+ * @def OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+ *
+ * Nexus nodes share the process heap (`otPlatCAlloc()`/`otPlatFree()`) since the built-in heap is a single static
+ * buffer and is not sized for hundreds of instances.
+ *
+ */
+#define OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE 1
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE
+ *
+ * Nexus enables the DNS client response cache (used when the DNS client is enabled) so that it can be tested.
+ *
+ */
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_ENABLE 1
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL
+ *
+ * Shorter than the default (one day) to keep the simulated time of the DNS client cache test short.
+ *
+ */
+#define OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL 3600
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_MAX_CHILDREN
+ *
+ * Nexus allows the largest child table supported by the RLOC16 child ID space so that schedulers and tables can be
+ * exercised at scale.
+ *
+ */
+#define OPENTHREAD_CONFIG_MLE_MAX_CHILDREN 511
+
+/**
+ * @def OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS
+ *
+ * Nexus uses a larger message pool so that deep send queues (e.g., for many sleepy children) can be exercised.
+ *
+ */
+#define OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS 512
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH
+ *
+ * Nexus reserves message buffers for high and network control priority messages so that the reservations can be
+ * tested.
+ *
+ */
+#define OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH 8
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NET
+ *
+ * Nexus reserves message buffers for network control priority messages so that the reservations can be tested.
+ *
+ */
+#define OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NET 8
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES
+ *
+ * Nexus uses a large EID-to-RLOC cache (as used by a border router forwarding to many EIDs) so that the cache can be
+ * exercised at scale.
+ *
+ */
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES 1024
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE
+ *
+ * Nexus indexes CoAP resources by Uri-Path so that the hashed dispatch is exercised.
+ *
+ */
+#define OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE 64
+
+/**
+ * @def OPENTHREAD_NEXUS_CONFIG_MAX_NODES
+ *
+ * The maximum number of nodes in a Nexus simulation.
+ *
+ */
+#ifndef OPENTHREAD_NEXUS_CONFIG_MAX_NODES
+#define OPENTHREAD_NEXUS_CONFIG_MAX_NODES 256
+#endif
+
+/**
+ * @def OPENTHREAD_NEXUS_CONFIG_SETTINGS_BUFFER_SIZE
+ *
+ * The size (in bytes) of the in-memory settings storage of each Nexus node.
+ *
+ */
+#ifndef OPENTHREAD_NEXUS_CONFIG_SETTINGS_BUFFER_SIZE
+#define OPENTHREAD_NEXUS_CONFIG_SETTINGS_BUFFER_SIZE 4096
+#endif
+
+#endif // OPENTHREAD_CORE_NEXUS_CONFIG_H_
@@ -0,0 +1,436 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the Nexus simulation core.
+ */
+
+#include "nexus_core.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <openthread/tasklet.h>
+#include <openthread/platform/alarm-milli.h>
+
+#include "common/code_utils.hpp"
+#include "common/debug.hpp"
+
+#include "nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+Core Core::sCore;
+
+Core::Core(void)
+    : mNow(0)
+    , mNumEvents(0)
+    , mRandomState(1)
+    , mNumNodes(0)
+    , mLogEnabled(false)
+    , mTaskletsPending(false)
+    , mCurrentNode(nullptr)
+    , mRadioEvents(nullptr)
+{
+    for (Link(&links)[kMaxNodes] : mLinks)
+    {
+        for (Link &link : links)
+        {
+            link.mRssi        = kDefaultRssi;
+            link.mLossPercent = 0;
+            link.mLatency     = 0;
+        }
+    }
+}
+
+Node *Core::CreateNode(void)
+{
+    Node *node = nullptr;
+
+    VerifyOrExit(mNumNodes < kMaxNodes);
+
+    node = static_cast<Node *>(calloc(1, sizeof(Node)));
+    VerifyOrExit(node != nullptr);
+
+    mNodes[mNumNodes] = node;
+
+    SetCurrentNode(node);
+    node->Init(mNumNodes++);
+    SetCurrentNode(nullptr);
+
+exit:
+    return node;
+}
+
+void Core::SetLink(const Node &aFrom, const Node &aTo, const Link &aLink)
+{
+    mLinks[aFrom.GetId()][aTo.GetId()] = aLink;
+}
+
+void Core::SetLinks(const Node &aNode1, const Node &aNode2, const Link &aLink)
+{
+    SetLink(aNode1, aNode2, aLink);
+    SetLink(aNode2, aNode1, aLink);
+}
+
+const Link &Core::GetLink(const Node &aFrom, const Node &aTo) const
+{
+    return mLinks[aFrom.GetId()][aTo.GetId()];
+}
+
+void Core::DisconnectAllLinks(void)
+{
+    for (Link(&links)[kMaxNodes] : mLinks)
+    {
+        for (Link &link : links)
+        {
+            link.mRssi = Link::kRssiNone;
+        }
+    }
+}
+
+uint32_t Core::GetRandom(void)
+{
+    // xorshift32
+    mRandomState ^= mRandomState << 13;
+    mRandomState ^= mRandomState >> 17;
+    mRandomState ^= mRandomState << 5;
+
+    return mRandomState;
+}
+
+void Core::AdvanceTime(uint32_t aDuration)
+{
+    uint64_t endTime = mNow + static_cast<uint64_t>(aDuration) * 1000;
+
+    while (true)
+    {
+        uint64_t nextTime;
+
+        ProcessTasklets();
+
+        nextTime = GetNextEventTime();
+        VerifyOrExit(nextTime <= endTime);
+
+        if (nextTime > mNow)
+        {
+            mNow = nextTime;
+        }
+
+        ProcessEvents();
+    }
+
+exit:
+    mNow = endTime;
+}
+
+void Core::SignalTaskletsPending(Node &aNode)
+{
+    aNode.mTaskletsPending = true;
+    mTaskletsPending       = true;
+}
+
+void Core::ProcessTasklets(void)
+{
+    while (mTaskletsPending)
+    {
+        mTaskletsPending = false;
+
+        for (uint16_t i = 0; i < mNumNodes; i++)
+        {
+            Node &node = *mNodes[i];
+
+            if (node.mTaskletsPending)
+            {
+                node.mTaskletsPending = false;
+
+                SetCurrentNode(&node);
+                otTaskletsProcess(&node.GetInstance());
+                node.ProcessResetRequest();
+                SetCurrentNode(nullptr);
+            }
+        }
+    }
+}
+
+uint64_t Core::GetNextEventTime(void) const
+{
+    uint64_t nextTime = UINT64_MAX;
+
+    if (mRadioEvents != nullptr)
+    {
+        nextTime = mRadioEvents->mTime;
+    }
+
+    for (uint16_t i = 0; i < mNumNodes; i++)
+    {
+        const Node::Alarm &alarm = mNodes[i]->mAlarm;
+
+        if (alarm.mRunning && (alarm.mFireTime < nextTime))
+        {
+            nextTime = alarm.mFireTime;
+        }
+    }
+
+    return nextTime;
+}
+
+void Core::ProcessEvents(void)
+{
+    while ((mRadioEvents != nullptr) && (mRadioEvents->mTime <= mNow))
+    {
+        RadioEvent *event = mRadioEvents;
+
+        mRadioEvents = event->mNext;
+        mNumEvents++;
+
+        SetCurrentNode(event->mNode);
+        ProcessRadioEvent(*event);
+        event->mNode->ProcessResetRequest();
+        SetCurrentNode(nullptr);
+
+        free(event);
+    }
+
+    for (uint16_t i = 0; i < mNumNodes; i++)
+    {
+        Node &node = *mNodes[i];
+
+        if (node.mAlarm.mRunning && (node.mAlarm.mFireTime <= mNow))
+        {
+            node.mAlarm.mRunning = false;
+            mNumEvents++;
+
+            SetCurrentNode(&node);
+            otPlatAlarmMilliFired(&node.GetInstance());
+            node.ProcessResetRequest();
+            SetCurrentNode(nullptr);
+        }
+    }
+}
+
+void Core::Transmit(Node &aNode, const otRadioFrame &aFrame)
+{
+    // The transmitted frame is delivered to every node with a link from the sender (unless lost on the link) at the
+    // end of the frame air time plus the link latency. Whether the frame is acknowledged is determined now, based on
+    // the current state of the destination radio. The transmit done event is scheduled at the end of the frame when
+    // no ACK is requested, after the ACK reception when acknowledged, or after the ACK wait duration otherwise.
+
+    const Mac::RxFrame &frame        = *static_cast<const Mac::RxFrame *>(&aFrame);
+    uint64_t            frameEndTime = mNow + GetFrameDuration(aFrame.mLength);
+    bool                ackRequested = frame.GetAckRequest();
+    RadioEvent *        txDone;
+
+    txDone = static_cast<RadioEvent *>(calloc(1, sizeof(RadioEvent)));
+    OT_ASSERT(txDone != nullptr);
+
+    txDone->mNode    = &aNode;
+    txDone->mType    = RadioEvent::kTypeTransmitDone;
+    txDone->mChannel = aFrame.mChannel;
+    txDone->mTime    = ackRequested ? frameEndTime + kAckWaitDuration : frameEndTime;
+
+    for (uint16_t i = 0; i < mNumNodes; i++)
+    {
+        Node &      receiver = *mNodes[i];
+        const Link &link     = mLinks[aNode.GetId()][i];
+        RadioEvent *event;
+
+        if ((&receiver == &aNode) || !link.IsConnected())
+        {
+            continue;
+        }
+
+        if ((link.mLossPercent != 0) && ((GetRandom() % kLossRange) < link.mLossPercent))
+        {
+            continue;
+        }
+
+        event = static_cast<RadioEvent *>(calloc(1, sizeof(RadioEvent)));
+        OT_ASSERT(event != nullptr);
+
+        event->mTime    = frameEndTime + link.mLatency;
+        event->mNode    = &receiver;
+        event->mType    = RadioEvent::kTypeReceive;
+        event->mChannel = aFrame.mChannel;
+        event->mRssi    = link.mRssi;
+        event->mLength  = static_cast<uint8_t>(aFrame.mLength);
+        memcpy(event->mPsdu, aFrame.mPsdu, aFrame.mLength);
+
+        if (ackRequested && !txDone->mAcked && (receiver.mRadio.mState == OT_RADIO_STATE_RECEIVE) &&
+            (receiver.mRadio.mChannel == aFrame.mChannel) && receiver.mRadio.DoesAddressMatch(frame))
+        {
+            const Link &ackLink = mLinks[i][aNode.GetId()];
+
+            event->mAcked           = true;
+            event->mAckFramePending = receiver.mRadio.HasFramePending(frame);
+
+            if (ackLink.IsConnected() &&
+                ((ackLink.mLossPercent == 0) || ((GetRandom() % kLossRange) >= ackLink.mLossPercent)))
+            {
+                txDone->mAcked           = true;
+                txDone->mAckFramePending = event->mAckFramePending;
+                txDone->mRssi            = ackLink.mRssi;
+                txDone->mTime = event->mTime + kTurnaroundTime + GetFrameDuration(kImmAckSize) + ackLink.mLatency;
+            }
+        }
+
+        ScheduleRadioEvent(*event);
+    }
+
+    ScheduleRadioEvent(*txDone);
+}
+
+void Core::TransmitAt(Node &aNode, otRadioFrame &aFrame, uint64_t aStartTime)
+{
+    RadioEvent *txStart;
+
+    if (aStartTime <= mNow)
+    {
+        otPlatRadioTxStarted(&aNode.GetInstance(), &aFrame);
+        Transmit(aNode, aFrame);
+        ExitNow();
+    }
+
+    txStart = static_cast<RadioEvent *>(calloc(1, sizeof(RadioEvent)));
+    OT_ASSERT(txStart != nullptr);
+
+    txStart->mNode    = &aNode;
+    txStart->mType    = RadioEvent::kTypeTransmitStart;
+    txStart->mChannel = aFrame.mChannel;
+    txStart->mTime    = aStartTime;
+
+    ScheduleRadioEvent(*txStart);
+
+exit:
+    return;
+}
+
+void Core::ScheduleRadioEvent(RadioEvent &aEvent)
+{
+    // Keep the list sorted by time (events with the same time are kept in the order they were scheduled).
+
+    RadioEvent *prev = nullptr;
+
+    for (RadioEvent *cur = mRadioEvents; (cur != nullptr) && (cur->mTime <= aEvent.mTime); cur = cur->mNext)
+    {
+        prev = cur;
+    }
+
+    if (prev == nullptr)
+    {
+        aEvent.mNext = mRadioEvents;
+        mRadioEvents = &aEvent;
+    }
+    else
+    {
+        aEvent.mNext = prev->mNext;
+        prev->mNext  = &aEvent;
+    }
+}
+
+void Core::ProcessRadioEvent(RadioEvent &aEvent)
+{
+    Radio &radio = aEvent.mNode->mRadio;
+
+    switch (aEvent.mType)
+    {
+    case RadioEvent::kTypeReceive:
+        VerifyOrExit((radio.mState == OT_RADIO_STATE_RECEIVE) && (radio.mChannel == aEvent.mChannel));
+
+        memcpy(radio.mRxPsdu, aEvent.mPsdu, aEvent.mLength);
+        radio.mRxFrame.mLength                              = aEvent.mLength;
+        radio.mRxFrame.mChannel                             = aEvent.mChannel;
+        radio.mRxFrame.mInfo.mRxInfo.mTimestamp             = mNow;
+        radio.mRxFrame.mInfo.mRxInfo.mRssi                  = aEvent.mRssi;
+        radio.mRxFrame.mInfo.mRxInfo.mLqi                   = OT_RADIO_LQI_NONE;
+        radio.mRxFrame.mInfo.mRxInfo.mAckedWithFramePending = aEvent.mAcked && aEvent.mAckFramePending;
+        radio.mRxFrame.mInfo.mRxInfo.mAckedWithSecEnhAck    = false;
+
+        VerifyOrExit(radio.mPromiscuous || radio.DoesAddressMatch(radio.mRxFrame));
+
+        radio.mNumRxFrames++;
+        otPlatRadioReceiveDone(&aEvent.mNode->GetInstance(), &radio.mRxFrame, OT_ERROR_NONE);
+        break;
+
+    case RadioEvent::kTypeTransmitStart:
+        VerifyOrExit(radio.mState == OT_RADIO_STATE_TRANSMIT);
+
+        otPlatRadioTxStarted(&aEvent.mNode->GetInstance(), &radio.mTxFrame);
+        Transmit(*aEvent.mNode, radio.mTxFrame);
+        break;
+
+    case RadioEvent::kTypeTransmitDone:
+        VerifyOrExit(radio.mState == OT_RADIO_STATE_TRANSMIT);
+
+        radio.mState = OT_RADIO_STATE_RECEIVE;
+        radio.mNumTxFrames++;
+
+        if (!radio.mTxFrame.GetAckRequest())
+        {
+            otPlatRadioTxDone(&aEvent.mNode->GetInstance(), &radio.mTxFrame, nullptr, OT_ERROR_NONE);
+        }
+        else if (aEvent.mAcked)
+        {
+            // The ACK is generated from the transmitted frame (as received by the destination).
+            const otRadioFrame &txRadioFrame  = radio.mTxFrame;
+            otRadioFrame &      ackRadioFrame = radio.mAckFrame;
+            const Mac::RxFrame &txFrame       = *static_cast<const Mac::RxFrame *>(&txRadioFrame);
+            Mac::TxFrame &      ackFrame      = *static_cast<Mac::TxFrame *>(&ackRadioFrame);
+
+            if (txFrame.IsVersion2015())
+            {
+                IgnoreError(ackFrame.GenerateEnhAck(txFrame, aEvent.mAckFramePending, nullptr, 0));
+            }
+            else
+            {
+                ackFrame.GenerateImmAck(txFrame, aEvent.mAckFramePending);
+            }
+
+            radio.mAckFrame.mChannel                 = aEvent.mChannel;
+            radio.mAckFrame.mInfo.mRxInfo.mRssi      = aEvent.mRssi;
+            radio.mAckFrame.mInfo.mRxInfo.mLqi       = OT_RADIO_LQI_NONE;
+            radio.mAckFrame.mInfo.mRxInfo.mTimestamp = mNow;
+
+            otPlatRadioTxDone(&aEvent.mNode->GetInstance(), &radio.mTxFrame, &radio.mAckFrame, OT_ERROR_NONE);
+        }
+        else
+        {
+            otPlatRadioTxDone(&aEvent.mNode->GetInstance(), &radio.mTxFrame, nullptr, OT_ERROR_NO_ACK);
+        }
+
+        break;
+    }
+
+exit:
+    return;
+}
+
+} // namespace Nexus
+} // namespace ot
@@ -0,0 +1,329 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the Nexus simulation core.
+ *
+ *   Nexus runs many OpenThread instances (nodes) in a single process. It provides a discrete-event scheduler over a
+ *   shared virtual time and an in-memory radio medium, with a configurable link (RSSI, loss, latency) between each
+ *   pair of nodes.
+ */
+
+#ifndef NEXUS_CORE_HPP_
+#define NEXUS_CORE_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include <openthread/platform/radio.h>
+
+namespace ot {
+namespace Nexus {
+
+class Node;
+
+/**
+ * This structure represents the link from one node to another.
+ *
+ */
+struct Link
+{
+    enum : int8_t
+    {
+        kRssiNone = OT_RADIO_RSSI_INVALID, ///< RSSI value indicating there is no link.
+    };
+
+    /**
+     * This method indicates whether the link is connected.
+     *
+     * @retval TRUE   Frames sent by the first node can be received by the second one.
+     * @retval FALSE  There is no link between the two nodes.
+     *
+     */
+    bool IsConnected(void) const { return mRssi != kRssiNone; }
+
+    int8_t   mRssi;        ///< RSSI (in dBm) of frames received over the link, or `kRssiNone` for no link.
+    uint8_t  mLossPercent; ///< Probability (in percent) that a frame is lost on the link.
+    uint32_t mLatency;     ///< Delay (in microseconds) added to the frame air time.
+};
+
+/**
+ * This class implements the Nexus simulation core.
+ *
+ * There is a single `Core` object which owns all nodes. All nodes share a virtual time which only moves forward when
+ * `AdvanceTime()` is called. Time jumps directly to the next pending event (alarm or radio frame), so a simulation
+ * runs as fast as the nodes can process their events.
+ *
+ */
+class Core
+{
+public:
+    enum : uint16_t
+    {
+        kMaxNodes = OPENTHREAD_NEXUS_CONFIG_MAX_NODES, ///< Maximum number of nodes.
+    };
+
+    enum : int8_t
+    {
+        kDefaultRssi = -20, ///< RSSI (in dBm) of the default link between two nodes.
+    };
+
+    /**
+     * This static method returns the `Core` object.
+     *
+     * @returns A reference to the `Core` object.
+     *
+     */
+    static Core &Get(void) { return sCore; }
+
+    /**
+     * This method creates a new node.
+     *
+     * The new node is connected to all existing nodes using the default link (`kDefaultRssi`, no loss or latency).
+     *
+     * @returns A pointer to the new node, or `nullptr` if the maximum number of nodes was reached.
+     *
+     */
+    Node *CreateNode(void);
+
+    /**
+     * This method returns the number of nodes.
+     *
+     * @returns The number of nodes.
+     *
+     */
+    uint16_t GetNumNodes(void) const { return mNumNodes; }
+
+    /**
+     * This method returns the node with a given id.
+     *
+     * @param[in] aId   The node id (nodes are numbered from zero in the order they are created).
+     *
+     * @returns A pointer to the node, or `nullptr` if @p aId is not valid.
+     *
+     */
+    Node *GetNode(uint16_t aId) { return (aId < mNumNodes) ? mNodes[aId] : nullptr; }
+
+    /**
+     * This method returns the current virtual time.
+     *
+     * @returns The current virtual time (in microseconds).
+     *
+     */
+    uint64_t GetNow(void) const { return mNow; }
+
+    /**
+     * This method advances the virtual time, processing all events (tasklets, alarms, radio frames) up to the new
+     * time.
+     *
+     * @param[in] aDuration  The duration (in milliseconds) to advance the time by.
+     *
+     */
+    void AdvanceTime(uint32_t aDuration);
+
+    /**
+     * This method sets the link from one node to another.
+     *
+     * @param[in] aFrom  The transmitting node.
+     * @param[in] aTo    The receiving node.
+     * @param[in] aLink  The link parameters.
+     *
+     */
+    void SetLink(const Node &aFrom, const Node &aTo, const Link &aLink);
+
+    /**
+     * This method sets the links in both directions between two nodes.
+     *
+     * @param[in] aNode1  The first node.
+     * @param[in] aNode2  The second node.
+     * @param[in] aLink   The link parameters.
+     *
+     */
+    void SetLinks(const Node &aNode1, const Node &aNode2, const Link &aLink);
+
+    /**
+     * This method returns the link from one node to another.
+     *
+     * @param[in] aFrom  The transmitting node.
+     * @param[in] aTo    The receiving node.
+     *
+     * @returns The link parameters.
+     *
+     */
+    const Link &GetLink(const Node &aFrom, const Node &aTo) const;
+
+    /**
+     * This method disconnects all the links between all the nodes.
+     *
+     * This is intended for setting up a topology using `SetLinks()`.
+     *
+     */
+    void DisconnectAllLinks(void);
+
+    /**
+     * This method seeds the random number generator used for entropy and frame loss.
+     *
+     * @param[in] aSeed  The seed.
+     *
+     */
+    void SetSeed(uint32_t aSeed) { mRandomState = (aSeed != 0) ? aSeed : 1; }
+
+    /**
+     * This method returns a random number.
+     *
+     * @returns A random `uint32_t` value.
+     *
+     */
+    uint32_t GetRandom(void);
+
+    /**
+     * This method enables or disables printing of the nodes' logs.
+     *
+     * @param[in] aEnabled  TRUE to print the logs, FALSE otherwise.
+     *
+     */
+    void SetLogEnabled(bool aEnabled) { mLogEnabled = aEnabled; }
+
+    /**
+     * This method indicates whether printing of the nodes' logs is enabled.
+     *
+     * @returns TRUE if logs are printed, FALSE otherwise.
+     *
+     */
+    bool IsLogEnabled(void) const { return mLogEnabled; }
+
+    /**
+     * This method returns the node currently processing an event (e.g., for log output).
+     *
+     * @returns A pointer to the node currently processing an event, or `nullptr` if none.
+     *
+     */
+    Node *GetCurrentNode(void) { return mCurrentNode; }
+
+    /**
+     * This method returns the number of events processed so far.
+     *
+     * @returns The number of processed events (alarms and radio frames).
+     *
+     */
+    uint64_t GetNumEvents(void) const { return mNumEvents; }
+
+    /**
+     * This method signals that a node has pending tasklets (used by `otTaskletsSignalPending()`).
+     *
+     * @param[in] aNode  The node with pending tasklets.
+     *
+     */
+    void SignalTaskletsPending(Node &aNode);
+
+    /**
+     * This method transmits a frame from a node on the radio medium (used by `otPlatRadioTransmit()`).
+     *
+     * @param[in] aNode   The transmitting node.
+     * @param[in] aFrame  The frame to transmit.
+     *
+     */
+    void Transmit(Node &aNode, const otRadioFrame &aFrame);
+
+    /**
+     * This method transmits a frame from a node at a given time (used by `otPlatRadioTransmit()` for frames with a
+     * transmit delay).
+     *
+     * The frame is transmitted immediately if the time has already passed.
+     *
+     * @param[in] aNode       The transmitting node.
+     * @param[in] aFrame      The frame to transmit.
+     * @param[in] aStartTime  The time (in microseconds) to start the transmission.
+     *
+     */
+    void TransmitAt(Node &aNode, otRadioFrame &aFrame, uint64_t aStartTime);
+
+private:
+    enum : uint32_t
+    {
+        kSymbolTime      = 16,                   // Symbol duration (usec) in 2.4 GHz O-QPSK PHY.
+        kByteTime        = 2 * kSymbolTime,      // Duration (usec) of one byte.
+        kPhyHeaderSize   = 6,                    // SHR (4 bytes preamble, 1 byte SFD) and PHR (1 byte).
+        kImmAckSize      = 5,                    // Imm-Ack PSDU size including FCS.
+        kTurnaroundTime  = 12 * kSymbolTime,     // aTurnaroundTime (usec).
+        kAckWaitDuration = 54 * kSymbolTime,     // macAckWaitDuration (usec).
+        kLossRange       = 100,                  // Range of `Link::mLossPercent`.
+    };
+
+    struct RadioEvent
+    {
+        enum Type : uint8_t
+        {
+            kTypeReceive,       // Frame received by `mNode`.
+            kTypeTransmitStart, // Delayed frame transmit starts on `mNode`.
+            kTypeTransmitDone,  // Frame transmit done on `mNode`.
+        };
+
+        RadioEvent *mNext;
+        uint64_t    mTime;
+        Node *      mNode;
+        Type        mType;
+        uint8_t     mChannel;
+        int8_t      mRssi;
+        bool        mAcked;
+        bool        mAckFramePending;
+        uint8_t     mLength;
+        uint8_t     mPsdu[OT_RADIO_FRAME_MAX_SIZE];
+    };
+
+    Core(void);
+
+    void     ScheduleRadioEvent(RadioEvent &aEvent);
+    void     ProcessTasklets(void);
+    uint64_t GetNextEventTime(void) const;
+    void     ProcessEvents(void);
+    void     ProcessRadioEvent(RadioEvent &aEvent);
+    void     SetCurrentNode(Node *aNode) { mCurrentNode = aNode; }
+
+    static uint32_t GetFrameDuration(uint8_t aPsduLength) { return (kPhyHeaderSize + aPsduLength) * kByteTime; }
+
+    static Core sCore;
+
+    uint64_t    mNow;
+    uint64_t    mNumEvents;
+    uint32_t    mRandomState;
+    uint16_t    mNumNodes;
+    bool        mLogEnabled;
+    bool        mTaskletsPending;
+    Node *      mCurrentNode;
+    RadioEvent *mRadioEvents;
+    Node *      mNodes[kMaxNodes];
+    Link        mLinks[kMaxNodes][kMaxNodes];
+};
+
+} // namespace Nexus
+} // namespace ot
+
+#endif // NEXUS_CORE_HPP_
@@ -0,0 +1,115 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a Nexus node.
+ */
+
+#include "nexus_node.hpp"
+
+#include <type_traits>
+
+#include <openthread/dataset.h>
+#include <openthread/dataset_ftd.h>
+#include <openthread/ip6.h>
+
+#include "common/code_utils.hpp"
+#include "common/debug.hpp"
+
+namespace ot {
+namespace Nexus {
+
+static_assert(std::is_standard_layout<Node>::value, "Node must be standard layout (to be found from otInstance)");
+
+void Node::Init(uint16_t aId)
+{
+    mId = aId;
+    mSettings.Wipe();
+    Reset();
+}
+
+void Node::Reset(void)
+{
+    otInstance *instance = &GetInstance();
+    size_t      size     = sizeof(mInstanceRaw);
+
+    if (GetInstance().IsInitialized())
+    {
+        otInstanceFinalize(instance);
+    }
+
+    mTaskletsPending = false;
+    mResetRequested  = false;
+    mAlarm.mRunning  = false;
+    mRadio.Reset();
+
+    instance = otInstanceInit(mInstanceRaw, &size);
+    OT_ASSERT(instance == &GetInstance());
+    OT_UNUSED_VARIABLE(instance);
+}
+
+void Node::ProcessResetRequest(void)
+{
+    if (mResetRequested)
+    {
+        Reset();
+    }
+}
+
+otError Node::Form(void)
+{
+    otError              error;
+    otOperationalDataset dataset;
+
+    SuccessOrExit(error = otDatasetCreateNewNetwork(&GetInstance(), &dataset));
+    SuccessOrExit(error = otDatasetSetActive(&GetInstance(), &dataset));
+    SuccessOrExit(error = otIp6SetEnabled(&GetInstance(), true));
+    error = otThreadSetEnabled(&GetInstance(), true);
+
+exit:
+    return error;
+}
+
+otError Node::Join(Node &aNode, const otLinkModeConfig &aMode)
+{
+    otError              error;
+    otOperationalDataset dataset;
+
+    SuccessOrExit(error = otDatasetGetActive(&aNode.GetInstance(), &dataset));
+    SuccessOrExit(error = otDatasetSetActive(&GetInstance(), &dataset));
+    SuccessOrExit(error = otThreadSetLinkMode(&GetInstance(), aMode));
+    SuccessOrExit(error = otIp6SetEnabled(&GetInstance(), true));
+    error = otThreadSetEnabled(&GetInstance(), true);
+
+exit:
+    return error;
+}
+
+} // namespace Nexus
+} // namespace ot
@@ -0,0 +1,150 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a Nexus node.
+ */
+
+#ifndef NEXUS_NODE_HPP_
+#define NEXUS_NODE_HPP_
+
+#include "openthread-core-config.h"
+
+#include <openthread/instance.h>
+#include <openthread/thread.h>
+
+#include "common/instance.hpp"
+
+#include "nexus_radio.hpp"
+#include "nexus_settings.hpp"
+
+namespace ot {
+namespace Nexus {
+
+/**
+ * This class represents a Nexus node, i.e. an OpenThread instance along with its platform state (alarm, radio, and
+ * settings).
+ *
+ * The OpenThread instance is placed at the start of the `Node` object, so the node is directly found from the
+ * `otInstance` pointer passed to the platform APIs.
+ *
+ */
+class Node
+{
+public:
+    /**
+     * This structure represents the millisecond alarm of a node.
+     *
+     */
+    struct Alarm
+    {
+        bool     mRunning;  ///< Whether the alarm is running.
+        uint64_t mFireTime; ///< The fire time (virtual time in microseconds).
+    };
+
+    /**
+     * This method initializes the node (and its OpenThread instance).
+     *
+     * @param[in] aId  The node id.
+     *
+     */
+    void Init(uint16_t aId);
+
+    /**
+     * This static method returns the node owning a given OpenThread instance.
+     *
+     * @param[in] aInstance  A pointer to the OpenThread instance.
+     *
+     * @returns A reference to the node.
+     *
+     */
+    static Node &From(otInstance *aInstance) { return *reinterpret_cast<Node *>(aInstance); }
+
+    /**
+     * This method returns the OpenThread instance of the node.
+     *
+     * @returns A reference to the OpenThread instance.
+     *
+     */
+    Instance &GetInstance(void) { return *reinterpret_cast<Instance *>(mInstanceRaw); }
+
+    /**
+     * This method returns the node id.
+     *
+     * @returns The node id.
+     *
+     */
+    uint16_t GetId(void) const { return mId; }
+
+    /**
+     * This method creates a new network (new random Active Operational Dataset) and starts the node as its leader.
+     *
+     * @retval OT_ERROR_NONE  Successfully started forming the network.
+     *
+     */
+    otError Form(void);
+
+    /**
+     * This method configures the node with the Active Operational Dataset of another node and starts Thread.
+     *
+     * @param[in] aNode  The node whose Active Operational Dataset to use (e.g., the leader).
+     * @param[in] aMode  The MLE Link Mode of the node.
+     *
+     * @retval OT_ERROR_NONE  Successfully started attaching to the network.
+     *
+     */
+    otError Join(Node &aNode, const otLinkModeConfig &aMode);
+
+    /**
+     * This method resets the node, like a device reboot.
+     *
+     * The OpenThread instance is finalized and initialized again, keeping the settings.
+     *
+     */
+    void Reset(void);
+
+    /**
+     * This method processes a pending reset request (`otPlatReset()`) if any.
+     *
+     */
+    void ProcessResetRequest(void);
+
+    uint64_t mInstanceRaw[(sizeof(Instance) + sizeof(uint64_t) - 1) / sizeof(uint64_t)];
+    uint16_t mId;
+    bool     mTaskletsPending;
+    bool     mResetRequested;
+    Alarm    mAlarm;
+    Radio    mRadio;
+    Settings mSettings;
+};
+
+} // namespace Nexus
+} // namespace ot
+
+#endif // NEXUS_NODE_HPP_
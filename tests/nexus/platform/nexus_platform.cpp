@@ -0,0 +1,450 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the OpenThread platform APIs for Nexus nodes.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <openthread/tasklet.h>
+#include <openthread/platform/alarm-milli.h>
+#include <openthread/platform/entropy.h>
+#include <openthread/platform/logging.h>
+#include <openthread/platform/misc.h>
+#include <openthread/platform/radio.h>
+#include <openthread/platform/settings.h>
+
+#include "common/code_utils.hpp"
+
+#include "nexus_core.hpp"
+#include "nexus_node.hpp"
+
+using namespace ot::Nexus;
+
+static Radio &GetRadio(otInstance *aInstance)
+{
+    return Node::From(aInstance).mRadio;
+}
+
+static void ReverseExtAddress(ot::Mac::ExtAddress &aExtAddress, const otExtAddress &aOrigin)
+{
+    // The radio platform APIs use little-endian byte order for the extended address.
+
+    for (uint8_t i = 0; i < sizeof(otExtAddress); i++)
+    {
+        aExtAddress.m8[i] = aOrigin.m8[sizeof(otExtAddress) - 1 - i];
+    }
+}
+
+extern "C" {
+
+//---------------------------------------------------------------------------------------------------------------------
+// Tasklets
+
+void otTaskletsSignalPending(otInstance *aInstance)
+{
+    Core::Get().SignalTaskletsPending(Node::From(aInstance));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Alarm
+
+uint32_t otPlatAlarmMilliGetNow(void)
+{
+    return static_cast<uint32_t>(Core::Get().GetNow() / 1000);
+}
+
+void otPlatAlarmMilliStartAt(otInstance *aInstance, uint32_t aT0, uint32_t aDt)
+{
+    Node::Alarm &alarm = Node::From(aInstance).mAlarm;
+    uint64_t     now   = Core::Get().GetNow();
+    int32_t      delay = static_cast<int32_t>(aT0 + aDt - otPlatAlarmMilliGetNow());
+
+    alarm.mRunning  = true;
+    alarm.mFireTime = (delay > 0) ? (now / 1000 + static_cast<uint32_t>(delay)) * 1000 : now;
+}
+
+void otPlatAlarmMilliStop(otInstance *aInstance)
+{
+    Node::From(aInstance).mAlarm.mRunning = false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Radio
+
+void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
+{
+    uint16_t id = Node::From(aInstance).GetId();
+
+    aIeeeEui64[0] = 0x18;
+    aIeeeEui64[1] = 0xb4;
+    aIeeeEui64[2] = 0x30;
+    aIeeeEui64[3] = 0x00;
+    aIeeeEui64[4] = 0x00;
+    aIeeeEui64[5] = 0x00;
+    aIeeeEui64[6] = static_cast<uint8_t>(id >> 8);
+    aIeeeEui64[7] = static_cast<uint8_t>(id & 0xff);
+}
+
+void otPlatRadioSetPanId(otInstance *aInstance, otPanId aPanId)
+{
+    GetRadio(aInstance).mPanId = aPanId;
+}
+
+void otPlatRadioSetExtendedAddress(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    ReverseExtAddress(GetRadio(aInstance).mExtAddress, *aExtAddress);
+}
+
+void otPlatRadioSetShortAddress(otInstance *aInstance, otShortAddress aShortAddress)
+{
+    GetRadio(aInstance).mShortAddress = aShortAddress;
+}
+
+void otPlatRadioSetPromiscuous(otInstance *aInstance, bool aEnable)
+{
+    GetRadio(aInstance).mPromiscuous = aEnable;
+}
+
+bool otPlatRadioGetPromiscuous(otInstance *aInstance)
+{
+    return GetRadio(aInstance).mPromiscuous;
+}
+
+bool otPlatRadioIsEnabled(otInstance *aInstance)
+{
+    return GetRadio(aInstance).mState != OT_RADIO_STATE_DISABLED;
+}
+
+otError otPlatRadioEnable(otInstance *aInstance)
+{
+    Radio &radio = GetRadio(aInstance);
+
+    if (radio.mState == OT_RADIO_STATE_DISABLED)
+    {
+        radio.mState = OT_RADIO_STATE_SLEEP;
+    }
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatRadioDisable(otInstance *aInstance)
+{
+    GetRadio(aInstance).mState = OT_RADIO_STATE_DISABLED;
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatRadioSleep(otInstance *aInstance)
+{
+    Radio & radio = GetRadio(aInstance);
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit((radio.mState == OT_RADIO_STATE_SLEEP) || (radio.mState == OT_RADIO_STATE_RECEIVE),
+                 error = OT_ERROR_INVALID_STATE);
+    radio.mState = OT_RADIO_STATE_SLEEP;
+
+exit:
+    return error;
+}
+
+otError otPlatRadioReceive(otInstance *aInstance, uint8_t aChannel)
+{
+    Radio & radio = GetRadio(aInstance);
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(radio.mState != OT_RADIO_STATE_DISABLED, error = OT_ERROR_INVALID_STATE);
+    radio.mState   = OT_RADIO_STATE_RECEIVE;
+    radio.mChannel = aChannel;
+
+exit:
+    return error;
+}
+
+otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
+{
+    Radio & radio = GetRadio(aInstance);
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(radio.mState == OT_RADIO_STATE_RECEIVE, error = OT_ERROR_INVALID_STATE);
+
+    radio.mState   = OT_RADIO_STATE_TRANSMIT;
+    radio.mChannel = aFrame->mChannel;
+
+    if (aFrame->mInfo.mTxInfo.mTxDelay != 0)
+    {
+        // The transmit time is given relative to a base time which
+        // holds the lower 32 bits of the radio time (in microseconds).
+
+        uint64_t now     = Core::Get().GetNow();
+        uint32_t elapsed = static_cast<uint32_t>(now) - aFrame->mInfo.mTxInfo.mTxDelayBaseTime;
+
+        Core::Get().TransmitAt(Node::From(aInstance), *aFrame, now - elapsed + aFrame->mInfo.mTxInfo.mTxDelay);
+        ExitNow();
+    }
+
+    otPlatRadioTxStarted(aInstance, aFrame);
+    Core::Get().Transmit(Node::From(aInstance), *aFrame);
+
+exit:
+    return error;
+}
+
+otRadioFrame *otPlatRadioGetTransmitBuffer(otInstance *aInstance)
+{
+    return &GetRadio(aInstance).mTxFrame;
+}
+
+int8_t otPlatRadioGetRssi(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return -100;
+}
+
+otRadioCaps otPlatRadioGetCaps(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return OT_RADIO_CAPS_TRANSMIT_TIMING;
+}
+
+int8_t otPlatRadioGetReceiveSensitivity(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return -100;
+}
+
+otError otPlatRadioGetTransmitPower(otInstance *aInstance, int8_t *aPower)
+{
+    *aPower = GetRadio(aInstance).mTxPower;
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatRadioSetTransmitPower(otInstance *aInstance, int8_t aPower)
+{
+    GetRadio(aInstance).mTxPower = aPower;
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatRadioGetCcaEnergyDetectThreshold(otInstance *aInstance, int8_t *aThreshold)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aThreshold);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+otError otPlatRadioSetCcaEnergyDetectThreshold(otInstance *aInstance, int8_t aThreshold)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aThreshold);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint16_t aScanDuration)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aScanChannel);
+    OT_UNUSED_VARIABLE(aScanDuration);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+void otPlatRadioEnableSrcMatch(otInstance *aInstance, bool aEnable)
+{
+    GetRadio(aInstance).mSrcMatchEnabled = aEnable;
+}
+
+otError otPlatRadioAddSrcMatchShortEntry(otInstance *aInstance, otShortAddress aShortAddress)
+{
+    return GetRadio(aInstance).AddSrcMatchShortEntry(aShortAddress);
+}
+
+otError otPlatRadioAddSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    ot::Mac::ExtAddress extAddress;
+
+    ReverseExtAddress(extAddress, *aExtAddress);
+
+    return GetRadio(aInstance).AddSrcMatchExtEntry(extAddress);
+}
+
+otError otPlatRadioClearSrcMatchShortEntry(otInstance *aInstance, otShortAddress aShortAddress)
+{
+    return GetRadio(aInstance).ClearSrcMatchShortEntry(aShortAddress);
+}
+
+otError otPlatRadioClearSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    ot::Mac::ExtAddress extAddress;
+
+    ReverseExtAddress(extAddress, *aExtAddress);
+
+    return GetRadio(aInstance).ClearSrcMatchExtEntry(extAddress);
+}
+
+void otPlatRadioClearSrcMatchShortEntries(otInstance *aInstance)
+{
+    GetRadio(aInstance).mNumSrcMatchShortEntries = 0;
+}
+
+void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance)
+{
+    GetRadio(aInstance).mNumSrcMatchExtEntries = 0;
+}
+
+uint64_t otPlatRadioGetNow(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return Core::Get().GetNow();
+}
+
+uint64_t otPlatTimeGet(void)
+{
+    return Core::Get().GetNow();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Settings
+
+void otPlatSettingsInit(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+}
+
+void otPlatSettingsDeinit(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+}
+
+otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
+{
+    return Node::From(aInstance).mSettings.Get(aKey, aIndex, aValue, aValueLength);
+}
+
+otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    return Node::From(aInstance).mSettings.Set(aKey, aValue, aValueLength);
+}
+
+otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    return Node::From(aInstance).mSettings.Add(aKey, aValue, aValueLength);
+}
+
+otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
+{
+    return Node::From(aInstance).mSettings.Delete(aKey, aIndex);
+}
+
+void otPlatSettingsWipe(otInstance *aInstance)
+{
+    Node::From(aInstance).mSettings.Wipe();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Entropy, heap, logging and misc
+
+otError otPlatEntropyGet(uint8_t *aOutput, uint16_t aOutputLength)
+{
+    for (uint16_t i = 0; i < aOutputLength; i++)
+    {
+        aOutput[i] = static_cast<uint8_t>(Core::Get().GetRandom());
+    }
+
+    return OT_ERROR_NONE;
+}
+
+void *otPlatCAlloc(size_t aNum, size_t aSize)
+{
+    return calloc(aNum, aSize);
+}
+
+void otPlatFree(void *aPtr)
+{
+    free(aPtr);
+}
+
+void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...)
+{
+    Core &   core = Core::Get();
+    Node *   node = core.GetCurrentNode();
+    uint64_t now  = core.GetNow() / 1000;
+    va_list  args;
+
+    OT_UNUSED_VARIABLE(aLogLevel);
+    OT_UNUSED_VARIABLE(aLogRegion);
+
+    VerifyOrExit(core.IsLogEnabled());
+
+    printf("%02u:%02u:%02u.%03u ", static_cast<unsigned>(now / 3600000), static_cast<unsigned>(now / 60000 % 60),
+           static_cast<unsigned>(now / 1000 % 60), static_cast<unsigned>(now % 1000));
+
+    if (node != nullptr)
+    {
+        printf("[%u] ", node->GetId());
+    }
+
+    va_start(args, aFormat);
+    vprintf(aFormat, args);
+    va_end(args);
+
+    printf("\n");
+
+exit:
+    return;
+}
+
+void otPlatReset(otInstance *aInstance)
+{
+    // The reset is done once the node is done processing the current event (see `Node::ProcessResetRequest()`).
+    Node::From(aInstance).mResetRequested = true;
+}
+
+otPlatResetReason otPlatGetResetReason(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return OT_PLAT_RESET_REASON_POWER_ON;
+}
+
+void otPlatWakeHost(void)
+{
+}
+
+} // extern "C"
@@ -0,0 +1,202 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the Nexus radio of a node.
+ */
+
+#include "nexus_radio.hpp"
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace ot {
+namespace Nexus {
+
+void Radio::Reset(void)
+{
+    mState                   = OT_RADIO_STATE_DISABLED;
+    mChannel                 = 0;
+    mTxPower                 = 0;
+    mPromiscuous             = false;
+    mSrcMatchEnabled         = false;
+    mPanId                   = Mac::kPanIdBroadcast;
+    mShortAddress            = Mac::kShortAddrInvalid;
+    mNumSrcMatchShortEntries = 0;
+    mNumSrcMatchExtEntries   = 0;
+    mExtAddress.Clear();
+
+    mTxFrame.mPsdu  = mTxPsdu;
+    mRxFrame.mPsdu  = mRxPsdu;
+    mAckFrame.mPsdu = mAckPsdu;
+}
+
+bool Radio::DoesAddressMatch(const Mac::RxFrame &aFrame) const
+{
+    bool         matches = true;
+    Mac::Address dst;
+    Mac::PanId   panId;
+
+    SuccessOrExit(aFrame.GetDstAddr(dst));
+
+    switch (dst.GetType())
+    {
+    case Mac::Address::kTypeShort:
+        VerifyOrExit(dst.IsBroadcast() || (dst.GetShort() == mShortAddress), matches = false);
+        break;
+
+    case Mac::Address::kTypeExtended:
+        VerifyOrExit(dst.GetExtended() == mExtAddress, matches = false);
+        break;
+
+    case Mac::Address::kTypeNone:
+        break;
+    }
+
+    SuccessOrExit(aFrame.GetDstPanId(panId));
+    VerifyOrExit((panId == Mac::kPanIdBroadcast) || (panId == mPanId), matches = false);
+
+exit:
+    return matches;
+}
+
+bool Radio::HasFramePending(const Mac::RxFrame &aFrame) const
+{
+    bool         framePending = false;
+    Mac::Address src;
+
+    VerifyOrExit(aFrame.IsDataRequestCommand() || (aFrame.GetType() == Mac::Frame::kFcfFrameData) ||
+                 (aFrame.IsVersion2015() && (aFrame.GetType() == Mac::Frame::kFcfFrameMacCmd)));
+
+    // Like the simulation platform, set the frame pending bit for all frames when source match is disabled.
+    VerifyOrExit(mSrcMatchEnabled, framePending = true);
+
+    SuccessOrExit(aFrame.GetSrcAddr(src));
+
+    switch (src.GetType())
+    {
+    case Mac::Address::kTypeShort:
+        for (uint16_t i = 0; i < mNumSrcMatchShortEntries; i++)
+        {
+            if (mSrcMatchShortEntries[i] == src.GetShort())
+            {
+                ExitNow(framePending = true);
+            }
+        }
+
+        break;
+
+    case Mac::Address::kTypeExtended:
+        for (uint16_t i = 0; i < mNumSrcMatchExtEntries; i++)
+        {
+            if (mSrcMatchExtEntries[i] == src.GetExtended())
+            {
+                ExitNow(framePending = true);
+            }
+        }
+
+        break;
+
+    case Mac::Address::kTypeNone:
+        break;
+    }
+
+exit:
+    return framePending;
+}
+
+otError Radio::AddSrcMatchShortEntry(uint16_t aShortAddress)
+{
+    otError error = OT_ERROR_NONE;
+
+    for (uint16_t i = 0; i < mNumSrcMatchShortEntries; i++)
+    {
+        VerifyOrExit(mSrcMatchShortEntries[i] != aShortAddress);
+    }
+
+    VerifyOrExit(mNumSrcMatchShortEntries < kMaxSrcMatchEntries, error = OT_ERROR_NO_BUFS);
+    mSrcMatchShortEntries[mNumSrcMatchShortEntries++] = aShortAddress;
+
+exit:
+    return error;
+}
+
+otError Radio::AddSrcMatchExtEntry(const Mac::ExtAddress &aExtAddress)
+{
+    otError error = OT_ERROR_NONE;
+
+    for (uint16_t i = 0; i < mNumSrcMatchExtEntries; i++)
+    {
+        VerifyOrExit(mSrcMatchExtEntries[i] != aExtAddress);
+    }
+
+    VerifyOrExit(mNumSrcMatchExtEntries < kMaxSrcMatchEntries, error = OT_ERROR_NO_BUFS);
+    mSrcMatchExtEntries[mNumSrcMatchExtEntries++] = aExtAddress;
+
+exit:
+    return error;
+}
+
+otError Radio::ClearSrcMatchShortEntry(uint16_t aShortAddress)
+{
+    otError error = OT_ERROR_NOT_FOUND;
+
+    for (uint16_t i = 0; i < mNumSrcMatchShortEntries; i++)
+    {
+        if (mSrcMatchShortEntries[i] == aShortAddress)
+        {
+            mSrcMatchShortEntries[i] = mSrcMatchShortEntries[--mNumSrcMatchShortEntries];
+            ExitNow(error = OT_ERROR_NONE);
+        }
+    }
+
+exit:
+    return error;
+}
+
+otError Radio::ClearSrcMatchExtEntry(const Mac::ExtAddress &aExtAddress)
+{
+    otError error = OT_ERROR_NOT_FOUND;
+
+    for (uint16_t i = 0; i < mNumSrcMatchExtEntries; i++)
+    {
+        if (mSrcMatchExtEntries[i] == aExtAddress)
+        {
+            mSrcMatchExtEntries[i] = mSrcMatchExtEntries[--mNumSrcMatchExtEntries];
+            ExitNow(error = OT_ERROR_NONE);
+        }
+    }
+
+exit:
+    return error;
+}
+
+} // namespace Nexus
+} // namespace ot
@@ -0,0 +1,121 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the Nexus radio of a node.
+ */
+
+#ifndef NEXUS_RADIO_HPP_
+#define NEXUS_RADIO_HPP_
+
+#include "openthread-core-config.h"
+
+#include <openthread/platform/radio.h>
+
+#include "mac/mac_frame.hpp"
+#include "mac/mac_types.hpp"
+
+namespace ot {
+namespace Nexus {
+
+/**
+ * This class implements the radio state of a node.
+ *
+ * Frames are exchanged between radios by the `Core` (in-memory radio medium). The radio does address filtering and
+ * acknowledges received frames (using the source match table to set the Frame Pending bit) like a real radio would.
+ * Collisions and CCA are not simulated.
+ *
+ */
+class Radio
+{
+public:
+    enum : uint16_t
+    {
+        kMaxSrcMatchEntries = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN, ///< Number of short and extended entries.
+    };
+
+    /**
+     * This method resets the radio to its initial (disabled) state.
+     *
+     */
+    void Reset(void);
+
+    /**
+     * This method indicates whether a received frame passes the radio address filter.
+     *
+     * @param[in] aFrame  The received frame.
+     *
+     * @retval TRUE   The frame is destined to this radio (or broadcast).
+     * @retval FALSE  The frame is destined to another node or PAN.
+     *
+     */
+    bool DoesAddressMatch(const Mac::RxFrame &aFrame) const;
+
+    /**
+     * This method determines whether the ACK for a received frame should have the Frame Pending bit set.
+     *
+     * @param[in] aFrame  The received frame.
+     *
+     * @retval TRUE   The Frame Pending bit should be set.
+     * @retval FALSE  The Frame Pending bit should not be set.
+     *
+     */
+    bool HasFramePending(const Mac::RxFrame &aFrame) const;
+
+    otError AddSrcMatchShortEntry(uint16_t aShortAddress);
+    otError AddSrcMatchExtEntry(const Mac::ExtAddress &aExtAddress);
+    otError ClearSrcMatchShortEntry(uint16_t aShortAddress);
+    otError ClearSrcMatchExtEntry(const Mac::ExtAddress &aExtAddress);
+
+    otRadioState    mState;
+    uint8_t         mChannel;
+    int8_t          mTxPower;
+    bool            mPromiscuous;
+    bool            mSrcMatchEnabled;
+    uint16_t        mPanId;
+    uint16_t        mShortAddress;
+    Mac::ExtAddress mExtAddress;
+    uint16_t        mNumSrcMatchShortEntries;
+    uint16_t        mNumSrcMatchExtEntries;
+    uint16_t        mSrcMatchShortEntries[kMaxSrcMatchEntries];
+    Mac::ExtAddress mSrcMatchExtEntries[kMaxSrcMatchEntries];
+    uint32_t        mNumTxFrames;
+    uint32_t        mNumRxFrames;
+    Mac::TxFrame    mTxFrame;
+    Mac::RxFrame    mRxFrame;
+    Mac::RxFrame    mAckFrame;
+    uint8_t         mTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
+    uint8_t         mRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
+    uint8_t         mAckPsdu[OT_RADIO_FRAME_MAX_SIZE];
+};
+
+} // namespace Nexus
+} // namespace ot
+
+#endif // NEXUS_RADIO_HPP_
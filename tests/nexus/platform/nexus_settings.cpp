@@ -0,0 +1,149 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the Nexus (in-memory) settings storage of a node.
+ */
+
+#include "nexus_settings.hpp"
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace ot {
+namespace Nexus {
+
+Settings::Block Settings::ReadBlock(uint16_t aOffset) const
+{
+    Block block;
+
+    memcpy(&block, &mBuffer[aOffset], sizeof(block));
+
+    return block;
+}
+
+otError Settings::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength) const
+{
+    otError  error = OT_ERROR_NOT_FOUND;
+    int      index = 0;
+    uint16_t offset;
+    Block    block;
+
+    for (offset = 0; offset < mLength; offset += sizeof(Block) + block.mLength)
+    {
+        block = ReadBlock(offset);
+
+        if ((block.mKey == aKey) && (index++ == aIndex))
+        {
+            error = OT_ERROR_NONE;
+            break;
+        }
+    }
+
+    VerifyOrExit(error == OT_ERROR_NONE);
+
+    if (aValueLength != nullptr)
+    {
+        if (aValue != nullptr)
+        {
+            memcpy(aValue, &mBuffer[offset + sizeof(Block)], OT_MIN(*aValueLength, block.mLength));
+        }
+
+        *aValueLength = block.mLength;
+    }
+
+exit:
+    return error;
+}
+
+otError Settings::Set(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    IgnoreError(Delete(aKey, -1));
+
+    return Add(aKey, aValue, aValueLength);
+}
+
+otError Settings::Add(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    otError error = OT_ERROR_NONE;
+    Block   block;
+
+    VerifyOrExit(mLength + sizeof(Block) + aValueLength <= sizeof(mBuffer), error = OT_ERROR_NO_BUFS);
+
+    block.mKey    = aKey;
+    block.mLength = aValueLength;
+
+    memcpy(&mBuffer[mLength], &block, sizeof(block));
+    memcpy(&mBuffer[mLength + sizeof(Block)], aValue, aValueLength);
+    mLength += sizeof(Block) + aValueLength;
+
+exit:
+    return error;
+}
+
+otError Settings::Delete(uint16_t aKey, int aIndex)
+{
+    otError  error  = OT_ERROR_NOT_FOUND;
+    int      index  = 0;
+    uint16_t offset = 0;
+
+    while (offset < mLength)
+    {
+        Block block = ReadBlock(offset);
+
+        if ((block.mKey == aKey) && ((aIndex == -1) || (index++ == aIndex)))
+        {
+            Remove(offset);
+            error = OT_ERROR_NONE;
+
+            if (aIndex != -1)
+            {
+                break;
+            }
+        }
+        else
+        {
+            offset += sizeof(Block) + block.mLength;
+        }
+    }
+
+    return error;
+}
+
+void Settings::Remove(uint16_t aOffset)
+{
+    uint16_t end = aOffset + sizeof(Block) + ReadBlock(aOffset).mLength;
+
+    memmove(&mBuffer[aOffset], &mBuffer[end], mLength - end);
+    mLength -= end - aOffset;
+}
+
+} // namespace Nexus
+} // namespace ot
@@ -0,0 +1,108 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the Nexus (in-memory) settings storage of a node.
+ */
+
+#ifndef NEXUS_SETTINGS_HPP_
+#define NEXUS_SETTINGS_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include <openthread/error.h>
+
+namespace ot {
+namespace Nexus {
+
+/**
+ * This class implements an in-memory settings storage.
+ *
+ * The settings are kept when a node is reset (`otPlatReset()`), so a node restores its network information after a
+ * reset like a real device would.
+ *
+ */
+class Settings
+{
+public:
+    enum : uint16_t
+    {
+        kBufferSize = OPENTHREAD_NEXUS_CONFIG_SETTINGS_BUFFER_SIZE, ///< Size of the settings buffer (in bytes).
+    };
+
+    /**
+     * This method removes all settings.
+     *
+     */
+    void Wipe(void) { mLength = 0; }
+
+    /**
+     * This method gets a setting (see `otPlatSettingsGet()`).
+     *
+     */
+    otError Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength) const;
+
+    /**
+     * This method sets a setting, replacing all existing values of the key (see `otPlatSettingsSet()`).
+     *
+     */
+    otError Set(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength);
+
+    /**
+     * This method adds a value to a setting (see `otPlatSettingsAdd()`).
+     *
+     */
+    otError Add(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength);
+
+    /**
+     * This method deletes a value of a setting, or all values if @p aIndex is -1 (see `otPlatSettingsDelete()`).
+     *
+     */
+    otError Delete(uint16_t aKey, int aIndex);
+
+    uint16_t mLength;
+    uint8_t  mBuffer[kBufferSize];
+
+private:
+    struct Block
+    {
+        uint16_t mKey;
+        uint16_t mLength;
+    };
+
+    Block ReadBlock(uint16_t aOffset) const;
+    void  Remove(uint16_t aOffset);
+};
+
+} // namespace Nexus
+} // namespace ot
+
+#endif // NEXUS_SETTINGS_HPP_
@@ -0,0 +1,237 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/random.hpp"
+#include "thread/address_resolver.hpp"
+
+#include "test_util.h"
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+static constexpr uint16_t kMaxEntries    = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES;
+static constexpr uint16_t kNumNewEntries = 10;
+static constexpr uint32_t kNumLookups    = 100000;
+
+static uint64_t GetWallTimeNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL + static_cast<uint64_t>(now.tv_nsec);
+}
+
+static Ip6::Address GetEid(uint16_t aIndex)
+{
+    Ip6::Address eid;
+
+    SuccessOrQuit(eid.FromString("fd00:1234::"), "Address::FromString() failed");
+    eid.mFields.m16[6] = Random::NonCrypto::GetUint16();
+    eid.mFields.m16[7] = HostSwap16(aIndex);
+
+    return eid;
+}
+
+static Mac::ShortAddress GetRloc16(uint16_t aIndex)
+{
+    return static_cast<Mac::ShortAddress>((aIndex % 8) << 10);
+}
+
+static uint16_t GetNumCacheEntries(Instance &aInstance)
+{
+    uint16_t                   count = 0;
+    AddressResolver::Iterator  iterator;
+    AddressResolver::EntryInfo info;
+
+    memset(&iterator, 0, sizeof(iterator));
+
+    while (aInstance.Get<AddressResolver>().GetNextCacheEntry(info, iterator) == kErrorNone)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+static uint64_t BenchmarkLookups(Instance &aInstance, const Ip6::Address *aEids, uint16_t aNumEntries)
+{
+    // Returns the average time (in ns) of a lookup of a cached EID.
+
+    AddressResolver &resolver = aInstance.Get<AddressResolver>();
+    uint64_t         start;
+
+    start = GetWallTimeNs();
+
+    for (uint32_t i = 0; i < kNumLookups; i++)
+    {
+        Mac::ShortAddress rloc16;
+        uint16_t          index = static_cast<uint16_t>(i * 7919u % aNumEntries);
+
+        SuccessOrQuit(resolver.Resolve(aEids[index], rloc16, /* aAllowAddressQuery */ false), "Resolve() failed");
+        VerifyOrQuit(rloc16 == GetRloc16(index), "Resolve() returned an incorrect RLOC16");
+    }
+
+    return (GetWallTimeNs() - start) / kNumLookups;
+}
+
+void TestAddressResolver(void)
+{
+    static const uint16_t kNumEntries[] = {32, kMaxEntries};
+
+    static Ip6::Address eids[kMaxEntries + kNumNewEntries];
+
+    Core &            core = Core::Get();
+    Node *            node;
+    Mac::ShortAddress rloc16;
+
+    core.SetLogEnabled(false);
+
+    node = core.CreateNode();
+    VerifyOrQuit(node != nullptr, "CreateNode() failed");
+
+    SuccessOrQuit(node->Form(), "Form() failed");
+    core.AdvanceTime(10 * 1000);
+    VerifyOrQuit(otThreadGetDeviceRole(&node->GetInstance()) == OT_DEVICE_ROLE_LEADER, "leader not elected");
+
+    Instance &       instance = node->GetInstance();
+    AddressResolver &resolver = instance.Get<AddressResolver>();
+
+    for (uint16_t i = 0; i < OT_ARRAY_LENGTH(eids); i++)
+    {
+        eids[i] = GetEid(i);
+    }
+
+    printf("TestAddressResolver: EID lookup\n");
+
+    for (uint16_t numEntries : kNumEntries)
+    {
+        resolver.Clear();
+        resolver.ResetCounters();
+
+        // Add snooped entries and use them once, so they are moved to
+        // the list of cached entries.
+
+        for (uint16_t i = 0; i < numEntries; i++)
+        {
+            resolver.AddSnoopedCacheEntry(eids[i], GetRloc16(i));
+            SuccessOrQuit(resolver.Resolve(eids[i], rloc16, /* aAllowAddressQuery */ false), "Resolve() failed");
+        }
+
+        VerifyOrQuit(GetNumCacheEntries(instance) == numEntries, "cache entries are missing");
+        VerifyOrQuit(resolver.GetCounters().mHits == numEntries, "hit counter is incorrect");
+        VerifyOrQuit(resolver.GetCounters().mMisses == 0, "miss counter is incorrect");
+        VerifyOrQuit(resolver.GetCounters().mEvictions == 0, "eviction counter is incorrect");
+
+        printf("  %4u entries: avg %lu ns\n", numEntries,
+               static_cast<unsigned long>(BenchmarkLookups(instance, eids, numEntries)));
+    }
+
+    // Unknown and removed EIDs are not found.
+
+    resolver.ResetCounters();
+
+    VerifyOrQuit(resolver.Resolve(eids[kMaxEntries], rloc16, /* aAllowAddressQuery */ false) == kErrorNotFound,
+                 "Resolve() found an unknown EID");
+    VerifyOrQuit(resolver.GetCounters().mMisses == 1, "miss counter is incorrect");
+
+    resolver.Remove(eids[5]);
+    VerifyOrQuit(GetNumCacheEntries(instance) == kMaxEntries - 1, "Remove() failed");
+
+    for (uint16_t i = 0; i < kMaxEntries; i++)
+    {
+        Error error = resolver.Resolve(eids[i], rloc16, /* aAllowAddressQuery */ false);
+
+        VerifyOrQuit((i == 5) ? (error == kErrorNotFound) : (error == kErrorNone), "Resolve() failed after Remove()");
+    }
+
+    // Removing an RLOC16 removes all its entries.
+
+    resolver.Remove(GetRloc16(3));
+    VerifyOrQuit(GetNumCacheEntries(instance) == kMaxEntries - 1 - kMaxEntries / 8, "Remove(rloc16) failed");
+
+    for (uint16_t i = 0; i < kMaxEntries; i++)
+    {
+        Error error     = resolver.Resolve(eids[i], rloc16, /* aAllowAddressQuery */ false);
+        bool  isRemoved = (i == 5) || (GetRloc16(i) == GetRloc16(3));
+
+        VerifyOrQuit(isRemoved ? (error == kErrorNotFound) : (error == kErrorNone),
+                     "Resolve() failed after Remove(rloc16)");
+    }
+
+    // Adding entries to a full cache evicts the least recently used
+    // entries.
+
+    resolver.Clear();
+
+    for (uint16_t i = 0; i < kMaxEntries; i++)
+    {
+        resolver.AddSnoopedCacheEntry(eids[i], GetRloc16(i));
+        SuccessOrQuit(resolver.Resolve(eids[i], rloc16, /* aAllowAddressQuery */ false), "Resolve() failed");
+    }
+
+    resolver.ResetCounters();
+
+    for (uint16_t i = kMaxEntries; i < kMaxEntries + kNumNewEntries; i++)
+    {
+        resolver.AddSnoopedCacheEntry(eids[i], GetRloc16(i));
+        SuccessOrQuit(resolver.Resolve(eids[i], rloc16, /* aAllowAddressQuery */ false), "Resolve() failed");
+    }
+
+    VerifyOrQuit(resolver.GetCounters().mEvictions == kNumNewEntries, "eviction counter is incorrect");
+    VerifyOrQuit(GetNumCacheEntries(instance) == kMaxEntries, "cache entries are missing");
+
+    for (uint16_t i = 0; i < kMaxEntries + kNumNewEntries; i++)
+    {
+        Error error = resolver.Resolve(eids[i], rloc16, /* aAllowAddressQuery */ false);
+
+        VerifyOrQuit((i < kNumNewEntries) ? (error == kErrorNotFound) : (error == kErrorNone),
+                     "least recently used entries were not evicted");
+    }
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestAddressResolver();
+    printf("All tests passed\n");
+    return 0;
+}
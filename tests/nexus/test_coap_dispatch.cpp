@@ -0,0 +1,308 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <openthread/thread.h>
+
+#include "coap/coap.hpp"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+
+#include "test_util.h"
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+static constexpr uint16_t kNumTmfResources = 40;
+static constexpr uint16_t kMaxResources    = 2 * OPENTHREAD_CONFIG_COAP_RESOURCE_INDEX_SIZE + 16;
+static constexpr uint16_t kUriPathSize     = 8;
+static constexpr uint32_t kNumDispatches   = 200000;
+
+// The TMF resources (see `uri_paths.cpp`), followed by two vendor
+// resources, as registered by a Border Router.
+static const char *const kTmfUriPaths[kNumTmfResources] = {
+    "a/aq", "a/an", "a/ae", "a/ar", "a/as", "c/ag", "c/as", "c/dc", "c/es", "c/er", "c/pg", "c/ps", "a/sd", "c/ab",
+    "c/ur", "c/ut", "c/rx", "c/tx", "c/jf", "c/je", "c/lp", "c/la", "c/pc", "c/pq", "c/cg", "c/ca", "c/cp", "c/cs",
+    "d/dg", "d/dq", "d/da", "d/dr", "n/mr", "n/dr", "n/dn", "b/bq", "b/ba", "b/bmr", "v/ts", "v/tr",
+};
+
+static const char kUnknownUriPath[] = "c/zz";
+
+class TestCoap : public Coap::Coap
+{
+public:
+    explicit TestCoap(Instance &aInstance)
+        : Coap::Coap(aInstance)
+    {
+    }
+
+    using Coap::Coap::Receive;
+};
+
+static char     sUriPaths[kMaxResources][kUriPathSize];
+static uint32_t sHits[kMaxResources];
+static uint32_t sDefaultHits;
+static uint32_t sDuplicateHits;
+
+static uint64_t GetWallTimeNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL + static_cast<uint64_t>(now.tv_nsec);
+}
+
+static void HandleRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    (*static_cast<uint32_t *>(aContext))++;
+}
+
+static void HandleDefaultRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aContext);
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    sDefaultHits++;
+}
+
+static Coap::Message *NewRequest(TestCoap &aCoap, const char *aUriPath)
+{
+    Coap::Message *message = aCoap.NewMessage();
+
+    VerifyOrQuit(message != nullptr, "NewMessage() failed");
+    message->Init(Coap::kTypeNonConfirmable, Coap::kCodePost);
+    SuccessOrQuit(message->AppendUriPathOptions(aUriPath), "AppendUriPathOptions() failed");
+    message->Finish();
+
+    return message;
+}
+
+static void Dispatch(TestCoap &aCoap, Coap::Message &aMessage)
+{
+    Ip6::MessageInfo messageInfo;
+
+    aMessage.SetOffset(0);
+    aCoap.Receive(aMessage, messageInfo);
+}
+
+static uint32_t *DispatchAndGetHandler(TestCoap &aCoap, const char *aUriPath)
+{
+    // Dispatches a request for `aUriPath` and returns the hit counter
+    // of the handler which received it.
+
+    Coap::Message *message = NewRequest(aCoap, aUriPath);
+    uint32_t *     handler = nullptr;
+    uint32_t       hits[kMaxResources];
+    uint32_t       defaultHits   = sDefaultHits;
+    uint32_t       duplicateHits = sDuplicateHits;
+
+    memcpy(hits, sHits, sizeof(hits));
+    Dispatch(aCoap, *message);
+    message->Free();
+
+    for (uint16_t i = 0; i < kMaxResources; i++)
+    {
+        if (sHits[i] != hits[i])
+        {
+            VerifyOrQuit(handler == nullptr, "request was handled more than once");
+            handler = &sHits[i];
+        }
+    }
+
+    if (sDefaultHits != defaultHits)
+    {
+        VerifyOrQuit(handler == nullptr, "request was handled more than once");
+        handler = &sDefaultHits;
+    }
+
+    if (sDuplicateHits != duplicateHits)
+    {
+        VerifyOrQuit(handler == nullptr, "request was handled more than once");
+        handler = &sDuplicateHits;
+    }
+
+    VerifyOrQuit(handler != nullptr, "request was not handled");
+
+    return handler;
+}
+
+void TestCoapDispatch(void)
+{
+    Core &          core = Core::Get();
+    Node *          node;
+    Coap::Resource *resources[kMaxResources];
+    Coap::Resource  duplicate(kTmfUriPaths[0], HandleRequest, &sDuplicateHits);
+    Coap::Message * requests[kNumTmfResources];
+    uint64_t        start;
+    uint64_t        elapsed;
+
+    core.SetLogEnabled(false);
+
+    node = core.CreateNode();
+    VerifyOrQuit(node != nullptr, "CreateNode() failed");
+
+    Instance &instance = node->GetInstance();
+    TestCoap  coap(instance);
+
+    for (uint16_t i = 0; i < kMaxResources; i++)
+    {
+        if (i < kNumTmfResources)
+        {
+            strcpy(sUriPaths[i], kTmfUriPaths[i]);
+        }
+        else
+        {
+            snprintf(sUriPaths[i], kUriPathSize, "x/%u", i);
+        }
+
+        resources[i] = new Coap::Resource(sUriPaths[i], HandleRequest, &sHits[i]);
+    }
+
+    coap.SetDefaultHandler(HandleDefaultRequest, nullptr);
+
+    printf("TestCoapDispatch: TMF resources\n");
+
+    for (uint16_t i = 0; i < kNumTmfResources; i++)
+    {
+        coap.AddResource(*resources[i]);
+    }
+
+    for (uint16_t i = 0; i < kNumTmfResources; i++)
+    {
+        VerifyOrQuit(DispatchAndGetHandler(coap, sUriPaths[i]) == &sHits[i], "request went to the wrong resource");
+    }
+
+    VerifyOrQuit(DispatchAndGetHandler(coap, kUnknownUriPath) == &sDefaultHits, "unknown Uri-Path was not rejected");
+
+    // Benchmark the dispatch of requests spread over all TMF resources.
+
+    memset(sHits, 0, sizeof(sHits));
+
+    for (uint16_t i = 0; i < kNumTmfResources; i++)
+    {
+        requests[i] = NewRequest(coap, sUriPaths[i]);
+    }
+
+    start = GetWallTimeNs();
+
+    for (uint32_t i = 0; i < kNumDispatches; i++)
+    {
+        Dispatch(coap, *requests[i % kNumTmfResources]);
+    }
+
+    elapsed = GetWallTimeNs() - start;
+
+    for (uint16_t i = 0; i < kNumTmfResources; i++)
+    {
+        VerifyOrQuit(sHits[i] == kNumDispatches / kNumTmfResources, "requests went to the wrong resource");
+        requests[i]->Free();
+    }
+
+    printf("  %u resources: avg %lu ns per request\n", kNumTmfResources,
+           static_cast<unsigned long>(elapsed / kNumDispatches));
+
+    // The most recently added resource handles a duplicate Uri-Path,
+    // and the older one takes over once it is removed.
+
+    printf("TestCoapDispatch: duplicate Uri-Path\n");
+
+    coap.AddResource(duplicate);
+    VerifyOrQuit(DispatchAndGetHandler(coap, sUriPaths[0]) == &sDuplicateHits, "newest duplicate did not handle");
+    coap.RemoveResource(duplicate);
+    VerifyOrQuit(DispatchAndGetHandler(coap, sUriPaths[0]) == &sHits[0], "older duplicate did not handle");
+
+    coap.RemoveResource(*resources[0]);
+    VerifyOrQuit(DispatchAndGetHandler(coap, sUriPaths[0]) == &sDefaultHits, "removed resource still handles");
+    coap.AddResource(*resources[0]);
+    VerifyOrQuit(DispatchAndGetHandler(coap, sUriPaths[0]) == &sHits[0], "re-added resource does not handle");
+
+    // Add more resources than the index holds, then remove and re-add
+    // a subset of them.
+
+    printf("TestCoapDispatch: more resources than index slots\n");
+
+    for (uint16_t i = kNumTmfResources; i < kMaxResources; i++)
+    {
+        coap.AddResource(*resources[i]);
+    }
+
+    for (uint16_t i = 0; i < kMaxResources; i++)
+    {
+        VerifyOrQuit(DispatchAndGetHandler(coap, sUriPaths[i]) == &sHits[i], "request went to the wrong resource");
+    }
+
+    for (uint16_t i = 0; i < kMaxResources; i += 3)
+    {
+        coap.RemoveResource(*resources[i]);
+    }
+
+    for (uint16_t i = 0; i < kMaxResources; i++)
+    {
+        uint32_t *handler = DispatchAndGetHandler(coap, sUriPaths[i]);
+
+        VerifyOrQuit(handler == ((i % 3 == 0) ? &sDefaultHits : &sHits[i]), "request went to the wrong resource");
+    }
+
+    for (uint16_t i = 0; i < kMaxResources; i += 3)
+    {
+        coap.AddResource(*resources[i]);
+    }
+
+    for (uint16_t i = 0; i < kMaxResources; i++)
+    {
+        VerifyOrQuit(DispatchAndGetHandler(coap, sUriPaths[i]) == &sHits[i], "request went to the wrong resource");
+    }
+
+    for (uint16_t i = 0; i < kMaxResources; i++)
+    {
+        coap.RemoveResource(*resources[i]);
+        delete resources[i];
+    }
+
+    VerifyOrQuit(DispatchAndGetHandler(coap, sUriPaths[1]) == &sDefaultHits, "removed resource still handles");
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestCoapDispatch();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,251 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <openthread/ip6.h>
+#include <openthread/message.h>
+#include <openthread/thread.h>
+#include <openthread/udp.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/random.hpp"
+#include "radio/radio.hpp"
+#include "thread/child_table.hpp"
+#include "thread/csl_tx_scheduler.hpp"
+#include "thread/mle_router.hpp"
+#include "thread/network_data_leader.hpp"
+
+#include "test_util.h"
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+static constexpr uint16_t kNumChildren          = 500;
+static constexpr uint16_t kMinCslPeriod         = 100;           // In units of 10 symbols (16 msec).
+static constexpr uint16_t kMaxCslPeriod         = 3125;          // In units of 10 symbols (500 msec).
+static constexpr uint32_t kChildTimeout         = 24 * 60 * 60;  // In seconds.
+static constexpr uint32_t kMinFirstWindowOffset = 10 * 1000;     // In microseconds.
+static constexpr uint32_t kNumUpdates           = 20000;
+static constexpr uint32_t kMaxServiceDuration   = 5 * 60 * 1000; // In milliseconds (virtual time).
+static constexpr uint32_t kServiceCheckInterval = 1000;          // In milliseconds (virtual time).
+static constexpr uint16_t kUdpPort              = 12345;
+
+static uint64_t GetWallTimeNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL + static_cast<uint64_t>(now.tv_nsec);
+}
+
+static void AddCslChildren(Instance &aInstance)
+{
+    uint64_t radioNow = otPlatRadioGetNow(&aInstance);
+
+    // The first CSL window of each child is placed at least
+    // `kMinFirstWindowOffset` from now, so no CSL transmission is
+    // started before the scheduling benchmark.
+
+    for (uint16_t i = 0; i < kNumChildren; i++)
+    {
+        Child *         child = aInstance.Get<ChildTable>().GetNewChild();
+        Mac::ExtAddress extAddress;
+        uint32_t        periodInUs;
+        uint32_t        windowInUs;
+
+        VerifyOrQuit(child != nullptr, "GetNewChild() failed");
+
+        child->SetState(Neighbor::kStateValid);
+        child->SetRloc16(aInstance.Get<Mle::MleRouter>().GetRloc16() | (i + 1));
+        extAddress.GenerateRandom();
+        child->SetExtAddress(extAddress);
+        child->SetDeviceMode(Mle::DeviceMode(0));
+        child->SetTimeout(kChildTimeout);
+        child->SetLastHeard(TimerMilli::GetNow());
+        child->SetNetworkDataVersion(aInstance.Get<NetworkData::Leader>().GetStableVersion());
+
+        child->SetCslPeriod(Random::NonCrypto::GetUint16InRange(kMinCslPeriod, kMaxCslPeriod + 1));
+        child->SetCslPhase(Random::NonCrypto::GetUint16InRange(0, child->GetCslPeriod()));
+        child->SetCslTimeout(kChildTimeout);
+        child->SetCslLastHeard(TimerMilli::GetNow());
+        child->SetCslSynchronized(true);
+
+        periodInUs  = child->GetCslPeriod() * kUsPerTenSymbols;
+        windowInUs = Random::NonCrypto::GetUint32InRange(kMinFirstWindowOffset, periodInUs);
+        child->SetLastRxTimestamp(radioNow - child->GetCslPhase() * kUsPerTenSymbols - (periodInUs - windowInUs));
+    }
+}
+
+static void SendToAllSleepyChildren(Instance &aInstance)
+{
+    // A message to the realm-local all Thread nodes address is queued
+    // for every sleepy child, so a single message gives all children a
+    // pending CSL transmission.
+
+    otUdpSocket   socket;
+    otMessageInfo messageInfo;
+    otMessage *   message;
+    uint8_t       payload[] = {0x01, 0x02, 0x03, 0x04};
+
+    memset(&socket, 0, sizeof(socket));
+    memset(&messageInfo, 0, sizeof(messageInfo));
+
+    SuccessOrQuit(otUdpOpen(&aInstance, &socket, nullptr, nullptr), "otUdpOpen() failed");
+
+    messageInfo.mPeerAddr = aInstance.Get<Mle::MleRouter>().GetRealmLocalAllThreadNodesAddress();
+    messageInfo.mPeerPort = kUdpPort;
+
+    message = otUdpNewMessage(&aInstance, nullptr);
+    VerifyOrQuit(message != nullptr, "otUdpNewMessage() failed");
+    SuccessOrQuit(otMessageAppend(message, payload, sizeof(payload)), "otMessageAppend() failed");
+    SuccessOrQuit(otUdpSend(&aInstance, &socket, message, &messageInfo), "otUdpSend() failed");
+
+    SuccessOrQuit(otUdpClose(&aInstance, &socket), "otUdpClose() failed");
+}
+
+void TestCslTxScheduler(void)
+{
+    Core &   core         = Core::Get();
+    Node *   leader;
+    uint64_t totalNs      = 0;
+    uint64_t maxNs        = 0;
+    uint32_t numMissed    = 0;
+    uint16_t numPending   = 0;
+    uint16_t numNotServed = 0;
+    uint64_t start;
+
+    printf("TestCslTxScheduler: %u CSL children\n", kNumChildren);
+
+    core.SetLogEnabled(false);
+
+    leader = core.CreateNode();
+    VerifyOrQuit(leader != nullptr, "CreateNode() failed");
+
+    SuccessOrQuit(leader->Form(), "Form() failed");
+    core.AdvanceTime(10 * 1000);
+    VerifyOrQuit(otThreadGetDeviceRole(&leader->GetInstance()) == OT_DEVICE_ROLE_LEADER, "leader not elected");
+
+    Instance &      instance  = leader->GetInstance();
+    CslTxScheduler &scheduler = instance.Get<CslTxScheduler>();
+
+    AddCslChildren(instance);
+    SendToAllSleepyChildren(instance);
+
+    // Process the tasklets (which queue the message for the children)
+    // without advancing the time, so no CSL transmission is started
+    // yet and every update below leads to a scheduling decision.
+
+    core.AdvanceTime(0);
+
+    for (Child &child : instance.Get<ChildTable>().Iterate(Child::kInStateValid))
+    {
+        numPending += (child.GetIndirectMessageCount() > 0) ? 1 : 0;
+    }
+
+    VerifyOrQuit(numPending == kNumChildren, "message was not queued for all children");
+
+    // Each update mirrors the reception of a frame from a child (which
+    // re-anchors its CSL schedule) followed by a scheduling decision.
+    // A decision which takes longer than the CSL frame request ahead
+    // time would miss the chosen CSL window.
+
+    for (uint32_t i = 0; i < kNumUpdates; i++)
+    {
+        uint16_t index = Random::NonCrypto::GetUint16InRange(0, kNumChildren);
+        Child &  child = *instance.Get<ChildTable>().GetChildAtIndex(index);
+        uint64_t duration;
+
+        child.SetLastRxTimestamp(otPlatRadioGetNow(&instance));
+
+        start = GetWallTimeNs();
+        scheduler.Update(child);
+        duration = GetWallTimeNs() - start;
+
+        totalNs += duration;
+        maxNs = (duration > maxNs) ? duration : maxNs;
+
+        if (duration > OPENTHREAD_CONFIG_MAC_CSL_REQUEST_AHEAD_US * 1000ULL)
+        {
+            numMissed++;
+        }
+    }
+
+    printf("  scheduling latency: avg %lu ns, max %lu ns\n", static_cast<unsigned long>(totalNs / kNumUpdates),
+           static_cast<unsigned long>(maxNs));
+    printf("  missed windows: %lu of %lu (%.3f%%)\n", static_cast<unsigned long>(numMissed),
+           static_cast<unsigned long>(kNumUpdates), 100.0 * numMissed / kNumUpdates);
+
+    // Let the scheduler serve the children. There are no real child
+    // nodes to acknowledge the frames, so a child is served once it
+    // sees a CSL transmission attempt (or loses its CSL synchronization
+    // after the maximum number of attempts).
+
+    start = GetWallTimeNs();
+
+    for (uint32_t elapsed = 0; elapsed < kMaxServiceDuration; elapsed += kServiceCheckInterval)
+    {
+        core.AdvanceTime(kServiceCheckInterval);
+
+        numNotServed = 0;
+
+        for (Child &child : instance.Get<ChildTable>().Iterate(Child::kInStateValid))
+        {
+            if (child.IsCslSynchronized() && (child.GetIndirectMessageCount() > 0) && (child.GetCslTxAttempts() == 0))
+            {
+                numNotServed++;
+            }
+        }
+
+        if (numNotServed == 0)
+        {
+            printf("  all children served within %lu sec (wall time %lu usec)\n",
+                   static_cast<unsigned long>((elapsed + kServiceCheckInterval) / 1000),
+                   static_cast<unsigned long>((GetWallTimeNs() - start) / 1000));
+            break;
+        }
+    }
+
+    VerifyOrQuit(numNotServed == 0, "CSL scheduler did not serve all children");
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestCslTxScheduler();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,377 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread/dns_client.h>
+#include <openthread/ip6.h>
+#include <openthread/message.h>
+#include <openthread/srp_client.h>
+#include <openthread/srp_server.h>
+#include <openthread/thread.h>
+#include <openthread/udp.h>
+
+#include "common/code_utils.hpp"
+
+#include "test_util.h"
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+static constexpr uint32_t kLease            = 120; // SRP lease (in seconds), used as the TTL of DNS-SD records.
+static constexpr uint16_t kDnssdPort        = 53;
+static constexpr uint16_t kMaxMessages      = 512;
+static constexpr uint32_t kResponseWaitStep = 100;       // In milliseconds.
+static constexpr uint32_t kMaxResponseWait  = 20 * 1000; // In milliseconds.
+static const char         kHostLabel[]      = "cachehost";
+static const char         kHostName[]       = "cachehost.default.service.arpa.";
+static const char         kUnknownName[]    = "unknown.default.service.arpa.";
+static const char         kLongTtlName[]    = "longttl.default.service.arpa.";
+static constexpr uint16_t kFakeServerPort   = 5300;
+static constexpr uint32_t kLongTtl          = 0x7fffffff; // Largest TTL allowed by RFC 2181.
+
+static otSrpClientService sService;
+
+struct ResolveResult
+{
+    bool         mDone;
+    otError      mError;
+    otIp6Address mAddress;
+    uint32_t     mTtl;
+};
+
+static ResolveResult sResult;
+static otUdpSocket   sFakeServerSocket;
+static otIp6Address  sFakeServerAnswer;
+static uint16_t      sFakeServerQueryCount;
+
+static void HandleFakeServerQuery(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    // Answers any AAAA query with `sFakeServerAnswer` and a `kLongTtl`
+    // TTL. The response repeats the query (header and question) and
+    // appends the answer record, naming the question with a pointer.
+
+    static const uint8_t kAnswer[] = {0xc0, 0x0c, 0x00, 0x1c, 0x00, 0x01, (kLongTtl >> 24) & 0xff,
+                                      (kLongTtl >> 16) & 0xff, (kLongTtl >> 8) & 0xff, kLongTtl & 0xff,
+                                      0x00, 0x10};
+
+    otInstance *instance = static_cast<otInstance *>(aContext);
+    uint8_t     query[128];
+    uint16_t    length;
+    otMessage * response;
+
+    length = otMessageRead(aMessage, otMessageGetOffset(aMessage), query, sizeof(query));
+    VerifyOrQuit(length > 12 && length < sizeof(query), "unexpected query");
+
+    sFakeServerQueryCount++;
+
+    query[2] |= 0x80; // QR (response) flag.
+    query[3] = 0;     // Response code.
+    query[7] = 1;     // Answer count.
+
+    response = otUdpNewMessage(instance, nullptr);
+    VerifyOrQuit(response != nullptr, "no buffers for the response");
+    SuccessOrQuit(otMessageAppend(response, query, length), "Append() failed");
+    SuccessOrQuit(otMessageAppend(response, kAnswer, sizeof(kAnswer)), "Append() failed");
+    SuccessOrQuit(otMessageAppend(response, &sFakeServerAnswer, sizeof(sFakeServerAnswer)), "Append() failed");
+    SuccessOrQuit(otUdpSend(instance, &sFakeServerSocket, response, aMessageInfo), "UdpSend() failed");
+}
+
+static void HandleAddressResponse(otError aError, const otDnsAddressResponse *aResponse, void *aContext)
+{
+    OT_UNUSED_VARIABLE(aContext);
+
+    sResult.mDone  = true;
+    sResult.mError = aError;
+
+    if (aError == OT_ERROR_NONE)
+    {
+        SuccessOrQuit(otDnsAddressResponseGetAddress(aResponse, 0, &sResult.mAddress, &sResult.mTtl),
+                      "GetAddress() failed");
+    }
+}
+
+static void Resolve(Node &aNode, const char *aName)
+{
+    memset(&sResult, 0, sizeof(sResult));
+    SuccessOrQuit(otDnsClientResolveAddress(&aNode.GetInstance(), aName, HandleAddressResponse, nullptr, nullptr),
+                  "ResolveAddress() failed");
+}
+
+static void WaitForResponse(void)
+{
+    // Frames may be lost (e.g., when two nodes transmit at the same
+    // time), so allow for the DNS client to retransmit the query.
+
+    for (uint32_t duration = 0; !sResult.mDone && (duration < kMaxResponseWait); duration += kResponseWaitStep)
+    {
+        Core::Get().AdvanceTime(kResponseWaitStep);
+    }
+
+    VerifyOrQuit(sResult.mDone, "no response");
+}
+
+static void VerifyCounters(Node &aNode, uint32_t aHits, uint32_t aMisses)
+{
+    const otDnsCacheCounters *counters = otDnsClientGetCacheCounters(&aNode.GetInstance());
+
+    VerifyOrQuit(counters->mHits == aHits, "unexpected cache hits");
+    VerifyOrQuit(counters->mMisses == aMisses, "unexpected cache misses");
+}
+
+void TestDnsClientCache(void)
+{
+    Core &                    core   = Core::Get();
+    Node &                    leader = *core.CreateNode();
+    Node &                    host   = *core.CreateNode();
+    Node &                    client = *core.CreateNode();
+    otLinkModeConfig          mode;
+    otDnsQueryConfig          config;
+    otIp6Address              hostAddress;
+    otMessage *               messages[kMaxMessages];
+    uint16_t                  numMessages;
+    const otDnsCacheCounters *counters;
+
+    printf("TestDnsClientCache\n");
+
+    // Form the network: the leader runs the SRP and DNS-SD servers,
+    // `host` registers its name with SRP, and `client` resolves it.
+
+    SuccessOrQuit(leader.Form(), "Form() failed");
+    core.AdvanceTime(10 * 1000);
+    VerifyOrQuit(otThreadGetDeviceRole(&leader.GetInstance()) == OT_DEVICE_ROLE_LEADER, "leader not elected");
+
+    SuccessOrQuit(otSrpServerSetLeaseRange(&leader.GetInstance(), kLease, kLease, kLease, kLease),
+                  "SetLeaseRange() failed");
+    otSrpServerSetEnabled(&leader.GetInstance(), true);
+
+    mode.mRxOnWhenIdle = true;
+    mode.mDeviceType   = true;
+    mode.mNetworkData  = true;
+
+    SuccessOrQuit(host.Join(leader, mode), "Join() failed");
+    SuccessOrQuit(client.Join(leader, mode), "Join() failed");
+    core.AdvanceTime(300 * 1000);
+
+    VerifyOrQuit(otThreadGetDeviceRole(&host.GetInstance()) == OT_DEVICE_ROLE_ROUTER, "host did not attach");
+    VerifyOrQuit(otThreadGetDeviceRole(&client.GetInstance()) == OT_DEVICE_ROLE_ROUTER, "client did not attach");
+
+    hostAddress = *otThreadGetMeshLocalEid(&host.GetInstance());
+
+    otSrpClientSetLeaseInterval(&host.GetInstance(), kLease);
+    SuccessOrQuit(otSrpClientSetHostName(&host.GetInstance(), kHostLabel), "SetHostName() failed");
+    SuccessOrQuit(otSrpClientSetHostAddresses(&host.GetInstance(), &hostAddress, 1), "SetHostAddresses() failed");
+
+    // The SRP client only registers the host along with a service.
+    memset(&sService, 0, sizeof(sService));
+    sService.mName         = "_cache._udp";
+    sService.mInstanceName = "instance";
+    sService.mPort         = 1234;
+    SuccessOrQuit(otSrpClientAddService(&host.GetInstance(), &sService), "AddService() failed");
+    otSrpClientEnableAutoStartMode(&host.GetInstance(), nullptr, nullptr);
+    core.AdvanceTime(10 * 1000);
+
+    memset(&config, 0, sizeof(config));
+    config.mServerSockAddr.mAddress = *otThreadGetMeshLocalEid(&leader.GetInstance());
+    config.mServerSockAddr.mPort    = kDnssdPort;
+    config.mNat64Mode               = OT_DNS_NAT64_DISALLOW; // DNS-SD server does not answer A queries.
+    otDnsClientSetDefaultConfig(&client.GetInstance(), &config);
+
+    // A first query is sent to the server.
+
+    Resolve(client, kHostName);
+    VerifyOrQuit(!sResult.mDone, "first query was answered from the cache");
+    WaitForResponse();
+    VerifyOrQuit(sResult.mDone && (sResult.mError == OT_ERROR_NONE), "first query failed");
+    VerifyOrQuit(memcmp(&sResult.mAddress, &hostAddress, sizeof(hostAddress)) == 0, "wrong address");
+    VerifyOrQuit((sResult.mTtl > 0) && (sResult.mTtl <= kLease), "wrong TTL");
+    VerifyCounters(client, 0, 1);
+
+    // The same query is answered from the cache (before returning),
+    // with the TTL reduced by the time the response spent in the cache.
+
+    core.AdvanceTime(30 * 1000);
+
+    Resolve(client, kHostName);
+    VerifyOrQuit(sResult.mDone && (sResult.mError == OT_ERROR_NONE), "second query was not answered from the cache");
+    VerifyOrQuit(memcmp(&sResult.mAddress, &hostAddress, sizeof(hostAddress)) == 0, "wrong cached address");
+    VerifyOrQuit(sResult.mTtl <= kLease - 30, "TTL of cached response not adjusted");
+    VerifyCounters(client, 1, 1);
+
+    // Once the TTL expires, the query is sent to the server again.
+
+    core.AdvanceTime(kLease * 1000);
+
+    Resolve(client, kHostName);
+    VerifyOrQuit(!sResult.mDone, "expired response was used");
+    WaitForResponse();
+    VerifyOrQuit(sResult.mDone && (sResult.mError == OT_ERROR_NONE), "query after expiry failed");
+    VerifyCounters(client, 1, 2);
+
+    // Negative responses are cached as well.
+
+    Resolve(client, kUnknownName);
+    WaitForResponse();
+    VerifyOrQuit(sResult.mDone && (sResult.mError == OT_ERROR_NOT_FOUND), "unknown name resolved");
+    VerifyCounters(client, 1, 3);
+
+    Resolve(client, kUnknownName);
+    VerifyOrQuit(sResult.mDone && (sResult.mError == OT_ERROR_NOT_FOUND), "negative response not cached");
+    VerifyCounters(client, 2, 3);
+
+    core.AdvanceTime(OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_NEGATIVE_TTL * 1000);
+
+    Resolve(client, kUnknownName);
+    VerifyOrQuit(!sResult.mDone, "expired negative response was used");
+    WaitForResponse();
+    VerifyCounters(client, 2, 4);
+
+    // Cached responses are released when the message pool runs out of
+    // buffers.
+
+    Resolve(client, kHostName);
+    VerifyOrQuit(sResult.mDone, "host not cached");
+    VerifyCounters(client, 3, 4);
+
+    for (numMessages = 0; numMessages < kMaxMessages; numMessages++)
+    {
+        messages[numMessages] = otIp6NewMessage(&client.GetInstance(), nullptr);
+
+        if (messages[numMessages] == nullptr)
+        {
+            break;
+        }
+    }
+
+    VerifyOrQuit(numMessages < kMaxMessages, "message pool was not exhausted");
+
+    counters = otDnsClientGetCacheCounters(&client.GetInstance());
+    VerifyOrQuit(counters->mEvictions == 2, "cached responses were not evicted");
+
+    for (uint16_t i = 0; i < numMessages; i++)
+    {
+        otMessageFree(messages[i]);
+    }
+
+    Resolve(client, kHostName);
+    VerifyOrQuit(!sResult.mDone, "evicted response was used");
+    WaitForResponse();
+    VerifyOrQuit(sResult.mDone && (sResult.mError == OT_ERROR_NONE), "query after eviction failed");
+    VerifyCounters(client, 3, 5);
+
+    // The cache is cleared when the device leaves the network.
+
+    SuccessOrQuit(otThreadSetEnabled(&client.GetInstance(), false), "ThreadSetEnabled() failed");
+    SuccessOrQuit(otThreadSetEnabled(&client.GetInstance(), true), "ThreadSetEnabled() failed");
+    core.AdvanceTime(300 * 1000);
+    VerifyOrQuit(otThreadGetDeviceRole(&client.GetInstance()) != OT_DEVICE_ROLE_DETACHED, "client did not reattach");
+
+    Resolve(client, kHostName);
+    VerifyOrQuit(!sResult.mDone, "response was kept after leaving the network");
+    WaitForResponse();
+    VerifyOrQuit(sResult.mDone && (sResult.mError == OT_ERROR_NONE), "query after reattach failed");
+    VerifyCounters(client, 3, 6);
+
+    // Up to `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES` responses
+    // are kept, the least recently used one is evicted first.
+
+    otDnsClientResetCacheCounters(&client.GetInstance());
+
+    for (uint16_t i = 0; i < OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_ENTRIES; i++)
+    {
+        char name[64];
+
+        snprintf(name, sizeof(name), "unknown%u.default.service.arpa.", i);
+        Resolve(client, name);
+        WaitForResponse();
+        VerifyOrQuit(sResult.mDone, "query failed");
+    }
+
+    counters = otDnsClientGetCacheCounters(&client.GetInstance());
+    VerifyOrQuit(counters->mEvictions == 1, "least recently used response not evicted");
+
+    Resolve(client, kHostName);
+    VerifyOrQuit(!sResult.mDone, "least recently used response was kept");
+    WaitForResponse();
+
+    Resolve(client, "unknown1.default.service.arpa.");
+    VerifyOrQuit(sResult.mDone, "recently used response was evicted");
+
+    // A response with a very long TTL is kept at most
+    // `OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL` seconds.
+
+    {
+        otSockAddr sockName;
+
+        memset(&sockName, 0, sizeof(sockName));
+        sockName.mPort = kFakeServerPort;
+
+        SuccessOrQuit(otUdpOpen(&host.GetInstance(), &sFakeServerSocket, HandleFakeServerQuery, &host.GetInstance()),
+                      "UdpOpen() failed");
+        SuccessOrQuit(otUdpBind(&host.GetInstance(), &sFakeServerSocket, &sockName), "UdpBind() failed");
+    }
+
+    sFakeServerAnswer               = hostAddress;
+    config.mServerSockAddr.mAddress = hostAddress;
+    config.mServerSockAddr.mPort    = kFakeServerPort;
+    otDnsClientSetDefaultConfig(&client.GetInstance(), &config);
+
+    Resolve(client, kLongTtlName);
+    WaitForResponse();
+    VerifyOrQuit(sResult.mDone && (sResult.mError == OT_ERROR_NONE), "long TTL query failed");
+    VerifyOrQuit(sResult.mTtl == kLongTtl, "wrong long TTL");
+    VerifyOrQuit(sFakeServerQueryCount > 0, "long TTL query not sent to the server");
+
+    core.AdvanceTime((OPENTHREAD_CONFIG_DNS_CLIENT_CACHE_MAX_TTL - 1) * 1000);
+
+    Resolve(client, kLongTtlName);
+    VerifyOrQuit(sResult.mDone, "long TTL response not cached");
+
+    core.AdvanceTime(2 * 1000);
+
+    sFakeServerQueryCount = 0;
+    Resolve(client, kLongTtlName);
+    VerifyOrQuit(!sResult.mDone, "long TTL response kept longer than the maximum cache TTL");
+    WaitForResponse();
+    VerifyOrQuit(sFakeServerQueryCount > 0, "long TTL query not sent to the server again");
+
+    SuccessOrQuit(otUdpClose(&host.GetInstance(), &sFakeServerSocket), "UdpClose() failed");
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestDnsClientCache();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,340 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <openthread/message.h>
+#include <openthread/thread.h>
+#include <openthread/udp.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/random.hpp"
+#include "thread/child_table.hpp"
+#include "thread/indirect_sender.hpp"
+#include "thread/mesh_forwarder.hpp"
+#include "thread/mle_router.hpp"
+#include "thread/network_data_leader.hpp"
+
+#include "test_util.h"
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+static constexpr uint16_t kNumChildren          = 256;
+static constexpr uint16_t kNumMessages          = 200;
+static constexpr uint16_t kNumMulticastMessages = 2;
+static constexpr uint16_t kNumRotations         = 4;
+static constexpr uint16_t kNumRounds            = 10;
+static constexpr uint32_t kChildTimeout         = 24 * 60 * 60; // In seconds.
+static constexpr uint16_t kUdpPort              = 12345;
+
+static uint64_t GetWallTimeNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL + static_cast<uint64_t>(now.tv_nsec);
+}
+
+static void AddSleepyChildren(Instance &aInstance, uint16_t aNumChildren)
+{
+    for (uint16_t i = 0; i < aNumChildren; i++)
+    {
+        Child *         child = aInstance.Get<ChildTable>().GetNewChild();
+        Mac::ExtAddress extAddress;
+
+        VerifyOrQuit(child != nullptr, "GetNewChild() failed");
+
+        child->SetState(Neighbor::kStateValid);
+        child->SetRloc16(aInstance.Get<Mle::MleRouter>().GetRloc16() | (i + 1));
+        extAddress.GenerateRandom();
+        child->SetExtAddress(extAddress);
+        child->SetDeviceMode(Mle::DeviceMode(0));
+        child->SetTimeout(kChildTimeout);
+        child->SetLastHeard(TimerMilli::GetNow());
+        child->SetNetworkDataVersion(aInstance.Get<NetworkData::Leader>().GetStableVersion());
+    }
+}
+
+static void SendUdp(Instance &aInstance, otUdpSocket &aSocket, const Ip6::Address &aDestination)
+{
+    otMessageInfo messageInfo;
+    otMessage *   message;
+    uint8_t       payload[] = {0x01, 0x02, 0x03, 0x04};
+
+    memset(&messageInfo, 0, sizeof(messageInfo));
+    messageInfo.mPeerAddr = aDestination;
+    messageInfo.mPeerPort = kUdpPort;
+
+    message = otUdpNewMessage(&aInstance, nullptr);
+    VerifyOrQuit(message != nullptr, "otUdpNewMessage() failed");
+    SuccessOrQuit(otMessageAppend(message, payload, sizeof(payload)), "otMessageAppend() failed");
+    SuccessOrQuit(otUdpSend(&aInstance, &aSocket, message, &messageInfo), "otUdpSend() failed");
+}
+
+static void QueueMessages(Instance &aInstance)
+{
+    // Most messages are unicast to a random sleepy child. A few are
+    // sent to the realm-local all Thread nodes address and are shared
+    // by all sleepy children.
+
+    otUdpSocket socket;
+
+    memset(&socket, 0, sizeof(socket));
+    SuccessOrQuit(otUdpOpen(&aInstance, &socket, nullptr, nullptr), "otUdpOpen() failed");
+
+    for (uint16_t i = 0; i < kNumMessages; i++)
+    {
+        Ip6::Address destination;
+
+        if (i % (kNumMessages / kNumMulticastMessages) == 0)
+        {
+            destination = aInstance.Get<Mle::MleRouter>().GetRealmLocalAllThreadNodesAddress();
+        }
+        else
+        {
+            uint16_t index = Random::NonCrypto::GetUint16InRange(0, kNumChildren);
+
+            destination.SetToRoutingLocator(aInstance.Get<Mle::MleRouter>().GetMeshLocalPrefix(),
+                                            aInstance.Get<ChildTable>().GetChildAtIndex(index)->GetRloc16());
+        }
+
+        SendUdp(aInstance, socket, destination);
+    }
+
+    SuccessOrQuit(otUdpClose(&aInstance, &socket), "otUdpClose() failed");
+}
+
+static bool IsInSendQueue(Instance &aInstance, const Message &aMessage)
+{
+    const Message *message;
+
+    for (message = aInstance.Get<MeshForwarder>().GetSendQueue().GetHead(); message; message = message->GetNext())
+    {
+        if (message == &aMessage)
+        {
+            break;
+        }
+    }
+
+    return (message != nullptr);
+}
+
+static Message *FindFirstMessageForChild(Instance &aInstance, Child &aChild)
+{
+    uint16_t       childIndex = aInstance.Get<ChildTable>().GetChildIndex(aChild);
+    const Message *message;
+
+    for (message = aInstance.Get<MeshForwarder>().GetSendQueue().GetHead(); message; message = message->GetNext())
+    {
+        if (message->GetChildMask(childIndex))
+        {
+            break;
+        }
+    }
+
+    return const_cast<Message *>(message);
+}
+
+void TestIndirectSender(void)
+{
+    Core &   core            = Core::Get();
+    Node *   leader;
+    uint64_t lookupNs        = 0;
+    uint32_t numLookups      = 0;
+    uint64_t removalNs       = 0;
+    uint32_t numRemovals     = 0;
+    uint32_t numQueuedPerRnd = 0;
+
+    printf("TestIndirectSender: %u children, %u queued messages\n", kNumChildren, kNumMessages);
+
+    core.SetLogEnabled(false);
+
+    leader = core.CreateNode();
+    VerifyOrQuit(leader != nullptr, "CreateNode() failed");
+
+    SuccessOrQuit(leader->Form(), "Form() failed");
+    core.AdvanceTime(10 * 1000);
+    VerifyOrQuit(otThreadGetDeviceRole(&leader->GetInstance()) == OT_DEVICE_ROLE_LEADER, "leader not elected");
+
+    Instance &      instance       = leader->GetInstance();
+    IndirectSender &indirectSender = instance.Get<IndirectSender>();
+
+    AddSleepyChildren(instance, kNumChildren);
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        uint32_t numQueued = 0;
+
+        QueueMessages(instance);
+
+        // Process the tasklets (which queue the messages for the
+        // children) without advancing the time, so the children keep
+        // all their messages during the benchmark.
+
+        core.AdvanceTime(0);
+
+        for (Child &child : instance.Get<ChildTable>().Iterate(Child::kInStateValid))
+        {
+            numQueued += child.GetIndirectMessageCount();
+        }
+
+        VerifyOrQuit(numQueued == (kNumMessages - kNumMulticastMessages) + kNumMulticastMessages * kNumChildren,
+                     "messages were not queued for the children");
+        numQueuedPerRnd = numQueued;
+
+        // Move the first queued message of each child to the back of
+        // its queue (as if it was delivered and then queued again).
+        // Each step looks up the next message for the child.
+
+        for (uint16_t rotation = 0; rotation < kNumRotations; rotation++)
+        {
+            for (Child &child : instance.Get<ChildTable>().Iterate(Child::kInStateValid))
+            {
+                Message *message = FindFirstMessageForChild(instance, child);
+                uint64_t start;
+
+                VerifyOrQuit(message != nullptr, "child has no queued message");
+
+                start = GetWallTimeNs();
+                SuccessOrQuit(indirectSender.RemoveMessageFromSleepyChild(*message, child),
+                              "RemoveMessageFromSleepyChild() failed");
+                indirectSender.AddMessageForSleepyChild(*message, child);
+                lookupNs += GetWallTimeNs() - start;
+                numLookups++;
+            }
+        }
+
+        // Remove all messages of each child (as done when the child is
+        // detached).
+
+        for (Child &child : instance.Get<ChildTable>().Iterate(Child::kInStateValid))
+        {
+            uint64_t start = GetWallTimeNs();
+
+            indirectSender.ClearAllMessagesForSleepyChild(child);
+            removalNs += GetWallTimeNs() - start;
+            numRemovals++;
+
+            VerifyOrQuit(child.GetIndirectMessageCount() == 0, "ClearAllMessagesForSleepyChild() failed");
+        }
+
+        // Let the multicast messages be sent directly and freed.
+
+        core.AdvanceTime(1000);
+    }
+
+    printf("  %lu (message, child) pairs queued per round\n", static_cast<unsigned long>(numQueuedPerRnd));
+    printf("  next message lookup: avg %lu ns\n", static_cast<unsigned long>(lookupNs / numLookups));
+    printf("  child removal: avg %lu ns\n", static_cast<unsigned long>(removalNs / numRemovals));
+}
+
+void TestDroppedDirectTransmission(void)
+{
+    // A realm-local multicast is queued for direct transmission and
+    // for the sleepy children. The router then detaches (keeping its
+    // children), so the direct transmission is dropped. The message
+    // must stay queued for the children until they are done with it.
+
+    static constexpr uint16_t kNumSleepyChildren = 4;
+
+    Core &       core = Core::Get();
+    Node *       node;
+    Message *    message;
+    Ip6::Header  ip6Header;
+    Ip6::Address destination;
+
+    printf("TestDroppedDirectTransmission\n");
+
+    core.SetLogEnabled(false);
+
+    node = core.CreateNode();
+    VerifyOrQuit(node != nullptr, "CreateNode() failed");
+
+    SuccessOrQuit(node->Form(), "Form() failed");
+    core.AdvanceTime(10 * 1000);
+    VerifyOrQuit(otThreadGetDeviceRole(&node->GetInstance()) == OT_DEVICE_ROLE_LEADER, "leader not elected");
+
+    Instance &instance = node->GetInstance();
+
+    AddSleepyChildren(instance, kNumSleepyChildren);
+
+    destination = instance.Get<Mle::MleRouter>().GetRealmLocalAllThreadNodesAddress();
+
+    ip6Header.Init();
+    ip6Header.SetPayloadLength(0);
+    ip6Header.SetNextHeader(Ip6::kProtoNone);
+    ip6Header.SetHopLimit(OPENTHREAD_CONFIG_IP6_HOP_LIMIT_DEFAULT);
+    ip6Header.SetSource(instance.Get<Mle::MleRouter>().GetMeshLocal16());
+    ip6Header.SetDestination(destination);
+
+    message = instance.Get<Ip6::Ip6>().NewMessage(0);
+    VerifyOrQuit(message != nullptr, "NewMessage() failed");
+    SuccessOrQuit(message->Append(ip6Header), "Append() failed");
+
+    SuccessOrQuit(instance.Get<MeshForwarder>().SendMessage(*message), "SendMessage() failed");
+    VerifyOrQuit(message->GetDirectTransmission(), "multicast not queued for direct transmission");
+    VerifyOrQuit(message->IsChildPending(), "multicast not queued for the sleepy children");
+
+    SuccessOrQuit(instance.Get<Mle::MleRouter>().BecomeDetached(), "BecomeDetached() failed");
+    core.AdvanceTime(0);
+
+    VerifyOrQuit(IsInSendQueue(instance, *message), "message was freed while queued for the sleepy children");
+    VerifyOrQuit(!message->GetDirectTransmission(), "dropped direct transmission still scheduled");
+
+    for (Child &child : instance.Get<ChildTable>().Iterate(Child::kInStateValid))
+    {
+        VerifyOrQuit(child.GetIndirectMessageCount() == 1, "message not queued for the child");
+        VerifyOrQuit(FindFirstMessageForChild(instance, child) == message, "child index does not match");
+    }
+
+    for (Child &child : instance.Get<ChildTable>().Iterate(Child::kInStateValid))
+    {
+        VerifyOrQuit(IsInSendQueue(instance, *message), "message freed before the last child was done");
+        instance.Get<IndirectSender>().ClearAllMessagesForSleepyChild(child);
+    }
+
+    VerifyOrQuit(!IsInSendQueue(instance, *message), "message not freed after the last child was done");
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestIndirectSender();
+    ot::Nexus::TestDroppedDirectTransmission();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,150 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <openthread/thread.h>
+
+#include "common/code_utils.hpp"
+
+#include "test_util.h"
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+static constexpr uint16_t kGridWidth      = 10;
+static constexpr uint16_t kGridHeight     = 12;
+static constexpr uint16_t kNumNodes       = kGridWidth * kGridHeight;
+static constexpr int      kRange          = 2;
+static constexpr uint32_t kAttachDuration = 30 * 60 * 1000; // 30 minutes of virtual time.
+
+static bool AreNeighbors(uint16_t aId1, uint16_t aId2)
+{
+    // Nodes are placed on a grid and can only hear the nodes within two steps (including diagonals). A shorter
+    // range would need more than the maximum number of routers to connect the grid as a single partition.
+
+    int dx = static_cast<int>(aId1 % kGridWidth) - static_cast<int>(aId2 % kGridWidth);
+    int dy = static_cast<int>(aId1 / kGridWidth) - static_cast<int>(aId2 / kGridWidth);
+
+    return (dx >= -kRange) && (dx <= kRange) && (dy >= -kRange) && (dy <= kRange);
+}
+
+void TestLargeNetwork(void)
+{
+    Core &           core = Core::Get();
+    Node *           nodes[kNumNodes];
+    otLinkModeConfig mode;
+    uint16_t         numLeaders  = 0;
+    uint16_t         numRouters  = 0;
+    uint16_t         numChildren = 0;
+    clock_t          start;
+    double           wallTime;
+
+    printf("TestLargeNetwork: %u nodes on a %ux%u grid\n", kNumNodes, kGridWidth, kGridHeight);
+
+    for (Node *&node : nodes)
+    {
+        node = core.CreateNode();
+        VerifyOrQuit(node != nullptr, "CreateNode() failed");
+    }
+
+    core.DisconnectAllLinks();
+
+    for (uint16_t i = 0; i < kNumNodes; i++)
+    {
+        for (uint16_t j = i + 1; j < kNumNodes; j++)
+        {
+            if (AreNeighbors(i, j))
+            {
+                core.SetLinks(*nodes[i], *nodes[j], {Core::kDefaultRssi, 0, 0});
+            }
+        }
+    }
+
+    start = clock();
+
+    SuccessOrQuit(nodes[0]->Form(), "Form() failed");
+    core.AdvanceTime(10 * 1000);
+    VerifyOrQuit(otThreadGetDeviceRole(&nodes[0]->GetInstance()) == OT_DEVICE_ROLE_LEADER, "leader not elected");
+
+    mode.mRxOnWhenIdle = true;
+    mode.mDeviceType   = true;
+    mode.mNetworkData  = true;
+
+    for (uint16_t i = 1; i < kNumNodes; i++)
+    {
+        SuccessOrQuit(nodes[i]->Join(*nodes[0], mode), "Join() failed");
+    }
+
+    core.AdvanceTime(kAttachDuration);
+
+    wallTime = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+    for (Node *node : nodes)
+    {
+        switch (otThreadGetDeviceRole(&node->GetInstance()))
+        {
+        case OT_DEVICE_ROLE_LEADER:
+            numLeaders++;
+            numRouters++;
+            break;
+        case OT_DEVICE_ROLE_ROUTER:
+            numRouters++;
+            break;
+        case OT_DEVICE_ROLE_CHILD:
+            numChildren++;
+            break;
+        default:
+            fprintf(stderr, "node %u is not attached\n", node->GetId());
+            break;
+        }
+    }
+
+    printf("  routers: %u, children: %u\n", numRouters, numChildren);
+    printf("  virtual time: %lu sec, wall time: %.2f sec, events: %lu\n",
+           static_cast<unsigned long>(core.GetNow() / 1000000), wallTime,
+           static_cast<unsigned long>(core.GetNumEvents()));
+
+    VerifyOrQuit(numRouters + numChildren == kNumNodes, "not all nodes attached");
+    VerifyOrQuit(numLeaders == 1, "network is partitioned");
+    VerifyOrQuit(numRouters <= OPENTHREAD_CONFIG_MLE_MAX_ROUTERS, "too many routers");
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestLargeNetwork();
+    printf("All tests passed\n");
+    return 0;
+}
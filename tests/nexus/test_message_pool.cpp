@@ -0,0 +1,277 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include <openthread/message.h>
+#include <openthread/thread.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "net/ip6.hpp"
+#include "thread/child_table.hpp"
+#include "thread/indirect_sender.hpp"
+#include "thread/mesh_forwarder.hpp"
+#include "thread/mle_router.hpp"
+
+#include "test_util.h"
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+static uint16_t AllocateMessages(MessagePool &     aMessagePool,
+                                 Message::Type     aType,
+                                 Message::Priority aPriority,
+                                 Message **        aMessages,
+                                 uint16_t &        aNumMessages)
+{
+    // Allocates single buffer messages until the pool runs out of
+    // buffers for `aPriority`, and returns the number of messages.
+
+    uint16_t count = 0;
+    Message *message;
+
+    while ((message = aMessagePool.New(aType, 0, aPriority)) != nullptr)
+    {
+        VerifyOrQuit(aNumMessages < kNumBuffers, "allocated more messages than buffers");
+        aMessages[aNumMessages++] = message;
+        count++;
+    }
+
+    return count;
+}
+
+void TestMessagePool(void)
+{
+    Core &                      core = Core::Get();
+    Node *                      node;
+    Message *                   messages[kNumBuffers];
+    uint16_t                    numMessages = 0;
+    uint16_t                    numUsed;
+    uint16_t                    numLow;
+    uint16_t                    numLowUsed;
+    uint16_t                    numOtherUsed;
+    uint16_t                    numReservedHigh;
+    uint16_t                    numReservedNet;
+    const otMessageBufferStats *stats;
+
+    core.SetLogEnabled(false);
+
+    node = core.CreateNode();
+    VerifyOrQuit(node != nullptr, "CreateNode() failed");
+
+    SuccessOrQuit(node->Form(), "Form() failed");
+    core.AdvanceTime(10 * 1000);
+    VerifyOrQuit(otThreadGetDeviceRole(&node->GetInstance()) == OT_DEVICE_ROLE_LEADER, "leader not elected");
+
+    // The time is not advanced below, so the node does not allocate
+    // or free any messages during the test.
+
+    MessagePool &messagePool = node->GetInstance().Get<MessagePool>();
+
+    stats           = &messagePool.GetBufferStats();
+    numReservedHigh = stats->mReservedBuffers[Message::kPriorityHigh];
+    numReservedNet  = stats->mReservedBuffers[Message::kPriorityNet];
+
+    VerifyOrQuit(stats->mReservedBuffers[Message::kPriorityLow] == 0, "low priority buffers are reserved");
+    VerifyOrQuit(numReservedHigh == OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH, "reserved buffers are incorrect");
+    VerifyOrQuit(numReservedNet == OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NET, "reserved buffers are incorrect");
+
+    messagePool.ResetBufferStats();
+
+    numUsed      = stats->mTotal.mUsedBuffers;
+    numLowUsed   = stats->mPriorityUsage[Message::kPriorityLow].mUsedBuffers;
+    numOtherUsed = stats->mTypeUsage[Message::kTypeOther].mUsedBuffers;
+
+    VerifyOrQuit(numUsed + messagePool.GetFreeBufferCount() == messagePool.GetTotalBufferCount(),
+                 "used buffers are incorrect");
+    VerifyOrQuit(stats->mTotal.mMaxUsedBuffers == numUsed, "ResetBufferStats() failed");
+    VerifyOrQuit(stats->mTotal.mFailedAllocations == 0, "ResetBufferStats() failed");
+
+    // Low (and normal) priority messages cannot use the buffers
+    // reserved for the higher priority levels.
+
+    numLow = AllocateMessages(messagePool, Message::kTypeOther, Message::kPriorityLow, messages, numMessages);
+
+    VerifyOrQuit(messagePool.GetFreeBufferCount() == numReservedHigh + numReservedNet,
+                 "low priority messages used reserved buffers");
+    VerifyOrQuit(stats->mPriorityUsage[Message::kPriorityLow].mUsedBuffers == numLowUsed + numLow,
+                 "low priority usage is incorrect");
+    VerifyOrQuit(stats->mTypeUsage[Message::kTypeOther].mUsedBuffers == numOtherUsed + numLow,
+                 "message type usage is incorrect");
+    VerifyOrQuit(stats->mPriorityUsage[Message::kPriorityLow].mFailedAllocations == 1,
+                 "low priority failed allocations are incorrect");
+    VerifyOrQuit(stats->mTypeUsage[Message::kTypeOther].mFailedAllocations == 1,
+                 "message type failed allocations are incorrect");
+
+    VerifyOrQuit(AllocateMessages(messagePool, Message::kTypeIp6, Message::kPriorityNormal, messages, numMessages) == 0,
+                 "normal priority message used reserved buffers");
+    VerifyOrQuit(stats->mPriorityUsage[Message::kPriorityNormal].mFailedAllocations == 1,
+                 "normal priority failed allocations are incorrect");
+
+    // High priority messages can only use the buffers reserved for
+    // the high priority level, and network control priority messages
+    // can use the rest.
+
+    VerifyOrQuit(AllocateMessages(messagePool, Message::kTypeIp6, Message::kPriorityHigh, messages, numMessages) ==
+                     numReservedHigh,
+                 "high priority messages did not use the reserved buffers");
+    VerifyOrQuit(messagePool.GetFreeBufferCount() == numReservedNet, "high priority messages used reserved buffers");
+
+    VerifyOrQuit(AllocateMessages(messagePool, Message::kTypeIp6, Message::kPriorityNet, messages, numMessages) ==
+                     numReservedNet,
+                 "network control priority messages did not use the reserved buffers");
+    VerifyOrQuit(messagePool.GetFreeBufferCount() == 0, "message pool is not empty");
+
+    VerifyOrQuit(stats->mTotal.mUsedBuffers == messagePool.GetTotalBufferCount(), "used buffers are incorrect");
+    VerifyOrQuit(stats->mTotal.mFailedAllocations == 4, "failed allocations are incorrect");
+
+    printf("TestMessagePool: %u buffers, %u low priority messages, %u + %u reserved buffers\n",
+           messagePool.GetTotalBufferCount(), numLow, numReservedHigh, numReservedNet);
+
+    // Freeing the messages keeps the max number of used buffers.
+
+    for (uint16_t i = 0; i < numMessages; i++)
+    {
+        messages[i]->Free();
+    }
+
+    VerifyOrQuit(stats->mTotal.mUsedBuffers == numUsed, "used buffers are incorrect after Free()");
+    VerifyOrQuit(stats->mTotal.mMaxUsedBuffers == messagePool.GetTotalBufferCount(), "max used buffers is incorrect");
+    VerifyOrQuit(stats->mPriorityUsage[Message::kPriorityLow].mUsedBuffers == numLowUsed,
+                 "low priority usage is incorrect after Free()");
+    VerifyOrQuit(stats->mPriorityUsage[Message::kPriorityLow].mMaxUsedBuffers == numLowUsed + numLow,
+                 "low priority max usage is incorrect");
+
+    messagePool.ResetBufferStats();
+
+    VerifyOrQuit(stats->mTotal.mMaxUsedBuffers == numUsed, "ResetBufferStats() failed");
+    VerifyOrQuit(stats->mTotal.mFailedAllocations == 0, "ResetBufferStats() failed");
+    VerifyOrQuit(stats->mPriorityUsage[Message::kPriorityLow].mFailedAllocations == 0, "ResetBufferStats() failed");
+}
+
+void TestReservationEviction(void)
+{
+    // When only the reservation of the higher priority levels blocks an
+    // allocation, a queued message of the same priority must not be
+    // evicted to make room for it.
+
+    Core &          core = Core::Get();
+    Node *          node;
+    Child *         child;
+    Mac::ExtAddress extAddress;
+    Message *       indirectMessage;
+    Message *       message;
+    Message *       messages[kNumBuffers];
+    uint16_t        numMessages = 0;
+    Ip6::Header     ip6Header;
+    Ip6::Address    destination;
+
+    printf("TestReservationEviction\n");
+
+    core.SetLogEnabled(false);
+
+    node = core.CreateNode();
+    VerifyOrQuit(node != nullptr, "CreateNode() failed");
+
+    SuccessOrQuit(node->Form(), "Form() failed");
+    core.AdvanceTime(10 * 1000);
+    VerifyOrQuit(otThreadGetDeviceRole(&node->GetInstance()) == OT_DEVICE_ROLE_LEADER, "leader not elected");
+
+    Instance &   instance    = node->GetInstance();
+    MessagePool &messagePool = instance.Get<MessagePool>();
+
+    // Queue a normal priority message for a sleepy child.
+
+    child = instance.Get<ChildTable>().GetNewChild();
+    VerifyOrQuit(child != nullptr, "GetNewChild() failed");
+
+    child->SetState(Neighbor::kStateValid);
+    child->SetRloc16(instance.Get<Mle::MleRouter>().GetRloc16() | 1);
+    extAddress.GenerateRandom();
+    child->SetExtAddress(extAddress);
+    child->SetDeviceMode(Mle::DeviceMode(0));
+
+    destination.SetToRoutingLocator(instance.Get<Mle::MleRouter>().GetMeshLocalPrefix(), child->GetRloc16());
+
+    ip6Header.Init();
+    ip6Header.SetPayloadLength(0);
+    ip6Header.SetNextHeader(Ip6::kProtoNone);
+    ip6Header.SetHopLimit(OPENTHREAD_CONFIG_IP6_HOP_LIMIT_DEFAULT);
+    ip6Header.SetSource(instance.Get<Mle::MleRouter>().GetMeshLocal16());
+    ip6Header.SetDestination(destination);
+
+    indirectMessage =
+        instance.Get<Ip6::Ip6>().NewMessage(0, Message::Settings(Message::kWithLinkSecurity, Message::kPriorityNormal));
+    VerifyOrQuit(indirectMessage != nullptr, "NewMessage() failed");
+    SuccessOrQuit(indirectMessage->Append(ip6Header), "Append() failed");
+    SuccessOrQuit(instance.Get<MeshForwarder>().SendMessage(*indirectMessage), "SendMessage() failed");
+    VerifyOrQuit(indirectMessage->IsChildPending(), "message not queued for the sleepy child");
+
+    // Fill the pool up to the reservations. Neither the low nor the
+    // normal priority allocations which fail on the reservation may
+    // evict the normal priority indirect message.
+
+    AllocateMessages(messagePool, Message::kTypeOther, Message::kPriorityLow, messages, numMessages);
+    VerifyOrQuit(messagePool.GetFreeBufferCount() > 0, "message pool is empty");
+    VerifyOrQuit(child->GetIndirectMessageCount() == 1, "low priority allocation evicted a normal priority message");
+
+    message = messagePool.New(Message::kTypeOther, 0, Message::kPriorityNormal);
+    VerifyOrQuit(message == nullptr, "normal priority message used reserved buffers");
+    VerifyOrQuit(child->GetIndirectMessageCount() == 1, "normal priority allocation evicted an equal priority message");
+
+    // A network control priority message may still use the reserved
+    // buffers.
+
+    message = messagePool.New(Message::kTypeOther, 0, Message::kPriorityNet);
+    VerifyOrQuit(message != nullptr, "network control priority message could not use reserved buffers");
+    VerifyOrQuit(child->GetIndirectMessageCount() == 1, "message was evicted while buffers were free");
+    message->Free();
+
+    for (uint16_t i = 0; i < numMessages; i++)
+    {
+        messages[i]->Free();
+    }
+
+    instance.Get<IndirectSender>().ClearAllMessagesForSleepyChild(*child);
+    VerifyOrQuit(child->GetIndirectMessageCount() == 0, "ClearAllMessagesForSleepyChild() failed");
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestMessagePool();
+    ot::Nexus::TestReservationEviction();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,350 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "thread/mle_router.hpp"
+#include "thread/router_table.hpp"
+
+#include "test_util.h"
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+static constexpr uint16_t kGridWidth      = 8;
+static constexpr uint16_t kGridHeight     = 4;
+static constexpr uint16_t kNumNodes       = kGridWidth * kGridHeight;
+static constexpr uint32_t kAttachDuration = 20 * 60 * 1000; // 20 minutes of virtual time.
+static constexpr uint32_t kRouteDuration  = 5 * 60 * 1000;  // 5 minutes of virtual time.
+static constexpr uint32_t kNumLookups     = 1000000;
+
+static uint64_t GetWallTimeNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL + static_cast<uint64_t>(now.tv_nsec);
+}
+
+static bool AreNeighbors(uint16_t aId1, uint16_t aId2)
+{
+    // Nodes are placed on a grid and can only hear the adjacent nodes (including diagonals).
+
+    int dx = static_cast<int>(aId1 % kGridWidth) - static_cast<int>(aId2 % kGridWidth);
+    int dy = static_cast<int>(aId1 / kGridWidth) - static_cast<int>(aId2 / kGridWidth);
+
+    return (dx >= -1) && (dx <= 1) && (dy >= -1) && (dy <= 1);
+}
+
+static int8_t GetLinkRssi(uint16_t aId1, uint16_t aId2)
+{
+    // Use a mix of link qualities (with a noise floor of -100 dBm) so that some multi-hop routes are cheaper than
+    // the direct links.
+
+    static const int8_t kRssis[] = {Core::kDefaultRssi, -70, -90};
+
+    return kRssis[(aId1 * 7 + aId2 * 3) % OT_ARRAY_LENGTH(kRssis)];
+}
+
+static uint16_t ReferenceGetNextHop(Instance &aInstance, uint16_t aDestination)
+{
+    // The next hop computation of a router used before the forwarding information base, with two router table
+    // searches per lookup and two more per link cost.
+
+    Mle::MleRouter &mle           = aInstance.Get<Mle::MleRouter>();
+    RouterTable &   routerTable   = aInstance.Get<RouterTable>();
+    uint8_t         destinationId = Mle::Mle::RouterIdFromRloc16(aDestination);
+    uint16_t        rval          = Mac::kShortAddrInvalid;
+    const Router *  router;
+    const Router *  nextHop;
+    uint8_t         linkCost;
+    uint8_t         routeCost;
+
+    if (destinationId == Mle::Mle::RouterIdFromRloc16(mle.GetRloc16()))
+    {
+        ExitNow(rval = aDestination);
+    }
+
+    router = routerTable.GetRouter(destinationId);
+    VerifyOrExit(router != nullptr);
+
+    linkCost  = mle.GetLinkCost(destinationId);
+    routeCost = mle.GetRouteCost(aDestination);
+
+    if ((routeCost + mle.GetLinkCost(router->GetNextHop())) < linkCost)
+    {
+        nextHop = routerTable.GetRouter(router->GetNextHop());
+        VerifyOrExit(nextHop != nullptr && !nextHop->IsStateInvalid());
+
+        rval = Mle::Mle::Rloc16FromRouterId(router->GetNextHop());
+    }
+    else if (linkCost < Mle::kMaxRouteCost)
+    {
+        rval = Mle::Mle::Rloc16FromRouterId(destinationId);
+    }
+
+exit:
+    return rval;
+}
+
+static uint8_t ReferenceGetCost(Instance &aInstance, uint16_t aRloc16)
+{
+    Mle::MleRouter &mle         = aInstance.Get<Mle::MleRouter>();
+    RouterTable &   routerTable = aInstance.Get<RouterTable>();
+    uint8_t         routerId    = Mle::Mle::RouterIdFromRloc16(aRloc16);
+    uint8_t         cost        = mle.GetLinkCost(routerId);
+    const Router *  router      = routerTable.GetRouter(routerId);
+    uint8_t         routeCost;
+
+    VerifyOrExit(router != nullptr && routerTable.GetRouter(router->GetNextHop()) != nullptr);
+
+    routeCost = mle.GetRouteCost(aRloc16) + mle.GetLinkCost(router->GetNextHop());
+
+    if (cost > routeCost)
+    {
+        cost = routeCost;
+    }
+
+exit:
+    return cost;
+}
+
+static uint16_t VerifyFib(Node *const *aNodes)
+{
+    // Checks that the FIB of every node matches the reference computation. Returns the number of reachable
+    // (node, router) pairs.
+
+    uint16_t numReachable = 0;
+
+    for (uint16_t i = 0; i < kNumNodes; i++)
+    {
+        Instance &      instance = aNodes[i]->GetInstance();
+        Mle::MleRouter &mle      = instance.Get<Mle::MleRouter>();
+
+        VerifyOrQuit(mle.IsRouterOrLeader(), "node is not a router");
+
+        for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
+        {
+            uint16_t rloc16  = Mle::Mle::Rloc16FromRouterId(routerId);
+            uint16_t nextHop = mle.GetNextHop(rloc16);
+
+            VerifyOrQuit(nextHop == ReferenceGetNextHop(instance, rloc16), "GetNextHop() does not match reference");
+            VerifyOrQuit(mle.GetCost(rloc16) == ReferenceGetCost(instance, rloc16), "GetCost() mismatch");
+
+            if (nextHop != Mac::kShortAddrInvalid)
+            {
+                numReachable++;
+            }
+        }
+    }
+
+    return numReachable;
+}
+
+static uint16_t CountRouters(Node *const *aNodes)
+{
+    uint16_t numRouters = 0;
+
+    for (uint16_t i = 0; i < kNumNodes; i++)
+    {
+        switch (otThreadGetDeviceRole(&aNodes[i]->GetInstance()))
+        {
+        case OT_DEVICE_ROLE_LEADER:
+        case OT_DEVICE_ROLE_ROUTER:
+            numRouters++;
+            break;
+        default:
+            break;
+        }
+    }
+
+    return numRouters;
+}
+
+void TestRouterFib(void)
+{
+    Core &                     core = Core::Get();
+    Node *                     nodes[kNumNodes];
+    otLinkModeConfig           mode;
+    const otRouterFibCounters *counters;
+    uint16_t                   numRouters;
+    uint16_t                   numReachable;
+    uint16_t                   rloc16s[Mle::kMaxRouters];
+    uint16_t                   numRloc16s = 0;
+    uint32_t                   rebuilds;
+    uint64_t                   start;
+    uint64_t                   fibTime;
+    uint64_t                   referenceTime;
+    uint32_t                   checksum = 0;
+
+    printf("TestRouterFib: %u nodes on a %ux%u grid\n", kNumNodes, kGridWidth, kGridHeight);
+
+    core.SetLogEnabled(false);
+
+    for (Node *&node : nodes)
+    {
+        node = core.CreateNode();
+        VerifyOrQuit(node != nullptr, "CreateNode() failed");
+
+        otThreadSetRouterUpgradeThreshold(&node->GetInstance(), kNumNodes);
+        otThreadSetRouterDowngradeThreshold(&node->GetInstance(), kNumNodes);
+    }
+
+    core.DisconnectAllLinks();
+
+    for (uint16_t i = 0; i < kNumNodes; i++)
+    {
+        for (uint16_t j = i + 1; j < kNumNodes; j++)
+        {
+            if (AreNeighbors(i, j))
+            {
+                core.SetLinks(*nodes[i], *nodes[j], {GetLinkRssi(i, j), 0, 0});
+            }
+        }
+    }
+
+    SuccessOrQuit(nodes[0]->Form(), "Form() failed");
+    core.AdvanceTime(10 * 1000);
+    VerifyOrQuit(otThreadGetDeviceRole(&nodes[0]->GetInstance()) == OT_DEVICE_ROLE_LEADER, "leader not elected");
+
+    mode.mRxOnWhenIdle = true;
+    mode.mDeviceType   = true;
+    mode.mNetworkData  = true;
+
+    for (uint16_t i = 1; i < kNumNodes; i++)
+    {
+        SuccessOrQuit(nodes[i]->Join(*nodes[0], mode), "Join() failed");
+    }
+
+    core.AdvanceTime(kAttachDuration);
+
+    numRouters = CountRouters(nodes);
+    printf("  routers: %u\n", numRouters);
+    VerifyOrQuit(numRouters == kNumNodes, "not all nodes became routers");
+
+    // Check the FIB against the reference on the converged network.
+
+    numReachable = VerifyFib(nodes);
+    printf("  reachable (node, router) pairs: %u\n", numReachable);
+    VerifyOrQuit(numReachable >= kNumNodes * (kNumNodes - 1), "routes did not converge");
+
+    // Cut the grid between its two halves except for one column, so many routes now take a detour, and check the
+    // FIB again once the routes are updated.
+
+    for (uint16_t i = 0; i < kNumNodes; i++)
+    {
+        for (uint16_t j = i + 1; j < kNumNodes; j++)
+        {
+            bool crossesCut = ((i / kGridWidth) < kGridHeight / 2) != ((j / kGridWidth) < kGridHeight / 2);
+
+            if (AreNeighbors(i, j) && crossesCut && (i % kGridWidth) != 0 && (j % kGridWidth) != 0)
+            {
+                core.SetLinks(*nodes[i], *nodes[j], {Link::kRssiNone, 0, 0});
+            }
+        }
+    }
+
+    core.AdvanceTime(kRouteDuration);
+
+    numReachable = VerifyFib(nodes);
+    printf("  reachable (node, router) pairs after cut: %u\n", numReachable);
+
+    // Benchmark lookups on the last node (the corner farthest from the leader).
+
+    Instance &      instance = nodes[kNumNodes - 1]->GetInstance();
+    Mle::MleRouter &mle      = instance.Get<Mle::MleRouter>();
+
+    for (Router &router : instance.Get<RouterTable>().Iterate())
+    {
+        if (router.GetRloc16() != mle.GetRloc16())
+        {
+            rloc16s[numRloc16s++] = router.GetRloc16();
+        }
+    }
+
+    otThreadResetRouterFibCounters(&instance);
+    counters = otThreadGetRouterFibCounters(&instance);
+
+    start = GetWallTimeNs();
+
+    for (uint32_t i = 0; i < kNumLookups; i++)
+    {
+        checksum += mle.GetNextHop(rloc16s[i % numRloc16s]);
+    }
+
+    fibTime = GetWallTimeNs() - start;
+
+    rebuilds = counters->mRebuilds;
+    printf("  fib lookups: %lu, rebuilds: %lu\n", static_cast<unsigned long>(counters->mLookups),
+           static_cast<unsigned long>(rebuilds));
+    VerifyOrQuit(counters->mLookups == kNumLookups, "lookups were not counted");
+    VerifyOrQuit(rebuilds <= 1, "FIB was rebuilt on lookups");
+
+    start = GetWallTimeNs();
+
+    for (uint32_t i = 0; i < kNumLookups; i++)
+    {
+        checksum -= ReferenceGetNextHop(instance, rloc16s[i % numRloc16s]);
+    }
+
+    referenceTime = GetWallTimeNs() - start;
+
+    VerifyOrQuit(checksum == 0, "GetNextHop() does not match the reference");
+
+    printf("  next hop lookup over %u routers: fib %lu ns, per-lookup computation %lu ns\n", numRloc16s,
+           static_cast<unsigned long>(fibTime / kNumLookups), static_cast<unsigned long>(referenceTime / kNumLookups));
+
+    // A route update invalidates the FIB and the next lookup rebuilds it once.
+
+    core.AdvanceTime(kRouteDuration);
+    otThreadResetRouterFibCounters(&instance);
+    checksum += mle.GetNextHop(rloc16s[0]);
+    checksum += mle.GetNextHop(rloc16s[1]);
+    VerifyOrQuit(counters->mRebuilds <= 1, "FIB was rebuilt more than once");
+
+    VerifyFib(nodes);
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestRouterFib();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,306 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread/dns_client.h>
+#include <openthread/srp_client.h>
+#include <openthread/srp_server.h>
+#include <openthread/thread.h>
+
+#include "common/code_utils.hpp"
+
+#include "test_util.h"
+#include "platform/nexus_core.hpp"
+#include "platform/nexus_node.hpp"
+
+namespace ot {
+namespace Nexus {
+
+static constexpr uint32_t kLease            = 120; // SRP lease (in seconds).
+static constexpr uint16_t kDnssdPort        = 53;
+static constexpr uint8_t  kNumHosts         = 4;
+static constexpr uint8_t  kNumServices      = 2;         // Number of `kServiceName` instances per host.
+static constexpr uint32_t kResponseWaitStep = 100;       // In milliseconds.
+static constexpr uint32_t kMaxResponseWait  = 20 * 1000; // In milliseconds.
+static const char         kServiceName[]    = "_idx._udp.default.service.arpa.";
+static const char         kOtherName[]      = "_other._udp.default.service.arpa.";
+
+struct HostInfo
+{
+    char               mLabel[16];
+    char               mFullName[48];
+    char               mInstanceLabels[kNumServices][16];
+    otIp6Address       mAddress;
+    otSrpClientService mServices[kNumServices];
+    otSrpClientService mOtherService;
+    bool               mRemoved[kNumServices];
+};
+
+struct QueryResult
+{
+    bool     mDone;
+    otError  mError;
+    uint16_t mNumInstances;
+    uint8_t  mNumAddresses[kNumHosts]; // Number of AAAA records of each host in the additional section.
+};
+
+static HostInfo    sHosts[kNumHosts];
+static QueryResult sResult;
+
+static void CountHostAddresses(const void *aResponse, bool aIsBrowse)
+{
+    for (uint8_t i = 0; i < kNumHosts; i++)
+    {
+        otIp6Address address;
+        otError      error;
+
+        for (uint16_t index = 0;; index++)
+        {
+            if (aIsBrowse)
+            {
+                error = otDnsBrowseResponseGetHostAddress(static_cast<const otDnsBrowseResponse *>(aResponse),
+                                                          sHosts[i].mFullName, index, &address, nullptr);
+            }
+            else
+            {
+                error = otDnsServiceResponseGetHostAddress(static_cast<const otDnsServiceResponse *>(aResponse),
+                                                           sHosts[i].mFullName, index, &address, nullptr);
+            }
+
+            if (error == OT_ERROR_NOT_FOUND)
+            {
+                break;
+            }
+
+            SuccessOrQuit(error, "GetHostAddress() failed");
+            VerifyOrQuit(memcmp(&address, &sHosts[i].mAddress, sizeof(address)) == 0, "wrong host address");
+            sResult.mNumAddresses[i]++;
+        }
+    }
+}
+
+static void HandleBrowseResponse(otError aError, const otDnsBrowseResponse *aResponse, void *aContext)
+{
+    OT_UNUSED_VARIABLE(aContext);
+
+    char label[OT_DNS_MAX_LABEL_SIZE];
+
+    sResult.mDone  = true;
+    sResult.mError = aError;
+    VerifyOrExit(aError == OT_ERROR_NONE);
+
+    while (otDnsBrowseResponseGetServiceInstance(aResponse, sResult.mNumInstances, label, sizeof(label)) ==
+           OT_ERROR_NONE)
+    {
+        sResult.mNumInstances++;
+    }
+
+    CountHostAddresses(aResponse, /* aIsBrowse */ true);
+
+exit:
+    return;
+}
+
+static void HandleServiceResponse(otError aError, const otDnsServiceResponse *aResponse, void *aContext)
+{
+    OT_UNUSED_VARIABLE(aContext);
+
+    sResult.mDone  = true;
+    sResult.mError = aError;
+    VerifyOrExit(aError == OT_ERROR_NONE);
+
+    sResult.mNumInstances = 1;
+    CountHostAddresses(aResponse, /* aIsBrowse */ false);
+
+exit:
+    return;
+}
+
+static void WaitForResponse(void)
+{
+    for (uint32_t duration = 0; !sResult.mDone && (duration < kMaxResponseWait); duration += kResponseWaitStep)
+    {
+        Core::Get().AdvanceTime(kResponseWaitStep);
+    }
+
+    VerifyOrQuit(sResult.mDone, "no response");
+    VerifyOrQuit(sResult.mError == OT_ERROR_NONE, "query failed");
+}
+
+static void Browse(Node &aClient, const char *aServiceName)
+{
+    memset(&sResult, 0, sizeof(sResult));
+    otDnsClientClearCache(&aClient.GetInstance());
+    SuccessOrQuit(otDnsClientBrowse(&aClient.GetInstance(), aServiceName, HandleBrowseResponse, nullptr, nullptr),
+                  "Browse() failed");
+    WaitForResponse();
+}
+
+static void VerifyBrowse(Node &aClient)
+{
+    uint16_t numInstances = 0;
+
+    Browse(aClient, kServiceName);
+
+    for (uint8_t i = 0; i < kNumHosts; i++)
+    {
+        for (uint8_t j = 0; j < kNumServices; j++)
+        {
+            numInstances += sHosts[i].mRemoved[j] ? 0 : 1;
+        }
+
+        // The host addresses are appended once, for the first of its
+        // services answering the query (which may be any of them).
+        VerifyOrQuit(sResult.mNumAddresses[i] == 1, "host addresses missing or appended more than once");
+    }
+
+    VerifyOrQuit(sResult.mNumInstances == numInstances, "wrong number of browsed instances");
+}
+
+void TestSrpServerIndex(void)
+{
+    Core &           core   = Core::Get();
+    Node &           leader = *core.CreateNode();
+    Node &           client = *core.CreateNode();
+    Node *           hosts[kNumHosts];
+    otLinkModeConfig mode;
+    otDnsQueryConfig config;
+
+    printf("TestSrpServerIndex\n");
+
+    SuccessOrQuit(leader.Form(), "Form() failed");
+    core.AdvanceTime(10 * 1000);
+    VerifyOrQuit(otThreadGetDeviceRole(&leader.GetInstance()) == OT_DEVICE_ROLE_LEADER, "leader not elected");
+
+    SuccessOrQuit(otSrpServerSetLeaseRange(&leader.GetInstance(), kLease, kLease, kLease, kLease),
+                  "SetLeaseRange() failed");
+    otSrpServerSetEnabled(&leader.GetInstance(), true);
+
+    mode.mRxOnWhenIdle = true;
+    mode.mDeviceType   = true;
+    mode.mNetworkData  = true;
+
+    SuccessOrQuit(client.Join(leader, mode), "Join() failed");
+
+    for (Node *&host : hosts)
+    {
+        host = core.CreateNode();
+        SuccessOrQuit(host->Join(leader, mode), "Join() failed");
+    }
+
+    core.AdvanceTime(300 * 1000);
+
+    // Each host registers `kNumServices` instances of `kServiceName`
+    // and one instance of another service.
+
+    for (uint8_t i = 0; i < kNumHosts; i++)
+    {
+        otInstance *instance = &hosts[i]->GetInstance();
+        HostInfo &  info     = sHosts[i];
+
+        VerifyOrQuit(otThreadGetDeviceRole(instance) == OT_DEVICE_ROLE_ROUTER, "host did not attach");
+
+        memset(&info, 0, sizeof(info));
+        snprintf(info.mLabel, sizeof(info.mLabel), "idxhost%u", i);
+        snprintf(info.mFullName, sizeof(info.mFullName), "%s.default.service.arpa.", info.mLabel);
+        info.mAddress = *otThreadGetMeshLocalEid(instance);
+
+        otSrpClientSetLeaseInterval(instance, kLease);
+        SuccessOrQuit(otSrpClientSetHostName(instance, info.mLabel), "SetHostName() failed");
+        SuccessOrQuit(otSrpClientSetHostAddresses(instance, &info.mAddress, 1), "SetHostAddresses() failed");
+
+        for (uint8_t j = 0; j < kNumServices; j++)
+        {
+            snprintf(info.mInstanceLabels[j], sizeof(info.mInstanceLabels[j]), "h%us%u", i, j);
+            info.mServices[j].mName         = "_idx._udp";
+            info.mServices[j].mInstanceName = info.mInstanceLabels[j];
+            info.mServices[j].mPort         = static_cast<uint16_t>(1000 + j);
+            SuccessOrQuit(otSrpClientAddService(instance, &info.mServices[j]), "AddService() failed");
+        }
+
+        info.mOtherService.mName         = "_other._udp";
+        info.mOtherService.mInstanceName = info.mLabel;
+        info.mOtherService.mPort         = 2000;
+        SuccessOrQuit(otSrpClientAddService(instance, &info.mOtherService), "AddService() failed");
+
+        otSrpClientEnableAutoStartMode(instance, nullptr, nullptr);
+    }
+
+    core.AdvanceTime(10 * 1000);
+
+    memset(&config, 0, sizeof(config));
+    config.mServerSockAddr.mAddress = *otThreadGetMeshLocalEid(&leader.GetInstance());
+    config.mServerSockAddr.mPort    = kDnssdPort;
+    config.mNat64Mode               = OT_DNS_NAT64_DISALLOW;
+    otDnsClientSetDefaultConfig(&client.GetInstance(), &config);
+
+    // A browse returns the instances of the queried service only, and
+    // the addresses of each host exactly once.
+
+    VerifyBrowse(client);
+
+    Browse(client, kOtherName);
+    VerifyOrQuit(sResult.mNumInstances == kNumHosts, "wrong number of browsed instances");
+
+    // A SRV query returns the addresses of the host of the instance.
+
+    memset(&sResult, 0, sizeof(sResult));
+    SuccessOrQuit(otDnsClientResolveService(&client.GetInstance(), sHosts[1].mInstanceLabels[1], kServiceName,
+                                            HandleServiceResponse, nullptr, nullptr),
+                  "ResolveService() failed");
+    WaitForResponse();
+    VerifyOrQuit(sResult.mNumAddresses[1] == 1, "SRV query did not return the host addresses once");
+
+    // Removed services retain their names on the server. The host
+    // addresses are still appended (once) for the remaining services,
+    // whichever position the removed service has in the host's list.
+
+    for (uint8_t i = 0; i < kNumServices; i++)
+    {
+        SuccessOrQuit(otSrpClientRemoveService(&hosts[i]->GetInstance(), &sHosts[i].mServices[i]),
+                      "RemoveService() failed");
+        sHosts[i].mRemoved[i] = true;
+    }
+
+    core.AdvanceTime(10 * 1000);
+
+    VerifyBrowse(client);
+}
+
+} // namespace Nexus
+} // namespace ot
+
+int main(void)
+{
+    ot::Nexus::TestSrpServerIndex();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2021, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+"""Stress test for concurrent ot-daemon sessions.
+
+Requires a running ot-daemon and ot-ctl in PATH. The test verifies that
+  * pipelined commands from many concurrent sessions are answered in order and only to the issuing session,
+  * concurrent ot-ctl invocations complete with bounded latency,
+  * a subscribed session is read-only and streams state changes,
+  * sessions beyond the configured maximum are rejected.
+"""
+
+import argparse
+import random
+import socket
+import statistics
+import subprocess
+import sys
+import threading
+import time
+
+COMMANDS = ['extaddr', 'extpanid', 'panid', 'channel', 'networkname', 'version', 'mode', 'unknowncmd']
+
+
+class Session(object):
+
+    def __init__(self, path, timeout=10):
+        self._sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        self._sock.settimeout(timeout)
+        self._sock.connect(path)
+        self._buffer = b''
+
+    def close(self):
+        self._sock.close()
+
+    def send(self, lines):
+        self._sock.sendall(''.join(line + '\n' for line in lines).encode())
+
+    def read_line(self):
+        while b'\n' not in self._buffer:
+            data = self._sock.recv(4096)
+            if not data:
+                raise EOFError('session closed by daemon')
+            self._buffer += data
+
+        line, self._buffer = self._buffer.split(b'\n', 1)
+        line = line.decode().rstrip('\r')
+
+        while line.startswith('> '):
+            line = line[2:]
+
+        return line
+
+    def read_response(self):
+        lines = []
+
+        while True:
+            line = self.read_line()
+            lines.append(line)
+            if line == 'Done' or line.startswith('Error '):
+                return lines
+
+
+def run_ot_ctl(*args):
+    return subprocess.run(['ot-ctl'] + list(args), stdout=subprocess.PIPE, check=True,
+                          timeout=10).stdout.decode().split()
+
+
+def check_pipelined(path, expected, clients, rounds):
+    errors = []
+
+    def worker(index):
+        rng = random.Random(index)
+        commands = [rng.choice(COMMANDS) for _ in range(rounds)]
+        session = Session(path)
+
+        try:
+            # Send all commands at once so that the daemon has to frame several lines per read.
+            session.send(commands)
+            for i, command in enumerate(commands):
+                response = session.read_response()
+                if response != expected[command]:
+                    errors.append('client %d command %d `%s`: got %r, expected %r' %
+                                  (index, i, command, response, expected[command]))
+                    return
+        except Exception as e:
+            errors.append('client %d: %s' % (index, e))
+        finally:
+            session.close()
+
+    threads = [threading.Thread(target=worker, args=(i,)) for i in range(clients)]
+
+    for thread in threads:
+        thread.start()
+
+    for thread in threads:
+        thread.join()
+
+    for error in errors:
+        print(error)
+
+    assert not errors, 'pipelined sessions failed'
+    print('pipelined: %d clients x %d commands OK' % (clients, rounds))
+
+
+def check_latency(expected, clients, rounds, max_latency):
+    latencies = []
+    errors = []
+    lock = threading.Lock()
+
+    def worker(index):
+        rng = random.Random(index)
+
+        for _ in range(rounds):
+            command = rng.choice(COMMANDS[:-1])
+            begin = time.time()
+            output = run_ot_ctl(command)
+            elapsed = time.time() - begin
+
+            with lock:
+                latencies.append(elapsed)
+                if output != [token for line in expected[command] for token in line.split()]:
+                    errors.append('ot-ctl %s: got %r' % (command, output))
+
+    threads = [threading.Thread(target=worker, args=(i,)) for i in range(clients)]
+
+    for thread in threads:
+        thread.start()
+
+    for thread in threads:
+        thread.join()
+
+    for error in errors:
+        print(error)
+
+    latencies.sort()
+    print('ot-ctl latency: count %d, median %.1f ms, p99 %.1f ms, max %.1f ms' %
+          (len(latencies), statistics.median(latencies) * 1000, latencies[int(len(latencies) * 0.99)] * 1000,
+           latencies[-1] * 1000))
+
+    assert not errors, 'concurrent ot-ctl failed'
+    assert latencies[-1] < max_latency, 'ot-ctl latency too high'
+
+
+def check_subscribe(path):
+    subscriber = Session(path)
+    subscriber.send(['subscribe'])
+    line = subscriber.read_line()
+    assert line.startswith('Subscribed: role '), line
+
+    # Subscribed sessions are read-only.
+    subscriber.send(['extaddr'])
+    line = subscriber.read_line()
+    assert line == 'Error 13: InvalidState', line
+
+    # Adding and removing an address changes state, while output of other sessions is not mirrored.
+    commander = Session(path)
+    commander.send(['ipaddr add fd00:dead:beef::1', 'ipaddr del fd00:dead:beef::1'])
+    assert commander.read_response() == ['Done']
+    assert commander.read_response() == ['Done']
+    commander.close()
+
+    line = subscriber.read_line()
+    assert line.startswith('State changed: flags 0x'), line
+    subscriber.close()
+    print('subscribe OK')
+
+
+def check_max_sessions(path, max_sessions):
+    sessions = [Session(path) for _ in range(max_sessions)]
+
+    # Ensure all sessions are accepted before connecting one more.
+    for session in sessions:
+        session.send(['panid'])
+        session.read_response()
+
+    extra = Session(path)
+    line = extra.read_line()
+    assert line == 'Error 5: Busy', line
+    extra.close()
+
+    for session in sessions:
+        session.close()
+
+    print('max sessions OK')
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--socket', default='/tmp/openthread.sock')
+    parser.add_argument('--clients', type=int, default=8)
+    parser.add_argument('--rounds', type=int, default=200)
+    parser.add_argument('--max-sessions', type=int, default=8)
+    parser.add_argument('--max-latency', type=float, default=1.0)
+    args = parser.parse_args()
+
+    session = Session(args.socket)
+    expected = {}
+    for command in COMMANDS:
+        session.send([command])
+        expected[command] = session.read_response()
+    session.close()
+
+    check_pipelined(args.socket, expected, min(args.clients, args.max_sessions), args.rounds)
+    # Leave room for sessions of finished ot-ctl processes which the daemon has not yet noticed are closed.
+    check_latency(expected, min(args.clients, max(1, args.max_sessions // 2)), args.rounds // 10, args.max_latency)
+    check_subscribe(args.socket)
+    check_max_sessions(args.socket, args.max_sessions)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -26,9 +26,15 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
+
 #include <openthread/config.h>
 
+#include <mbedtls/aes.h>
+#include <mbedtls/ccm.h>
+
 #include "common/debug.hpp"
+#include "common/random.hpp"
 #include "crypto/aes_ccm.hpp"
 
 #include "test_platform.h"
@@ -137,10 +143,331 @@ void TestMacCommandFrame()
     VerifyOrQuit(memcmp(test, decrypted, sizeof(decrypted)) == 0, "TestMacCommandFrame decrypt failed");
 }
 
+namespace ot {
+namespace Crypto {
+
+class AesEcbTester
+{
+public:
+    static bool IsHardwareAccelerationSupported(void) { return AesEcb::DetectBackend() != AesEcb::kBackendMbedTls; }
+
+    static void SetHardwareAccelerationEnabled(bool aEnabled)
+    {
+        AesEcb::sBackend = aEnabled ? AesEcb::DetectBackend() : AesEcb::kBackendMbedTls;
+    }
+
+    static mbedtls_aes_context *GetKeySchedule(AesKeyScheduleCache &aCache, const uint8_t *aKey, uint16_t aKeyLength)
+    {
+        return aCache.Get(aKey, aKeyLength);
+    }
+
+    static bool IsKeyCached(const AesKeyScheduleCache &aCache, const uint8_t *aKey)
+    {
+        bool cached = false;
+
+#if OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE > 0
+        for (uint8_t position = 0; position < aCache.mLength; position++)
+        {
+            const uint8_t *key = aCache.mEntries[aCache.mOrder[position]].mKey;
+
+            cached = cached || (memcmp(key, aKey, AesKeyScheduleCache::kKeySize) == 0);
+        }
+#else
+        OT_UNUSED_VARIABLE(aCache);
+        OT_UNUSED_VARIABLE(aKey);
+#endif
+
+        return cached;
+    }
+
+    static bool IsKeyScheduleCacheWiped(const AesKeyScheduleCache &aCache)
+    {
+        bool wiped = true;
+
+#if OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE > 0
+        wiped = (aCache.mLength == 0);
+
+        for (const AesKeyScheduleCache::Entry &entry : aCache.mEntries)
+        {
+            for (uint8_t byte : entry.mKey)
+            {
+                wiped = wiped && (byte == 0);
+            }
+        }
+#else
+        OT_UNUSED_VARIABLE(aCache);
+#endif
+
+        return wiped;
+    }
+
+    static const char *BackendName(void) { return AesEcb::IsHardwareAccelerated() ? "hardware" : "mbedtls"; }
+};
+
+} // namespace Crypto
+} // namespace ot
+
+using ot::Crypto::AesEcbTester;
+
+static const bool kBackends[] = {false, true};
+
+/**
+ * Cross-checks `AesEcb` (single and paired block encryption) against mbedtls for both backends, with keys cycling
+ * through more keys than the key schedule cache can hold.
+ */
+void TestAesEcbBackends(void)
+{
+    const uint16_t kNumKeys       = 6;
+    const uint16_t kNumIterations = 200;
+
+    otInstance *instance = testInitInstance();
+    uint8_t     keys[kNumKeys][16];
+
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    ot::Random::NonCrypto::FillBuffer(&keys[0][0], sizeof(keys));
+
+    printf("AES hardware acceleration %ssupported\n", AesEcbTester::IsHardwareAccelerationSupported() ? "" : "not ");
+
+    for (bool hardware : kBackends)
+    {
+        ot::Crypto::AesKeyScheduleCache cache;
+
+        AesEcbTester::SetHardwareAccelerationEnabled(hardware);
+
+        for (uint16_t iter = 0; iter < kNumIterations; iter++)
+        {
+            const uint8_t *     key = keys[(iter * 7) % kNumKeys];
+            ot::Crypto::AesEcb  aesEcb;
+            mbedtls_aes_context context;
+            uint8_t             input[2][ot::Crypto::AesEcb::kBlockSize];
+            uint8_t             expected[2][ot::Crypto::AesEcb::kBlockSize];
+            uint8_t             output[2][ot::Crypto::AesEcb::kBlockSize];
+
+            ot::Random::NonCrypto::FillBuffer(&input[0][0], sizeof(input));
+
+            mbedtls_aes_init(&context);
+            mbedtls_aes_setkey_enc(&context, key, 128);
+            mbedtls_aes_crypt_ecb(&context, MBEDTLS_AES_ENCRYPT, input[0], expected[0]);
+            mbedtls_aes_crypt_ecb(&context, MBEDTLS_AES_ENCRYPT, input[1], expected[1]);
+            mbedtls_aes_free(&context);
+
+            // Every other iteration uses the key schedule cache
+            aesEcb.SetKey(key, 128, (iter % 2 == 0) ? &cache : nullptr);
+
+            aesEcb.Encrypt(input[0], output[0]);
+            VerifyOrQuit(memcmp(output[0], expected[0], sizeof(output[0])) == 0, "AesEcb::Encrypt() failed");
+
+            memset(output, 0, sizeof(output));
+            aesEcb.Encrypt(input[0], output[0], input[1], output[1]);
+            VerifyOrQuit(memcmp(output, expected, sizeof(output)) == 0, "AesEcb::Encrypt() (two blocks) failed");
+
+            // In-place encryption
+            aesEcb.Encrypt(input[0], input[0], input[1], input[1]);
+            VerifyOrQuit(memcmp(input, expected, sizeof(input)) == 0, "AesEcb::Encrypt() (in-place) failed");
+        }
+
+        printf("TestAesEcbBackends() passed with %s backend\n", AesEcbTester::BackendName());
+    }
+
+    AesEcbTester::SetHardwareAccelerationEnabled(true);
+    testFreeInstance(instance);
+}
+
+/**
+ * Checks the least recently used replacement and the wiping of `AesKeyScheduleCache`.
+ */
+void TestAesKeyScheduleCache(void)
+{
+    const uint8_t kCacheSize = OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE;
+
+    otInstance *                    instance = testInitInstance();
+    ot::Crypto::AesKeyScheduleCache cache;
+    uint8_t                         keys[kCacheSize + 1][16];
+    uint8_t                         otherKey[32];
+
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    ot::Random::NonCrypto::FillBuffer(&keys[0][0], sizeof(keys));
+    ot::Random::NonCrypto::FillBuffer(otherKey, sizeof(otherKey));
+
+    VerifyOrQuit(AesEcbTester::IsKeyScheduleCacheWiped(cache), "AesKeyScheduleCache is not empty");
+
+    // Only AES-128 keys are cached
+    VerifyOrQuit(AesEcbTester::GetKeySchedule(cache, otherKey, 256) == nullptr, "AES-256 key schedule was cached");
+
+    for (uint8_t i = 0; i < kCacheSize; i++)
+    {
+        VerifyOrQuit(AesEcbTester::GetKeySchedule(cache, keys[i], 128) != nullptr, "AesKeyScheduleCache::Get() failed");
+    }
+
+    for (uint8_t i = 0; i < kCacheSize; i++)
+    {
+        VerifyOrQuit(AesEcbTester::IsKeyCached(cache, keys[i]), "Key is missing from AesKeyScheduleCache");
+    }
+
+    if (kCacheSize > 1)
+    {
+        // Use `keys[0]` again, so `keys[1]` is the least recently used key and is replaced by `keys[kCacheSize]`.
+        IgnoreReturnValue(AesEcbTester::GetKeySchedule(cache, keys[0], 128));
+        IgnoreReturnValue(AesEcbTester::GetKeySchedule(cache, keys[kCacheSize], 128));
+
+        VerifyOrQuit(AesEcbTester::IsKeyCached(cache, keys[0]), "Most recently used key was replaced");
+        VerifyOrQuit(!AesEcbTester::IsKeyCached(cache, keys[1]), "Least recently used key was not replaced");
+        VerifyOrQuit(AesEcbTester::IsKeyCached(cache, keys[kCacheSize]), "New key is missing");
+    }
+
+    cache.Clear();
+    VerifyOrQuit(AesEcbTester::IsKeyScheduleCacheWiped(cache), "AesKeyScheduleCache::Clear() failed");
+
+    printf("TestAesKeyScheduleCache() passed with %u entries\n", kCacheSize);
+
+    testFreeInstance(instance);
+}
+
+/**
+ * Cross-checks `AesCcm` against mbedtls CCM for both backends, with header and payload of random lengths passed in
+ * random sized chunks.
+ */
+void TestAesCcmBackends(void)
+{
+    const uint16_t kNumIterations = 500;
+    const uint16_t kMaxLength     = 200;
+
+    otInstance *instance = testInitInstance();
+
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    for (bool hardware : kBackends)
+    {
+        AesEcbTester::SetHardwareAccelerationEnabled(hardware);
+
+        for (uint16_t iter = 0; iter < kNumIterations; iter++)
+        {
+            mbedtls_ccm_context context;
+            ot::Crypto::AesCcm  aesCcm;
+            uint8_t             key[16];
+            uint8_t             nonce[ot::Crypto::AesCcm::kNonceSize];
+            uint8_t             header[kMaxLength];
+            uint8_t             plainText[kMaxLength];
+            uint8_t             cipherText[kMaxLength];
+            uint8_t             expected[kMaxLength];
+            uint8_t             tag[ot::Crypto::AesCcm::kMaxTagLength];
+            uint8_t             expectedTag[ot::Crypto::AesCcm::kMaxTagLength];
+            uint16_t            headerLength  = ot::Random::NonCrypto::GetUint16InRange(0, kMaxLength);
+            uint16_t            payloadLength = ot::Random::NonCrypto::GetUint16InRange(0, kMaxLength);
+            uint8_t             tagLength     = 4 + 2 * ot::Random::NonCrypto::GetUint8InRange(0, 7);
+            uint16_t            offset;
+
+            ot::Random::NonCrypto::FillBuffer(key, sizeof(key));
+            ot::Random::NonCrypto::FillBuffer(nonce, sizeof(nonce));
+            ot::Random::NonCrypto::FillBuffer(header, sizeof(header));
+            ot::Random::NonCrypto::FillBuffer(plainText, sizeof(plainText));
+
+            mbedtls_ccm_init(&context);
+            mbedtls_ccm_setkey(&context, MBEDTLS_CIPHER_ID_AES, key, 128);
+            VerifyOrQuit(mbedtls_ccm_encrypt_and_tag(&context, payloadLength, nonce, sizeof(nonce), header,
+                                                     headerLength, plainText, expected, expectedTag, tagLength) == 0,
+                         "mbedtls_ccm_encrypt_and_tag() failed");
+            mbedtls_ccm_free(&context);
+
+            aesCcm.SetKey(key, sizeof(key));
+            aesCcm.Init(headerLength, payloadLength, tagLength, nonce, sizeof(nonce));
+
+            for (offset = 0; offset < headerLength;)
+            {
+                uint16_t length = ot::Random::NonCrypto::GetUint16InRange(1, headerLength - offset + 1);
+
+                aesCcm.Header(header + offset, length);
+                offset += length;
+            }
+
+            memcpy(cipherText, plainText, payloadLength);
+
+            for (offset = 0; offset < payloadLength;)
+            {
+                uint16_t length = ot::Random::NonCrypto::GetUint16InRange(1, payloadLength - offset + 1);
+
+                aesCcm.Payload(cipherText + offset, cipherText + offset, length, ot::Crypto::AesCcm::kEncrypt);
+                offset += length;
+            }
+
+            aesCcm.Finalize(tag);
+
+            VerifyOrQuit(memcmp(cipherText, expected, payloadLength) == 0, "AesCcm encrypt failed");
+            VerifyOrQuit(memcmp(tag, expectedTag, tagLength) == 0, "AesCcm tag failed");
+
+            aesCcm.Init(headerLength, payloadLength, tagLength, nonce, sizeof(nonce));
+            aesCcm.Header(header, headerLength);
+            aesCcm.Payload(cipherText, cipherText, payloadLength, ot::Crypto::AesCcm::kDecrypt);
+            aesCcm.Finalize(tag);
+
+            VerifyOrQuit(memcmp(cipherText, plainText, payloadLength) == 0, "AesCcm decrypt failed");
+            VerifyOrQuit(memcmp(tag, expectedTag, tagLength) == 0, "AesCcm decrypt tag failed");
+        }
+
+        printf("TestAesCcmBackends() passed with %s backend\n", AesEcbTester::BackendName());
+    }
+
+    AesEcbTester::SetHardwareAccelerationEnabled(true);
+    testFreeInstance(instance);
+}
+
+/**
+ * Measures the time to secure an IEEE 802.15.4 frame (key set up, encryption and tag) with each backend.
+ */
+void TestAesCcmPerformance(void)
+{
+    const uint16_t kHeaderLength  = 23;
+    const uint16_t kPayloadLength = 92;
+    const uint8_t  kTagLength     = 4;
+    const uint32_t kNumIterations = 50000;
+
+    uint8_t key[16];
+    uint8_t nonce[ot::Crypto::AesCcm::kNonceSize];
+    uint8_t frame[kHeaderLength + kPayloadLength + kTagLength];
+
+    memset(key, 0xa5, sizeof(key));
+    memset(nonce, 0x5a, sizeof(nonce));
+    memset(frame, 0, sizeof(frame));
+
+    for (bool hardware : kBackends)
+    {
+        std::chrono::time_point<std::chrono::steady_clock> start;
+        uint32_t                                           duration;
+
+        AesEcbTester::SetHardwareAccelerationEnabled(hardware);
+        start = std::chrono::steady_clock::now();
+
+        for (uint32_t iter = 0; iter < kNumIterations; iter++)
+        {
+            ot::Crypto::AesCcm aesCcm;
+
+            aesCcm.SetKey(key, sizeof(key));
+            aesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, nonce, sizeof(nonce));
+            aesCcm.Header(frame, kHeaderLength);
+            aesCcm.Payload(frame + kHeaderLength, frame + kHeaderLength, kPayloadLength, ot::Crypto::AesCcm::kEncrypt);
+            aesCcm.Finalize(frame + kHeaderLength + kPayloadLength);
+        }
+
+        duration = static_cast<uint32_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
+        printf("TestAesCcmPerformance() %-8s backend: %7u usec (%u frames of %u bytes)\n", AesEcbTester::BackendName(),
+               duration, kNumIterations, static_cast<unsigned>(sizeof(frame)));
+    }
+
+    AesEcbTester::SetHardwareAccelerationEnabled(true);
+}
+
 int main(void)
 {
     TestMacBeaconFrame();
     TestMacCommandFrame();
+    TestAesEcbBackends();
+    TestAesKeyScheduleCache();
+    TestAesCcmBackends();
+    TestAesCcmPerformance();
     printf("All tests passed\n");
     return 0;
 }
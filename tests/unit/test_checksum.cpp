@@ -26,6 +26,8 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
+
 #include "common/encoding.hpp"
 #include "common/instance.hpp"
 #include "common/message.hpp"
@@ -296,6 +298,107 @@ public:
         VerifyOrQuit(checksum.GetValue() == CalculateChecksum(kTestVector, sizeof(kTestVector)),
                      "Checksum::AddData() failed");
     }
+
+    static void TestAddDataSplits(void)
+    {
+        // Verify that adding data in random-sized pieces (including
+        // odd lengths) matches the byte-by-byte `AddUint8()` result.
+
+        enum : uint16_t
+        {
+            kMaxLength = 1280,
+            kNumRuns   = 500,
+        };
+
+        uint8_t buffer[kMaxLength];
+
+        for (uint16_t run = 0; run < kNumRuns; run++)
+        {
+            uint16_t length = Random::NonCrypto::GetUint16InRange(1, kMaxLength + 1);
+            uint16_t offset = 0;
+            Checksum checksum;
+            Checksum byteChecksum;
+
+            Random::NonCrypto::FillBuffer(buffer, length);
+
+            while (offset < length)
+            {
+                uint16_t size = Random::NonCrypto::GetUint16InRange(0, length - offset + 1);
+
+                checksum.AddData(&buffer[offset], size);
+                offset += size;
+            }
+
+            for (uint16_t i = 0; i < length; i++)
+            {
+                byteChecksum.AddUint8(buffer[i]);
+            }
+
+            VerifyOrQuit(checksum.GetValue() == byteChecksum.GetValue(), "Checksum::AddData() failed");
+            VerifyOrQuit(checksum.GetValue() == CalculateChecksum(buffer, length), "Checksum::AddData() failed");
+        }
+
+        printf("TestAddDataSplits() passed\n");
+    }
+
+    static void TestAddDataPerformance(void)
+    {
+        // Compares the time to calculate the checksum using `AddData()`
+        // versus adding the bytes one at a time using `AddUint8()`.
+
+        const uint16_t kLengths[]     = {64, 128, 256, 512, 1024, 1280};
+        const uint32_t kNumIterations = 20000;
+
+        uint8_t buffer[1280];
+
+        Random::NonCrypto::FillBuffer(buffer, sizeof(buffer));
+
+        for (uint16_t length : kLengths)
+        {
+            std::chrono::time_point<std::chrono::steady_clock> start;
+            uint32_t                                           byteDuration;
+            uint32_t                                           wordDuration;
+            uint16_t                                           byteValue = 0;
+            uint16_t                                           wordValue = 0;
+
+            start = std::chrono::steady_clock::now();
+
+            for (uint32_t iter = 0; iter < kNumIterations; iter++)
+            {
+                Checksum checksum;
+
+                for (uint16_t i = 0; i < length; i++)
+                {
+                    checksum.AddUint8(buffer[i]);
+                }
+
+                byteValue += checksum.GetValue();
+            }
+
+            byteDuration = static_cast<uint32_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start)
+                    .count());
+
+            start = std::chrono::steady_clock::now();
+
+            for (uint32_t iter = 0; iter < kNumIterations; iter++)
+            {
+                Checksum checksum;
+
+                checksum.AddData(buffer, length);
+                wordValue += checksum.GetValue();
+            }
+
+            wordDuration = static_cast<uint32_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start)
+                    .count());
+
+            VerifyOrQuit(byteValue == wordValue, "Checksum::AddData() failed");
+
+            printf("TestAddDataPerformance() length:%-4u byte-by-byte:%7u usec, AddData():%7u usec (%u iterations)\n",
+                   length, byteDuration, wordDuration, kNumIterations);
+        }
+    }
 };
 
 } // namespace ot
@@ -305,6 +408,8 @@ int main(void)
     ot::ChecksumTester::TestExampleVector();
     ot::TestUdpMessageChecksum();
     ot::TestIcmp6MessageChecksum();
+    ot::ChecksumTester::TestAddDataSplits();
+    ot::ChecksumTester::TestAddDataPerformance();
     printf("All tests passed\n");
     return 0;
 }
@@ -26,6 +26,7 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
 #include <ctype.h>
 
 #include "common/code_utils.hpp"
@@ -39,10 +40,14 @@ namespace Ncp {
 
 enum
 {
-    kBufferSize        = 1500,  // Frame buffer size
-    kMaxFrameLength    = 500,   // Maximum allowed frame length (used when randomly generating frames)
-    kFuzzTestIteration = 50000, // Number of iteration during fuzz test (randomly generating frames)
-    kFrameHeaderSize   = 4,     // Frame header size
+    kBufferSize           = 1500,  // Frame buffer size
+    kMaxFrameLength       = 500,   // Maximum allowed frame length (used when randomly generating frames)
+    kFuzzTestIteration    = 50000, // Number of iteration during fuzz test (randomly generating frames)
+    kEquivalenceIteration = 2000,  // Number of iteration during bulk vs byte-by-byte equivalence test
+    kStreamSize           = 8192,  // Encoded stream buffer size (used in equivalence test)
+    kSmallBufferSize      = 256,   // Decoder buffer size small enough to get `OT_ERROR_NO_BUFS` for longer frames
+    kMaxDecodedFrames     = 8,     // Maximum number of frames in an encoded stream (used in equivalence test)
+    kFrameHeaderSize      = 4,     // Frame header size
 
     kFlagXOn        = 0x11,
     kFlagXOff       = 0x13,
@@ -671,6 +676,242 @@ void TestFuzzEncoderDecoder(void)
     printf(" -- PASS\n");
 }
 
+void FillRandomFrame(uint8_t *aFrame, uint16_t aLength)
+{
+    // Mix in HDLC special bytes so that both escaped bytes and longer runs of plain bytes are exercised.
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aFrame[i] = (GetRandom(8) == 0) ? sHdlcSpecials[GetRandom(sizeof(sHdlcSpecials))]
+                                        : static_cast<uint8_t>(GetRandom(256));
+    }
+}
+
+struct DecodedFrameLog
+{
+    uint16_t                             mNumFrames;
+    otError                              mErrors[kMaxDecodedFrames * 2];
+    uint16_t                             mLengths[kMaxDecodedFrames * 2];
+    uint8_t                              mFrames[kMaxDecodedFrames * 2][kSmallBufferSize];
+    Hdlc::FrameBuffer<kSmallBufferSize> *mBuffer;
+};
+
+void LogDecodedFrame(void *aContext, otError aError)
+{
+    DecodedFrameLog &log = *static_cast<DecodedFrameLog *>(aContext);
+
+    VerifyOrQuit(log.mNumFrames < OT_ARRAY_LENGTH(log.mErrors), "Decoder reported too many frames");
+
+    log.mErrors[log.mNumFrames]  = aError;
+    log.mLengths[log.mNumFrames] = log.mBuffer->GetLength();
+    memcpy(log.mFrames[log.mNumFrames], log.mBuffer->GetFrame(), log.mBuffer->GetLength());
+    log.mNumFrames++;
+    log.mBuffer->Clear();
+}
+
+void TestEncoderDecoderEquivalence(void)
+{
+    uint8_t                             frames[kMaxDecodedFrames][kMaxFrameLength];
+    uint16_t                            lengths[kMaxDecodedFrames];
+    uint8_t                             stream[kStreamSize];
+    Hdlc::FrameBuffer<kStreamSize>      bulkEncoderBuffer;
+    Hdlc::FrameBuffer<kStreamSize>      byteEncoderBuffer;
+    Hdlc::FrameBuffer<kSmallBufferSize> bulkDecoderBuffer;
+    Hdlc::FrameBuffer<kSmallBufferSize> byteDecoderBuffer;
+    DecodedFrameLog                     bulkLog;
+    DecodedFrameLog                     byteLog;
+    Hdlc::Encoder                       bulkEncoder(bulkEncoderBuffer);
+    Hdlc::Encoder                       byteEncoder(byteEncoderBuffer);
+    Hdlc::Decoder                       bulkDecoder(bulkDecoderBuffer, LogDecodedFrame, &bulkLog);
+    Hdlc::Decoder                       byteDecoder(byteDecoderBuffer, LogDecodedFrame, &byteLog);
+
+    printf("Testing bulk Hdlc::Encoder and Hdlc::Decoder against byte-by-byte encoding and decoding");
+
+    bulkLog.mBuffer = &bulkDecoderBuffer;
+    byteLog.mBuffer = &byteDecoderBuffer;
+
+    for (uint32_t iter = 0; iter < kEquivalenceIteration; iter++)
+    {
+        uint16_t numFrames = static_cast<uint16_t>(1 + GetRandom(kMaxDecodedFrames));
+        uint16_t streamLength;
+        bool     corrupted = false;
+
+        bulkEncoderBuffer.Clear();
+        byteEncoderBuffer.Clear();
+
+        // Encode the same frames with `Encode(aData, aLength)` and one `Encode(aByte)` call per byte.
+
+        for (uint16_t frame = 0; frame < numFrames; frame++)
+        {
+            lengths[frame] = static_cast<uint16_t>(1 + GetRandom(kMaxFrameLength - 1));
+            FillRandomFrame(frames[frame], lengths[frame]);
+
+            SuccessOrQuit(bulkEncoder.BeginFrame(), "Encoder::BeginFrame() failed");
+            SuccessOrQuit(bulkEncoder.Encode(frames[frame], lengths[frame]), "Encoder::Encode() failed");
+            SuccessOrQuit(bulkEncoder.EndFrame(), "Encoder::EndFrame() failed");
+
+            SuccessOrQuit(byteEncoder.BeginFrame(), "Encoder::BeginFrame() failed");
+
+            for (uint16_t i = 0; i < lengths[frame]; i++)
+            {
+                SuccessOrQuit(byteEncoder.Encode(frames[frame][i]), "Encoder::Encode() failed");
+            }
+
+            SuccessOrQuit(byteEncoder.EndFrame(), "Encoder::EndFrame() failed");
+        }
+
+        streamLength = bulkEncoderBuffer.GetLength();
+        VerifyOrQuit(streamLength == byteEncoderBuffer.GetLength(), "Bulk and byte-by-byte encoded lengths differ");
+        VerifyOrQuit(memcmp(bulkEncoderBuffer.GetFrame(), byteEncoderBuffer.GetFrame(), streamLength) == 0,
+                     "Bulk and byte-by-byte encoded frames differ");
+
+        memcpy(stream, bulkEncoderBuffer.GetFrame(), streamLength);
+
+        if (GetRandom(2) == 0)
+        {
+            stream[GetRandom(streamLength)] ^= static_cast<uint8_t>(1 + GetRandom(255));
+            corrupted = true;
+        }
+
+        // Decode the stream in random sized chunks and one byte at a time.
+
+        bulkLog.mNumFrames = 0;
+        byteLog.mNumFrames = 0;
+        bulkDecoder.Reset();
+        byteDecoder.Reset();
+        bulkDecoderBuffer.Clear();
+        byteDecoderBuffer.Clear();
+
+        for (uint16_t offset = 0; offset < streamLength;)
+        {
+            uint16_t chunkLength = static_cast<uint16_t>(1 + GetRandom(128));
+
+            chunkLength = OT_MIN(chunkLength, static_cast<uint16_t>(streamLength - offset));
+            bulkDecoder.Decode(&stream[offset], chunkLength);
+            offset += chunkLength;
+        }
+
+        for (uint16_t offset = 0; offset < streamLength; offset++)
+        {
+            byteDecoder.Decode(&stream[offset], sizeof(uint8_t));
+        }
+
+        VerifyOrQuit(bulkLog.mNumFrames == byteLog.mNumFrames, "Bulk and byte-by-byte decoded frame counts differ");
+
+        for (uint16_t frame = 0; frame < bulkLog.mNumFrames; frame++)
+        {
+            VerifyOrQuit(bulkLog.mErrors[frame] == byteLog.mErrors[frame], "Decoded frame errors differ");
+
+            if (bulkLog.mErrors[frame] == OT_ERROR_NONE)
+            {
+                VerifyOrQuit(bulkLog.mLengths[frame] == byteLog.mLengths[frame], "Decoded frame lengths differ");
+                VerifyOrQuit(memcmp(bulkLog.mFrames[frame], byteLog.mFrames[frame], bulkLog.mLengths[frame]) == 0,
+                             "Decoded frames differ");
+            }
+        }
+
+        if (!corrupted)
+        {
+            VerifyOrQuit(bulkLog.mNumFrames == numFrames, "Decoder did not report all frames");
+
+            for (uint16_t frame = 0; frame < numFrames; frame++)
+            {
+                if (lengths[frame] + 2 > kSmallBufferSize)
+                {
+                    VerifyOrQuit(bulkLog.mErrors[frame] == OT_ERROR_NO_BUFS, "Decoder did not fail for long frame");
+                    continue;
+                }
+
+                VerifyOrQuit(bulkLog.mErrors[frame] == OT_ERROR_NONE, "Decoder failed");
+                VerifyOrQuit(bulkLog.mLengths[frame] == lengths[frame], "Decoded frame length is incorrect");
+                VerifyOrQuit(memcmp(bulkLog.mFrames[frame], frames[frame], lengths[frame]) == 0,
+                             "Decoded frame content is incorrect");
+            }
+        }
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestEncoderDecoderPerformance(void)
+{
+    // Compares the time to encode and decode frames using the bulk `Encode()` and `Decode()` with feeding them one
+    // byte at a time.
+
+    const uint16_t kLengths[]     = {64, 127, 512, 1280};
+    const uint32_t kNumIterations = 5000;
+
+    uint8_t                        frame[1280];
+    Hdlc::FrameBuffer<kStreamSize> encoderBuffer;
+    Hdlc::FrameBuffer<kStreamSize> decoderBuffer;
+    DecoderContext                 decoderContext;
+    Hdlc::Encoder                  encoder(encoderBuffer);
+    Hdlc::Decoder                  decoder(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+
+    FillRandomFrame(frame, sizeof(frame));
+
+    for (uint16_t length : kLengths)
+    {
+        std::chrono::time_point<std::chrono::steady_clock> start;
+        uint32_t                                           byteDuration;
+        uint32_t                                           bulkDuration;
+
+        start = std::chrono::steady_clock::now();
+
+        for (uint32_t iter = 0; iter < kNumIterations; iter++)
+        {
+            encoderBuffer.Clear();
+            decoderBuffer.Clear();
+
+            SuccessOrQuit(encoder.BeginFrame(), "Encoder::BeginFrame() failed");
+
+            for (uint16_t i = 0; i < length; i++)
+            {
+                SuccessOrQuit(encoder.Encode(frame[i]), "Encoder::Encode() failed");
+            }
+
+            SuccessOrQuit(encoder.EndFrame(), "Encoder::EndFrame() failed");
+
+            decoderContext.mWasCalled = false;
+
+            for (uint16_t i = 0; i < encoderBuffer.GetLength(); i++)
+            {
+                decoder.Decode(encoderBuffer.GetFrame() + i, sizeof(uint8_t));
+            }
+
+            VerifyOrQuit(decoderContext.mWasCalled && decoderContext.mError == OT_ERROR_NONE, "Decoder failed");
+        }
+
+        byteDuration = static_cast<uint32_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
+        start = std::chrono::steady_clock::now();
+
+        for (uint32_t iter = 0; iter < kNumIterations; iter++)
+        {
+            encoderBuffer.Clear();
+            decoderBuffer.Clear();
+
+            SuccessOrQuit(encoder.BeginFrame(), "Encoder::BeginFrame() failed");
+            SuccessOrQuit(encoder.Encode(frame, length), "Encoder::Encode() failed");
+            SuccessOrQuit(encoder.EndFrame(), "Encoder::EndFrame() failed");
+
+            decoderContext.mWasCalled = false;
+            decoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+            VerifyOrQuit(decoderContext.mWasCalled && decoderContext.mError == OT_ERROR_NONE, "Decoder failed");
+        }
+
+        bulkDuration = static_cast<uint32_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
+        VerifyOrQuit(decoderBuffer.GetLength() == length, "Decoded frame length does not match original frame");
+        VerifyOrQuit(memcmp(decoderBuffer.GetFrame(), frame, length) == 0,
+                     "Decoded frame content does not match original frame");
+
+        printf("TestEncoderDecoderPerformance() length:%-4u byte-by-byte:%7u usec, bulk:%7u usec (%u iterations)\n",
+               length, byteDuration, bulkDuration, kNumIterations);
+    }
+}
+
 } // namespace Ncp
 } // namespace ot
 
@@ -680,6 +921,8 @@ int main(void)
     ot::Ncp::TestHdlcMultiFrameBuffer();
     ot::Ncp::TestEncoderDecoder();
     ot::Ncp::TestFuzzEncoderDecoder();
+    ot::Ncp::TestEncoderDecoderEquivalence();
+    ot::Ncp::TestEncoderDecoderPerformance();
     printf("\nAll tests passed.\n");
     return 0;
 }
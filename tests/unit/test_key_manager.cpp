@@ -0,0 +1,227 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/config.h>
+
+#include "common/code_utils.hpp"
+#include "common/encoding.hpp"
+#include "common/instance.hpp"
+#include "crypto/hmac_sha256.hpp"
+#include "mac/sub_mac.hpp"
+#include "thread/key_manager.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+namespace ot {
+
+static const uint8_t kMasterKey1[] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                                      0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+
+static const uint8_t kMasterKey2[] = {0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
+                                      0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef};
+
+struct ReferenceKeys
+{
+    Mle::Key mMleKey;
+    Mac::Key mMacKey;
+};
+
+static void ComputeReferenceKeys(const uint8_t *aMasterKey, uint32_t aKeySequence, ReferenceKeys &aKeys)
+{
+    const uint8_t kThreadString[] = {'T', 'h', 'r', 'e', 'a', 'd'};
+
+    Crypto::HmacSha256       hmac;
+    Crypto::HmacSha256::Hash hash;
+    uint8_t                  keySequenceBytes[sizeof(uint32_t)];
+
+    Encoding::BigEndian::WriteUint32(aKeySequence, keySequenceBytes);
+
+    hmac.Start(aMasterKey, sizeof(MasterKey));
+    hmac.Update(keySequenceBytes);
+    hmac.Update(kThreadString);
+    hmac.Finish(hash);
+
+    memcpy(aKeys.mMleKey.m8, hash.GetBytes(), sizeof(Mle::Key));
+    memcpy(aKeys.mMacKey.m8, hash.GetBytes() + sizeof(Mle::Key), sizeof(Mac::Key));
+}
+
+static void SetMasterKey(KeyManager &aKeyManager, const uint8_t *aMasterKey)
+{
+    MasterKey masterKey;
+
+    memcpy(masterKey.m8, aMasterKey, sizeof(MasterKey));
+    SuccessOrQuit(aKeyManager.SetMasterKey(masterKey), "SetMasterKey() failed");
+}
+
+static const Mle::Key &GetMleKey(KeyManager &aKeyManager, uint32_t aKeySequence)
+{
+    // Mirrors how MLE selects the key for a received message.
+
+    return (aKeySequence == aKeyManager.GetCurrentKeySequence()) ? aKeyManager.GetCurrentMleKey()
+                                                                 : aKeyManager.GetTemporaryMleKey(aKeySequence);
+}
+
+static void VerifyMacKeys(Instance &aInstance, const uint8_t *aMasterKey, uint32_t aKeySequence)
+{
+    ReferenceKeys keys;
+    Mac::SubMac & subMac = aInstance.Get<Mac::SubMac>();
+
+    ComputeReferenceKeys(aMasterKey, aKeySequence - 1, keys);
+    VerifyOrQuit(subMac.GetPreviousMacKey() == keys.mMacKey, "previous MAC key is incorrect");
+    ComputeReferenceKeys(aMasterKey, aKeySequence, keys);
+    VerifyOrQuit(subMac.GetCurrentMacKey() == keys.mMacKey, "current MAC key is incorrect");
+    ComputeReferenceKeys(aMasterKey, aKeySequence + 1, keys);
+    VerifyOrQuit(subMac.GetNextMacKey() == keys.mMacKey, "next MAC key is incorrect");
+}
+
+void TestKeyCacheRotation(void)
+{
+    // Simulates key rotations in a network with many neighbors. Before
+    // each rotation half of the neighbors already send MLE messages
+    // using the next Key Sequence, after it the other half still use
+    // the previous one. Only the new next keys should be derived.
+
+    const uint32_t kNumNeighbors     = 64;
+    const uint32_t kNumRotations     = 16;
+    const uint32_t kStartKeySequence = 0xfffffff8; // Also covers Key Sequence wrap-around.
+    const bool     kCachesRotation   = (OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_SIZE >= 3);
+
+    Instance *                   instance;
+    KeyManager::KeyCacheCounters counters;
+    ReferenceKeys                curKeys;
+    ReferenceKeys                nextKeys;
+    uint32_t                     keySequence;
+
+    printf("TestKeyCacheRotation() ");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    KeyManager &keyManager = instance->Get<KeyManager>();
+
+    SetMasterKey(keyManager, kMasterKey1);
+    keyManager.SetCurrentKeySequence(kStartKeySequence);
+    VerifyMacKeys(*instance, kMasterKey1, kStartKeySequence);
+
+    keyManager.ResetKeyCacheCounters();
+
+    for (uint32_t rotation = 0; rotation < kNumRotations; rotation++)
+    {
+        keySequence = keyManager.GetCurrentKeySequence();
+        ComputeReferenceKeys(kMasterKey1, keySequence, curKeys);
+        ComputeReferenceKeys(kMasterKey1, keySequence + 1, nextKeys);
+
+        for (uint32_t i = 0; i < kNumNeighbors; i++)
+        {
+            if ((i % 2) == 0)
+            {
+                VerifyOrQuit(GetMleKey(keyManager, keySequence) == curKeys.mMleKey, "MLE key is incorrect");
+            }
+            else
+            {
+                VerifyOrQuit(GetMleKey(keyManager, keySequence + 1) == nextKeys.mMleKey, "MLE key is incorrect");
+            }
+        }
+
+        keyManager.SetCurrentKeySequence(keySequence + 1);
+        VerifyOrQuit(keyManager.GetCurrentKeySequence() == keySequence + 1, "SetCurrentKeySequence() failed");
+        VerifyOrQuit(keyManager.GetCurrentMleKey() == nextKeys.mMleKey, "current MLE key is incorrect");
+        VerifyMacKeys(*instance, kMasterKey1, keySequence + 1);
+
+        for (uint32_t i = 0; i < kNumNeighbors; i++)
+        {
+            if ((i % 2) == 0)
+            {
+                VerifyOrQuit(GetMleKey(keyManager, keySequence) == curKeys.mMleKey, "MLE key is incorrect");
+            }
+            else
+            {
+                VerifyOrQuit(GetMleKey(keyManager, keySequence + 1) == nextKeys.mMleKey, "MLE key is incorrect");
+            }
+        }
+
+        // Each rotation derives the keys for the new next Key
+        // Sequence only. Previous and current keys, and all the keys
+        // used by the neighbors, are served by the cache (when it can
+        // hold the previous, current and next keys).
+
+        counters = keyManager.GetKeyCacheCounters();
+
+        if (kCachesRotation)
+        {
+            VerifyOrQuit(counters.mMisses == rotation + 1, "key cache misses are incorrect");
+            VerifyOrQuit(counters.mHits == (rotation + 1) * (kNumNeighbors + 2), "key cache hits are incorrect");
+        }
+    }
+
+    printf("(%u key derivations, %u without key cache) ", counters.mMisses, counters.mHits + counters.mMisses);
+
+    // Look up enough Key Sequences to evict all the cached entries,
+    // the previous key is then derived again.
+
+    keySequence = keyManager.GetCurrentKeySequence();
+    keyManager.ResetKeyCacheCounters();
+
+    for (uint32_t i = 0; i < OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_SIZE; i++)
+    {
+        keyManager.GetTemporaryMleKey(keySequence + 100 + i);
+    }
+
+    ComputeReferenceKeys(kMasterKey1, keySequence - 1, curKeys);
+    VerifyOrQuit(GetMleKey(keyManager, keySequence - 1) == curKeys.mMleKey, "MLE key is incorrect");
+
+    counters = keyManager.GetKeyCacheCounters();
+    VerifyOrQuit(counters.mMisses == OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_SIZE + 1,
+                 "key cache misses are incorrect");
+    VerifyOrQuit(counters.mHits == 0, "key cache hits are incorrect");
+
+    // Changing the Master Key must invalidate the cached keys.
+
+    SetMasterKey(keyManager, kMasterKey2);
+    VerifyOrQuit(keyManager.GetCurrentKeySequence() == 0, "SetMasterKey() did not reset the Key Sequence");
+    VerifyMacKeys(*instance, kMasterKey2, 0);
+
+    ComputeReferenceKeys(kMasterKey2, 0, curKeys);
+    VerifyOrQuit(keyManager.GetCurrentMleKey() == curKeys.mMleKey, "current MLE key is incorrect");
+    ComputeReferenceKeys(kMasterKey2, 1, nextKeys);
+    VerifyOrQuit(GetMleKey(keyManager, 1) == nextKeys.mMleKey, "MLE key is incorrect");
+
+    testFreeInstance(instance);
+
+    printf("--> PASSED\n");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestKeyCacheRotation();
+    printf("All tests passed\n");
+    return 0;
+}
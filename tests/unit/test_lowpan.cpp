@@ -28,6 +28,8 @@
 
 #include "test_lowpan.hpp"
 
+#include "thread/mesh_forwarder.hpp"
+
 #include "test_platform.h"
 #include "test_util.hpp"
 
@@ -2020,6 +2022,249 @@ void TestLowpanFragmentHeader(void)
                  "FragmentHeader::ParseFrom() did not fail with invalid header");
 }
 
+class MeshForwarderTester
+{
+public:
+    static void HandleFragment(Instance &            aInstance,
+                               const uint8_t *       aFrame,
+                               uint16_t              aFrameLength,
+                               const Mac::Address &  aMacSource,
+                               const Mac::Address &  aMacDest,
+                               const ThreadLinkInfo &aLinkInfo)
+    {
+        aInstance.Get<MeshForwarder>().HandleFragment(aFrame, aFrameLength, aMacSource, aMacDest, aLinkInfo);
+    }
+
+    static void HandleTimeTick(Instance &aInstance) { aInstance.Get<MeshForwarder>().HandleTimeTick(); }
+
+    static uint16_t GetNumReassemblies(Instance &aInstance)
+    {
+        uint16_t messages;
+        uint16_t buffers;
+
+        aInstance.Get<MeshForwarder>().GetReassemblyQueue().GetInfo(messages, buffers);
+
+        return messages;
+    }
+};
+
+enum
+{
+    kReassemblyPayloadLength = 360, // Payload of the test datagram (after the 40 octet IPv6 header).
+    kReassemblyFirstEnd      = 96,  // Datagram offset where the first fragment ends.
+    kReassemblyNextLength    = 64,  // Length of the datagram carried in each next fragment.
+};
+
+static uint8_t  sReassemblyDatagram[sizeof(Ip6::Header) + kReassemblyPayloadLength];
+static uint8_t  sReassemblyIphc[64];
+static uint16_t sReassemblyIphcLength;
+static uint16_t sNumReceivedDatagrams;
+static bool     sReceivedDatagramMatches;
+
+static void HandleReassembledDatagram(otMessage *aMessage, void *aContext)
+{
+    Message &message = *static_cast<Message *>(aMessage);
+    uint8_t  datagram[sizeof(sReassemblyDatagram)];
+
+    OT_UNUSED_VARIABLE(aContext);
+
+    sNumReceivedDatagrams++;
+    sReceivedDatagramMatches = (message.GetLength() == sizeof(datagram)) &&
+                               (message.ReadBytes(0, datagram, sizeof(datagram)) == sizeof(datagram)) &&
+                               (memcmp(datagram, sReassemblyDatagram, sizeof(datagram)) == 0);
+
+    message.Free();
+}
+
+static uint16_t ReassemblyFragmentLength(uint16_t aOffset)
+{
+    return (aOffset == 0) ? kReassemblyFirstEnd
+                          : static_cast<uint16_t>(OT_MIN(kReassemblyNextLength, sizeof(sReassemblyDatagram) - aOffset));
+}
+
+static void SendReassemblyFragment(Instance &aInstance, uint16_t aTag, uint16_t aOffset, uint16_t aLength = 0)
+{
+    Lowpan::FragmentHeader fragmentHeader;
+    uint8_t                frame[OT_RADIO_FRAME_MAX_SIZE];
+    uint16_t               frameLength;
+    Mac::Address           macSource;
+    Mac::Address           macDest;
+    ThreadLinkInfo         linkInfo;
+
+    macSource.SetExtended(sTestMacSourceDefaultLong, Mac::ExtAddress::kNormalByteOrder);
+    macDest.SetExtended(sTestMacDestinationDefaultLong, Mac::ExtAddress::kNormalByteOrder);
+
+    memset(&linkInfo, 0, sizeof(linkInfo));
+    linkInfo.mLinkSecurity = true;
+
+    if (aLength == 0)
+    {
+        aLength = ReassemblyFragmentLength(aOffset);
+    }
+
+    if (aOffset == 0)
+    {
+        fragmentHeader.InitFirstFragment(sizeof(sReassemblyDatagram), aTag);
+        frameLength = fragmentHeader.WriteTo(frame);
+        memcpy(frame + frameLength, sReassemblyIphc, sReassemblyIphcLength);
+        frameLength += sReassemblyIphcLength;
+        memcpy(frame + frameLength, sReassemblyDatagram + sizeof(Ip6::Header), aLength - sizeof(Ip6::Header));
+        frameLength += aLength - sizeof(Ip6::Header);
+    }
+    else
+    {
+        fragmentHeader.Init(sizeof(sReassemblyDatagram), aTag, aOffset);
+        frameLength = fragmentHeader.WriteTo(frame);
+        memcpy(frame + frameLength, sReassemblyDatagram + aOffset, aLength);
+        frameLength += aLength;
+    }
+
+    MeshForwarderTester::HandleFragment(aInstance, frame, frameLength, macSource, macDest, linkInfo);
+}
+
+static void SendReassemblyFragments(Instance &aInstance, uint16_t aTag, const uint16_t *aOffsets, uint16_t aNumOffsets)
+{
+    for (uint16_t i = 0; i < aNumOffsets; i++)
+    {
+        SendReassemblyFragment(aInstance, aTag, aOffsets[i]);
+    }
+}
+
+void TestLowpanReassembly(void)
+{
+    // Next fragment offsets, the first fragment (offset 0) covers [0, 96).
+    const uint16_t kInOrder[]    = {0, 96, 160, 224, 288, 352};
+    const uint16_t kOutOfOrder[] = {0, 352, 160, 288, 96, 224};
+
+    Instance *                  instance = testInitInstance();
+    Ip6::NetifUnicastAddress    address;
+    Ip6::Header                 ip6Header;
+    Message *                   message;
+    uint8_t                     result[sizeof(sReassemblyIphc)];
+    Mac::Address                macSource;
+    Mac::Address                macDest;
+    const otReassemblyCounters *counters;
+    const otIpCounters *        ipCounters;
+
+    VerifyOrQuit(instance != nullptr, "null instance");
+
+    counters   = &instance->Get<MeshForwarder>().GetReassemblyCounters();
+    ipCounters = &instance->Get<MeshForwarder>().GetCounters();
+
+    macSource.SetExtended(sTestMacSourceDefaultLong, Mac::ExtAddress::kNormalByteOrder);
+    macDest.SetExtended(sTestMacDestinationDefaultLong, Mac::ExtAddress::kNormalByteOrder);
+
+    address.InitAsThreadOrigin();
+    SuccessOrQuit(address.GetAddress().FromString("fd00:1234::1"), "Address::FromString() failed");
+    instance->Get<ThreadNetif>().AddUnicastAddress(address);
+
+    otIp6SetReceiveCallback(instance, HandleReassembledDatagram, nullptr);
+
+    // Reassemble like a router, a sleepy device only keeps one datagram at a time.
+    instance->Get<Mac::Mac>().SetRxOnWhenIdle(true);
+
+    // Build the datagram and its compressed header.
+
+    ip6Header.Init();
+    ip6Header.SetPayloadLength(kReassemblyPayloadLength);
+    ip6Header.SetNextHeader(Ip6::kProtoIcmp6);
+    ip6Header.SetHopLimit(64);
+    SuccessOrQuit(ip6Header.GetSource().FromString("fd00:1234::2"), "Address::FromString() failed");
+    ip6Header.GetDestination() = address.GetAddress();
+
+    memcpy(sReassemblyDatagram, &ip6Header, sizeof(ip6Header));
+
+    for (uint16_t i = sizeof(ip6Header); i < sizeof(sReassemblyDatagram); i++)
+    {
+        sReassemblyDatagram[i] = static_cast<uint8_t>(i);
+    }
+
+    message = instance->Get<MessagePool>().New(Message::kTypeIp6, 0);
+    VerifyOrQuit(message != nullptr, "MessagePool::New() failed");
+    SuccessOrQuit(message->AppendBytes(sReassemblyDatagram, sizeof(sReassemblyDatagram)), "Message::Append failed");
+
+    {
+        Lowpan::BufferWriter buffer(result, sizeof(result));
+
+        SuccessOrQuit(instance->Get<Lowpan::Lowpan>().Compress(*message, macSource, macDest, buffer),
+                      "Lowpan::Compress() failed");
+        VerifyOrQuit(message->GetOffset() == sizeof(ip6Header), "Lowpan::Compress() consumed extra bytes");
+
+        sReassemblyIphcLength = static_cast<uint16_t>(buffer.GetWritePointer() - result);
+        memcpy(sReassemblyIphc, result, sReassemblyIphcLength);
+    }
+
+    message->Free();
+
+    // In order.
+
+    SendReassemblyFragments(*instance, 1, kInOrder, OT_ARRAY_LENGTH(kInOrder));
+    VerifyOrQuit(sNumReceivedDatagrams == 1, "in order datagram was not reassembled");
+    VerifyOrQuit(sReceivedDatagramMatches, "in order datagram is corrupted");
+    VerifyOrQuit(counters->mReassembled == 1, "mReassembled is incorrect");
+    VerifyOrQuit(ipCounters->mRxSuccess == 1, "mRxSuccess is incorrect");
+    VerifyOrQuit(MeshForwarderTester::GetNumReassemblies(*instance) == 0, "reassembly queue is not empty");
+
+    // Out of order.
+
+    SendReassemblyFragments(*instance, 2, kOutOfOrder, OT_ARRAY_LENGTH(kOutOfOrder) - 1);
+    VerifyOrQuit(sNumReceivedDatagrams == 1, "incomplete datagram was delivered");
+    VerifyOrQuit(MeshForwarderTester::GetNumReassemblies(*instance) == 1, "reassembly queue is incorrect");
+    SendReassemblyFragment(*instance, 2, kOutOfOrder[OT_ARRAY_LENGTH(kOutOfOrder) - 1]);
+    VerifyOrQuit(sNumReceivedDatagrams == 2, "out of order datagram was not reassembled");
+    VerifyOrQuit(sReceivedDatagramMatches, "out of order datagram is corrupted");
+    VerifyOrQuit(counters->mReassembled == 2, "mReassembled is incorrect");
+
+    // Duplicate and overlapping fragments are dropped without disturbing the reassembly.
+
+    SendReassemblyFragment(*instance, 3, 0);
+    SendReassemblyFragment(*instance, 3, 0);
+    VerifyOrQuit(counters->mDuplicateFragments == 1, "duplicate first fragment was not detected");
+    SendReassemblyFragment(*instance, 3, 160);
+    SendReassemblyFragment(*instance, 3, 160);
+    VerifyOrQuit(counters->mDuplicateFragments == 2, "duplicate next fragment was not detected");
+    SendReassemblyFragment(*instance, 3, 96, 2 * kReassemblyNextLength);
+    VerifyOrQuit(counters->mOverlapFragments == 1, "overlapping fragment was not detected");
+    SendReassemblyFragment(*instance, 3, 96, kReassemblyNextLength - 1);
+    VerifyOrQuit(sNumReceivedDatagrams == 2, "misaligned fragment was accepted");
+    SendReassemblyFragment(*instance, 3, 352);
+    SendReassemblyFragment(*instance, 3, 96);
+    SendReassemblyFragment(*instance, 3, 288);
+    VerifyOrQuit(sNumReceivedDatagrams == 2, "incomplete datagram was delivered");
+    SendReassemblyFragment(*instance, 3, 224);
+    VerifyOrQuit(sNumReceivedDatagrams == 3, "datagram with duplicates was not reassembled");
+    VerifyOrQuit(sReceivedDatagramMatches, "datagram with duplicates is corrupted");
+    SendReassemblyFragment(*instance, 3, 224);
+    VerifyOrQuit(counters->mUnmatchedFragments == 1, "fragment of a completed datagram was not dropped");
+    VerifyOrQuit(counters->mDuplicateFragments == 2, "mDuplicateFragments is incorrect");
+    VerifyOrQuit(counters->mOverlapFragments == 1, "mOverlapFragments is incorrect");
+
+    // Eviction when all entries are in use, then timeout.
+
+    for (uint16_t tag = 10; tag < 10 + OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES + 1; tag++)
+    {
+        SendReassemblyFragment(*instance, tag, 0);
+    }
+
+    VerifyOrQuit(counters->mEvictions == 1, "mEvictions is incorrect");
+    VerifyOrQuit(MeshForwarderTester::GetNumReassemblies(*instance) == OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES,
+                 "reassembly queue is incorrect");
+
+    for (uint8_t i = 0; i <= OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT; i++)
+    {
+        MeshForwarderTester::HandleTimeTick(*instance);
+    }
+
+    VerifyOrQuit(counters->mTimeouts == OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES, "mTimeouts is incorrect");
+    VerifyOrQuit(MeshForwarderTester::GetNumReassemblies(*instance) == 0, "reassembly queue is not empty");
+    VerifyOrQuit(ipCounters->mRxFailure == OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES + 1, "mRxFailure is incorrect");
+    VerifyOrQuit(ipCounters->mRxSuccess == 3, "mRxSuccess is incorrect");
+
+    testFreeInstance(instance);
+
+    printf("TestLowpanReassembly PASS\n");
+}
+
 } // namespace ot
 
 int main(void)
@@ -2027,6 +2272,7 @@ int main(void)
     TestLowpanIphc();
     TestLowpanMeshHeader();
     TestLowpanFragmentHeader();
+    TestLowpanReassembly();
 
     printf("All tests passed\n");
     return 0;
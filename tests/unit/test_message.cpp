@@ -243,11 +243,312 @@ void TestMessage(void)
     testFreeInstance(instance);
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+
+void TestMessageSharedBuffers(void)
+{
+    enum : uint16_t
+    {
+        kMaxSize    = (kBufferSize * 4 + 24),
+        kOffsetStep = 7,
+    };
+
+    Instance *   instance;
+    MessagePool *messagePool;
+    Message *    message;
+    Message *    clone;
+    Message *    clone2;
+    Message *    fillers[kNumBuffers];
+    uint16_t     numFillers = 0;
+    uint16_t     numFreeBuffers;
+    uint16_t     numUsedBuffers;
+    uint8_t      writeBuffer[kMaxSize];
+    uint8_t      cloneBuffer[kMaxSize];
+    uint8_t      readBuffer[kMaxSize];
+    uint8_t      header[kBufferSize];
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+    messagePool    = &instance->Get<MessagePool>();
+    numFreeBuffers = messagePool->GetFreeBufferCount();
+
+    Random::NonCrypto::FillBuffer(writeBuffer, kMaxSize);
+    Random::NonCrypto::FillBuffer(header, sizeof(header));
+
+    VerifyOrQuit((message = messagePool->New(Message::kTypeIp6, 0)) != nullptr, "Message::New failed");
+    SuccessOrQuit(message->SetLength(kMaxSize), "Message::SetLength failed");
+    message->WriteBytes(0, writeBuffer, kMaxSize);
+
+    // A clone sharing the buffers only takes a new first buffer from
+    // the pool, while a copy takes as many buffers as the message.
+
+    numUsedBuffers = messagePool->GetBufferStats().mTotal.mUsedBuffers;
+
+    VerifyOrQuit((clone = message->Clone()) != nullptr, "Message::Clone failed");
+    VerifyOrQuit(messagePool->GetFreeBufferCount() + message->GetBufferCount() * 2 == numFreeBuffers,
+                 "Clone() did not copy the message buffers");
+    clone->Free();
+
+    VerifyOrQuit((clone = message->CloneSharingBuffers(kMaxSize)) != nullptr, "Message::CloneSharingBuffers failed");
+    VerifyOrQuit(messagePool->GetBufferStats().mTotal.mUsedBuffers == numUsedBuffers + 1,
+                 "CloneSharingBuffers() did not share the message buffers");
+    VerifyOrQuit(messagePool->GetFreeBufferCount() + message->GetBufferCount() + 1 == numFreeBuffers,
+                 "CloneSharingBuffers() took more than one free buffer");
+    VerifyOrQuit(clone->GetLength() == kMaxSize, "CloneSharingBuffers() length is incorrect");
+    VerifyOrQuit(clone->Compare(0, writeBuffer), "CloneSharingBuffers() content is incorrect");
+
+    // Shared buffers cannot be copied when the pool has no free
+    // buffers left. The messages are then left unchanged.
+
+    while ((fillers[numFillers] = messagePool->New(Message::kTypeOther, 0)) != nullptr)
+    {
+        numFillers++;
+    }
+
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == 0, "message pool is not empty");
+
+    VerifyOrQuit(clone->UnshareBuffers() == kErrorNoBufs, "UnshareBuffers() succeeded with no free buffers");
+    VerifyOrQuit(message->UnshareBuffers() == kErrorNoBufs, "UnshareBuffers() succeeded with no free buffers");
+    VerifyOrQuit(clone->SetLength(kMaxSize + 1) == kErrorNoBufs, "SetLength() succeeded with no free buffers");
+    VerifyOrQuit(clone->PrependBytes(header, 1) == kErrorNoBufs, "PrependBytes() succeeded with no free buffers");
+
+    VerifyOrQuit(clone->GetLength() == kMaxSize, "failed SetLength() changed the clone length");
+    VerifyOrQuit(clone->Compare(0, writeBuffer), "failed write changed the clone");
+    VerifyOrQuit(message->Compare(0, writeBuffer), "failed write changed the original message");
+
+    for (uint16_t i = 0; i < numFillers; i++)
+    {
+        fillers[i]->Free();
+    }
+
+    // The first message written copies the shared buffers, and the
+    // other message then no longer shares them.
+
+    SuccessOrQuit(message->UnshareBuffers(), "Message::UnshareBuffers failed");
+    VerifyOrQuit(messagePool->GetFreeBufferCount() + message->GetBufferCount() * 2 == numFreeBuffers,
+                 "UnshareBuffers() did not copy the shared buffers");
+    SuccessOrQuit(clone->UnshareBuffers(), "Message::UnshareBuffers failed");
+    VerifyOrQuit(messagePool->GetFreeBufferCount() + message->GetBufferCount() * 2 == numFreeBuffers,
+                 "UnshareBuffers() copied buffers which were no longer shared");
+
+    memcpy(cloneBuffer, writeBuffer, kMaxSize);
+    cloneBuffer[kMaxSize - 1]++;
+    clone->WriteBytes(kMaxSize - 1, &cloneBuffer[kMaxSize - 1], 1);
+    writeBuffer[kBufferSize]++;
+    message->WriteBytes(kBufferSize, &writeBuffer[kBufferSize], 1);
+
+    VerifyOrQuit(clone->Compare(0, cloneBuffer), "write to an unshared clone failed");
+    VerifyOrQuit(message->Compare(0, writeBuffer), "write to an unshared original message failed");
+
+    clone->Free();
+
+    VerifyOrQuit(messagePool->GetFreeBufferCount() + message->GetBufferCount() == numFreeBuffers,
+                 "Free() of a clone did not release its buffers");
+
+    // Writing to a clone does not change the original message, and
+    // writing to the original does not change the clone.
+
+    for (uint16_t offset = 0; offset < kMaxSize; offset += kOffsetStep)
+    {
+        VerifyOrQuit((clone = message->CloneSharingBuffers(kMaxSize)) != nullptr, "Message::CloneSharingBuffers failed");
+
+        memcpy(cloneBuffer, writeBuffer, kMaxSize);
+        cloneBuffer[offset]++;
+        clone->WriteBytes(offset, &cloneBuffer[offset], 1);
+
+        VerifyOrQuit(clone->Compare(0, cloneBuffer), "write to a clone failed");
+        VerifyOrQuit(message->Compare(0, writeBuffer), "write to a clone changed the original message");
+
+        writeBuffer[kMaxSize - 1 - offset] += 2;
+        message->WriteBytes(kMaxSize - 1 - offset, &writeBuffer[kMaxSize - 1 - offset], 1);
+
+        VerifyOrQuit(message->Compare(0, writeBuffer), "write to the original message failed");
+        VerifyOrQuit(clone->Compare(0, cloneBuffer), "write to the original message changed the clone");
+
+        clone->Free();
+    }
+
+    VerifyOrQuit(messagePool->GetFreeBufferCount() + message->GetBufferCount() == numFreeBuffers,
+                 "buffers were not released after writes to clones");
+
+    // Shorter clone which is then appended, prepended, shrunk and grown.
+
+    VerifyOrQuit((clone = message->CloneSharingBuffers(kMaxSize / 2)) != nullptr, "Message::CloneSharingBuffers failed");
+    VerifyOrQuit(clone->GetLength() == kMaxSize / 2, "CloneSharingBuffers() length is incorrect");
+    VerifyOrQuit(clone->CompareBytes(0, writeBuffer, kMaxSize / 2), "CloneSharingBuffers() content is incorrect");
+
+    memcpy(cloneBuffer, writeBuffer, kMaxSize / 2);
+    Random::NonCrypto::FillBuffer(&cloneBuffer[kMaxSize / 2], kMaxSize / 2);
+    SuccessOrQuit(clone->AppendBytes(&cloneBuffer[kMaxSize / 2], kMaxSize / 2), "Message::AppendBytes failed");
+
+    VerifyOrQuit(clone->Compare(0, cloneBuffer), "AppendBytes() to a clone failed");
+    VerifyOrQuit(message->Compare(0, writeBuffer), "AppendBytes() to a clone changed the original message");
+
+    SuccessOrQuit(clone->PrependBytes(header, sizeof(header)), "Message::PrependBytes failed");
+    VerifyOrQuit(clone->Compare(0, header), "PrependBytes() to a clone failed");
+    VerifyOrQuit(clone->Compare(sizeof(header), cloneBuffer), "PrependBytes() to a clone failed");
+    VerifyOrQuit(message->Compare(0, writeBuffer), "PrependBytes() to a clone changed the original message");
+    clone->Free();
+
+    VerifyOrQuit((clone = message->CloneSharingBuffers(kMaxSize)) != nullptr, "Message::CloneSharingBuffers failed");
+    SuccessOrQuit(clone->SetLength(kMaxSize / 3), "Message::SetLength failed");
+    SuccessOrQuit(clone->SetLength(kMaxSize), "Message::SetLength failed");
+    memset(cloneBuffer, 0, sizeof(cloneBuffer));
+    clone->WriteBytes(0, cloneBuffer, kMaxSize);
+
+    VerifyOrQuit(clone->Compare(0, cloneBuffer), "write to a resized clone failed");
+    VerifyOrQuit(message->Compare(0, writeBuffer), "write to a resized clone changed the original message");
+    clone->Free();
+
+    // A clone of a clone stays valid after the original message is freed.
+
+    VerifyOrQuit((clone = message->CloneSharingBuffers(kMaxSize)) != nullptr, "Message::CloneSharingBuffers failed");
+    VerifyOrQuit((clone2 = clone->CloneSharingBuffers(kMaxSize)) != nullptr, "Message::CloneSharingBuffers failed");
+    message->Free();
+
+    SuccessOrQuit(clone->Read(0, readBuffer, kMaxSize), "Message::Read failed");
+    VerifyOrQuit(memcmp(readBuffer, writeBuffer, kMaxSize) == 0, "clone changed after the original was freed");
+
+    memcpy(cloneBuffer, writeBuffer, kMaxSize);
+    cloneBuffer[kMaxSize - 1]++;
+    clone2->WriteBytes(kMaxSize - 1, &cloneBuffer[kMaxSize - 1], 1);
+
+    VerifyOrQuit(clone2->Compare(0, cloneBuffer), "write to a clone of a clone failed");
+    VerifyOrQuit(clone->Compare(0, writeBuffer), "write to a clone of a clone changed the clone");
+
+    clone->Free();
+    clone2->Free();
+
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == numFreeBuffers, "message buffers were leaked");
+
+    testFreeInstance(instance);
+}
+
+static uint16_t GetRetransmissionBufferUsage(MessagePool &aMessagePool,
+                                             uint16_t     aPayloadLength,
+                                             uint16_t     aMetadataLength,
+                                             uint16_t     aHeaderLength,
+                                             bool         aShareBuffers,
+                                             uint16_t &   aNumTakenBuffers)
+{
+    // Returns the number of buffers used by the copies of a sent
+    // message which are kept for retransmissions (MPL and CoAP): the
+    // stored copy (followed by its metadata) and a retransmitted copy
+    // which is queued for transmission with its headers prepended.
+    // `aNumTakenBuffers` is set to the number of free buffers taken.
+
+    uint8_t  buffer[kBufferSize] = {0};
+    uint16_t numFreeBuffers;
+    uint16_t numUsedBuffers;
+    uint16_t numTakenBuffers;
+    Message *message;
+    Message *storedCopy;
+    Message *retxCopy;
+
+    VerifyOrQuit((message = aMessagePool.New(Message::kTypeIp6, 0)) != nullptr, "Message::New failed");
+
+    for (uint16_t length = 0; length < aPayloadLength; length += sizeof(buffer))
+    {
+        uint16_t appendLength = OT_MIN(static_cast<uint16_t>(sizeof(buffer)), aPayloadLength - length);
+
+        Random::NonCrypto::FillBuffer(buffer, sizeof(buffer));
+        SuccessOrQuit(message->AppendBytes(buffer, appendLength), "Message::AppendBytes failed");
+    }
+
+    numFreeBuffers = aMessagePool.GetFreeBufferCount();
+    numUsedBuffers = aMessagePool.GetBufferStats().mTotal.mUsedBuffers;
+
+    VerifyOrQuit((storedCopy = message->Clone()) != nullptr, "Message::Clone failed");
+    SuccessOrQuit(storedCopy->AppendBytes(buffer, aMetadataLength), "Message::AppendBytes failed");
+
+    retxCopy = aShareBuffers ? storedCopy->CloneSharingBuffers(storedCopy->GetLength() - aMetadataLength)
+                             : storedCopy->Clone(storedCopy->GetLength() - aMetadataLength);
+    VerifyOrQuit(retxCopy != nullptr, "Message::Clone failed");
+    SuccessOrQuit(retxCopy->PrependBytes(buffer, aHeaderLength), "Message::PrependBytes failed");
+
+    VerifyOrQuit(retxCopy->CompareBytes(aHeaderLength, *message, 0, message->GetLength()), "copy content is incorrect");
+
+    numUsedBuffers   = aMessagePool.GetBufferStats().mTotal.mUsedBuffers - numUsedBuffers;
+    aNumTakenBuffers = numFreeBuffers - aMessagePool.GetFreeBufferCount();
+
+    retxCopy->Free();
+    storedCopy->Free();
+    message->Free();
+
+    return numUsedBuffers;
+}
+
+void TestMessageSharedBufferUsage(void)
+{
+    // Buffer usage benchmark for the message copies kept and sent for
+    // MPL and CoAP retransmissions. The metadata and header lengths
+    // approximate the MPL buffered message metadata with an IPv6
+    // header, and the CoAP request metadata with IPv6 and UDP headers.
+
+    struct Scenario
+    {
+        const char *mName;
+        uint16_t    mMetadataLength;
+        uint16_t    mHeaderLength;
+    };
+
+    static const Scenario kScenarios[] = {
+        {"MPL", 12, 40},
+        {"CoAP", 56, 48},
+    };
+
+    static const uint16_t kPayloadLengths[] = {64, 256, 512, 1024};
+
+    Instance *   instance;
+    MessagePool *messagePool;
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<MessagePool>();
+
+    printf("Buffers used (and taken from the pool) by the retransmission copies, shared / copied:\n");
+
+    for (const Scenario &scenario : kScenarios)
+    {
+        for (uint16_t payloadLength : kPayloadLengths)
+        {
+            uint16_t sharedTaken;
+            uint16_t copiedTaken;
+            uint16_t shared = GetRetransmissionBufferUsage(*messagePool, payloadLength, scenario.mMetadataLength,
+                                                           scenario.mHeaderLength, /* aShareBuffers */ true,
+                                                           sharedTaken);
+            uint16_t copied = GetRetransmissionBufferUsage(*messagePool, payloadLength, scenario.mMetadataLength,
+                                                           scenario.mHeaderLength, /* aShareBuffers */ false,
+                                                           copiedTaken);
+
+            printf("  %-4s %4u-byte payload: %2u (%2u) / %2u (%2u)\n", scenario.mName, payloadLength, shared,
+                   sharedTaken, copied, copiedTaken);
+            VerifyOrQuit(shared <= copied, "sharing buffers used more buffers than copying");
+            VerifyOrQuit(sharedTaken <= copiedTaken, "sharing buffers took more buffers than copying");
+
+            if (payloadLength > kBufferSize)
+            {
+                VerifyOrQuit(sharedTaken < copiedTaken, "sharing buffers took as many buffers as copying");
+            }
+        }
+    }
+
+    testFreeInstance(instance);
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestMessage();
+#if OPENTHREAD_CONFIG_MESSAGE_SHARE_BUFFERS_ENABLE
+    ot::TestMessageSharedBuffers();
+    ot::TestMessageSharedBufferUsage();
+#endif
     printf("All tests passed\n");
     return 0;
 }
@@ -28,8 +28,13 @@
 
 #include <openthread/config.h>
 
+#include <chrono>
+
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
+#include "common/message.hpp"
+#include "thread/mle_tlvs.hpp"
+#include "thread/network_data_leader.hpp"
 #include "thread/network_data_local.hpp"
 
 #include "test_platform.h"
@@ -219,6 +224,441 @@ void TestNetworkDataIterator(void)
     testFreeInstance(instance);
 }
 
+// Builds raw Network Data TLVs (all stable) for the Leader lookup tests.
+class NetworkDataBuilder
+{
+public:
+    NetworkDataBuilder(void)
+        : mLength(0)
+        , mPrefixStart(0)
+        , mSubTlvStart(0)
+    {
+    }
+
+    void StartPrefix(uint8_t aDomainId, const char *aPrefix, uint8_t aPrefixLength)
+    {
+        Ip6::Address prefix;
+
+        SuccessOrQuit(prefix.FromString(aPrefix), "Address::FromString() failed");
+
+        mPrefixStart = mLength;
+        AppendTlvHeader(NetworkDataTlv::kTypePrefix);
+        Append(aDomainId);
+        Append(aPrefixLength);
+
+        for (uint8_t i = 0; i < Ip6::Prefix::SizeForLength(aPrefixLength); i++)
+        {
+            Append(prefix.mFields.m8[i]);
+        }
+    }
+
+    void EndPrefix(void) { mTlvs[mPrefixStart + 1] = mLength - mPrefixStart - 2; }
+
+    void StartSubTlv(NetworkDataTlv::Type aType)
+    {
+        mSubTlvStart = mLength;
+        AppendTlvHeader(aType);
+    }
+
+    void EndSubTlv(void) { mTlvs[mSubTlvStart + 1] = mLength - mSubTlvStart - 2; }
+
+    void AddBorderRouterEntry(uint16_t aRloc16, int8_t aPreference, bool aOnMesh, bool aDefaultRoute)
+    {
+        AppendRloc16(aRloc16);
+        Append(static_cast<uint8_t>((static_cast<uint8_t>(aPreference) << 6) | (aDefaultRoute ? 0x02 : 0) |
+                                    (aOnMesh ? 0x01 : 0)));
+        Append(0);
+    }
+
+    void AddHasRouteEntry(uint16_t aRloc16, int8_t aPreference)
+    {
+        AppendRloc16(aRloc16);
+        Append(static_cast<uint8_t>(static_cast<uint8_t>(aPreference) << 6));
+    }
+
+    void AddContextTlv(uint8_t aContextId, bool aCompress, uint8_t aContextLength)
+    {
+        StartSubTlv(NetworkDataTlv::kTypeContext);
+        Append((aCompress ? 0x10 : 0) | aContextId);
+        Append(aContextLength);
+        EndSubTlv();
+    }
+
+    Message *NewNetworkDataMessage(Instance &aInstance) const
+    {
+        Message *message = aInstance.Get<MessagePool>().New(Message::kTypeIp6, 0);
+        Mle::Tlv tlv;
+
+        VerifyOrQuit(message != nullptr, "MessagePool::New() failed");
+
+        tlv.SetType(Mle::Tlv::kNetworkData);
+        tlv.SetLength(mLength);
+        SuccessOrQuit(message->Append(tlv), "Message::Append() failed");
+        SuccessOrQuit(message->AppendBytes(mTlvs, mLength), "Message::AppendBytes() failed");
+
+        return message;
+    }
+
+    uint8_t        GetLength(void) const { return mLength; }
+    const uint8_t *GetBytes(void) const { return mTlvs; }
+
+private:
+    void Append(uint8_t aByte)
+    {
+        VerifyOrQuit(mLength < sizeof(mTlvs), "Network Data is too long");
+        mTlvs[mLength++] = aByte;
+    }
+
+    void AppendTlvHeader(NetworkDataTlv::Type aType)
+    {
+        Append(static_cast<uint8_t>((aType << 1) | 1));
+        Append(0);
+    }
+
+    void AppendRloc16(uint16_t aRloc16)
+    {
+        Append(aRloc16 >> 8);
+        Append(aRloc16 & 0xff);
+    }
+
+    uint8_t  mTlvs[NetworkData::kMaxSize];
+    uint8_t  mLength;
+    uint16_t mPrefixStart;
+    uint16_t mSubTlvStart;
+};
+
+class LeaderTester
+{
+public:
+    static bool IsLookupCacheUsed(const LeaderBase &aLeader) { return aLeader.GetLookupCache() != nullptr; }
+
+    static void RegisterNetworkData(Leader &aLeader, uint16_t aRloc16, const NetworkDataBuilder &aBuilder)
+    {
+        aLeader.RegisterNetworkData(aRloc16, aBuilder.GetBytes(), aBuilder.GetLength());
+    }
+};
+
+struct LookupResults
+{
+    enum : uint8_t
+    {
+        kNumAddresses = 6,
+        kNumRoutes    = 4,
+        kNumContexts  = 6,
+    };
+
+    Error    mContextError[kNumAddresses];
+    uint8_t  mContextId[kNumAddresses];
+    bool     mIsOnMesh[kNumAddresses];
+    Error    mContextByIdError[kNumContexts];
+    uint8_t  mContextByIdLength[kNumContexts];
+    Error    mRouteError[kNumRoutes];
+    uint16_t mRouteRloc16[kNumRoutes];
+    uint8_t  mRouteMatchLength[kNumRoutes];
+};
+
+static const uint8_t kNumLookupPrefixes = 6;
+
+static void SetLeaderNetworkData(Instance &aInstance, uint8_t aNumPaddingPrefixes, uint8_t aVersion)
+{
+    // Adds `kNumLookupPrefixes` prefixes used by the lookups followed
+    // by `aNumPaddingPrefixes` prefixes which none of the lookups
+    // match.
+
+    NetworkDataBuilder builder;
+    Message *          message;
+
+    builder.StartPrefix(0, "fd00:1::", 64);
+    builder.StartSubTlv(NetworkDataTlv::kTypeBorderRouter);
+    builder.AddBorderRouterEntry(0x0400, 0, /* aOnMesh */ true, /* aDefaultRoute */ true);
+    builder.AddBorderRouterEntry(0x0800, 1, /* aOnMesh */ true, /* aDefaultRoute */ true);
+    builder.EndSubTlv();
+    builder.AddContextTlv(1, /* aCompress */ true, 64);
+    builder.EndPrefix();
+
+    builder.StartPrefix(0, "fd00:2::", 64);
+    builder.StartSubTlv(NetworkDataTlv::kTypeBorderRouter);
+    builder.AddBorderRouterEntry(0x0c00, 0, /* aOnMesh */ true, /* aDefaultRoute */ false);
+    builder.EndSubTlv();
+    builder.AddContextTlv(2, /* aCompress */ false, 64);
+    builder.EndPrefix();
+
+    builder.StartPrefix(0, "2001:db8:1::", 48);
+    builder.StartSubTlv(NetworkDataTlv::kTypeHasRoute);
+    builder.AddHasRouteEntry(0x1000, 0);
+    builder.AddHasRouteEntry(0x1400, 1);
+    builder.EndSubTlv();
+    builder.EndPrefix();
+
+    builder.StartPrefix(0, "2001:db8:1:2::", 64);
+    builder.StartSubTlv(NetworkDataTlv::kTypeHasRoute);
+    builder.AddHasRouteEntry(0x1800, -1);
+    builder.EndSubTlv();
+    builder.EndPrefix();
+
+    builder.StartPrefix(1, "fd00:3::", 64);
+    builder.StartSubTlv(NetworkDataTlv::kTypeBorderRouter);
+    builder.AddBorderRouterEntry(0x1c00, 0, /* aOnMesh */ true, /* aDefaultRoute */ true);
+    builder.EndSubTlv();
+    builder.AddContextTlv(3, /* aCompress */ true, 64);
+    builder.EndPrefix();
+
+    builder.StartPrefix(0, "fd00:4::", 64);
+    builder.StartSubTlv(NetworkDataTlv::kTypeBorderRouter);
+    builder.AddBorderRouterEntry(0x2000, 0, /* aOnMesh */ false, /* aDefaultRoute */ true);
+    builder.EndSubTlv();
+    builder.EndPrefix();
+
+    for (uint8_t i = 0; i < aNumPaddingPrefixes; i++)
+    {
+        char prefix[sizeof("fd00:ffff:ff::")];
+
+        snprintf(prefix, sizeof(prefix), "fd00:ffff:%x::", i);
+        builder.StartPrefix(0, prefix, 48);
+        builder.StartSubTlv(NetworkDataTlv::kTypeBorderRouter);
+        builder.AddBorderRouterEntry(0x4000 + i, 0, /* aOnMesh */ true, /* aDefaultRoute */ false);
+        builder.EndSubTlv();
+        builder.EndPrefix();
+    }
+
+    message = builder.NewNetworkDataMessage(aInstance);
+    SuccessOrQuit(aInstance.Get<Leader>().SetNetworkData(aVersion, aVersion, /* aStableOnly */ false, *message, 0),
+                  "SetNetworkData() failed");
+    message->Free();
+
+    printf("\nNetwork Data length: %u bytes", builder.GetLength());
+}
+
+static uint32_t DoLookups(Instance &aInstance, LookupResults &aResults, uint32_t aIterations)
+{
+    const char *kAddresses[LookupResults::kNumAddresses] = {
+        "fd00:1::1234", "fd00:2::1", "fd00:3::abcd", "fd00:4::1", "2001:db8:1::1", "fd00:ffff:ffff::1",
+    };
+
+    const char *kRoutes[LookupResults::kNumRoutes][2] = {
+        // {source, destination}
+        {"fd00:1::1", "2001:db8:1:2::1"},
+        {"fd00:1::1", "2001:db8:9::1"},
+        {"fd00:3::1", "2001:db8:1::1"},
+        {"2001:db8:9::1", "3000::1"},
+    };
+
+    Leader &                                           leader = aInstance.Get<Leader>();
+    Ip6::Address                                       addresses[LookupResults::kNumAddresses];
+    Ip6::Address                                       routes[LookupResults::kNumRoutes][2];
+    Lowpan::Context                                    context;
+    std::chrono::time_point<std::chrono::steady_clock> start;
+
+    for (uint8_t i = 0; i < LookupResults::kNumAddresses; i++)
+    {
+        SuccessOrQuit(addresses[i].FromString(kAddresses[i]), "Address::FromString() failed");
+    }
+
+    for (uint8_t i = 0; i < LookupResults::kNumRoutes; i++)
+    {
+        SuccessOrQuit(routes[i][0].FromString(kRoutes[i][0]), "Address::FromString() failed");
+        SuccessOrQuit(routes[i][1].FromString(kRoutes[i][1]), "Address::FromString() failed");
+    }
+
+    start = std::chrono::steady_clock::now();
+
+    for (uint32_t iteration = 0; iteration < aIterations; iteration++)
+    {
+        for (uint8_t i = 0; i < LookupResults::kNumAddresses; i++)
+        {
+            aResults.mContextError[i] = leader.GetContext(addresses[i], context);
+            aResults.mContextId[i]    = (aResults.mContextError[i] == kErrorNone) ? context.mContextId : 0xff;
+            aResults.mIsOnMesh[i]     = leader.IsOnMesh(addresses[i]);
+        }
+
+        for (uint8_t i = 0; i < LookupResults::kNumContexts; i++)
+        {
+            aResults.mContextByIdError[i]  = leader.GetContext(i, context);
+            aResults.mContextByIdLength[i] =
+                (aResults.mContextByIdError[i] == kErrorNone) ? context.mPrefix.GetLength() : 0;
+        }
+
+        for (uint8_t i = 0; i < LookupResults::kNumRoutes; i++)
+        {
+            aResults.mRouteRloc16[i]      = Mac::kShortAddrInvalid;
+            aResults.mRouteMatchLength[i] = 0xff;
+            aResults.mRouteError[i]       = leader.RouteLookup(routes[i][0], routes[i][1],
+                                                         &aResults.mRouteMatchLength[i], &aResults.mRouteRloc16[i]);
+        }
+    }
+
+    return static_cast<uint32_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+static bool CompareLookupResults(const LookupResults &aFirst, const LookupResults &aSecond)
+{
+    return (memcmp(aFirst.mContextError, aSecond.mContextError, sizeof(aFirst.mContextError)) == 0) &&
+           (memcmp(aFirst.mContextId, aSecond.mContextId, sizeof(aFirst.mContextId)) == 0) &&
+           (memcmp(aFirst.mIsOnMesh, aSecond.mIsOnMesh, sizeof(aFirst.mIsOnMesh)) == 0) &&
+           (memcmp(aFirst.mContextByIdError, aSecond.mContextByIdError, sizeof(aFirst.mContextByIdError)) == 0) &&
+           (memcmp(aFirst.mContextByIdLength, aSecond.mContextByIdLength, sizeof(aFirst.mContextByIdLength)) == 0) &&
+           (memcmp(aFirst.mRouteError, aSecond.mRouteError, sizeof(aFirst.mRouteError)) == 0) &&
+           (memcmp(aFirst.mRouteRloc16, aSecond.mRouteRloc16, sizeof(aFirst.mRouteRloc16)) == 0) &&
+           (memcmp(aFirst.mRouteMatchLength, aSecond.mRouteMatchLength, sizeof(aFirst.mRouteMatchLength)) == 0);
+}
+
+void TestLeaderLookupCache(void)
+{
+    // The Network Data is filled up to the lookup cache capacity, then
+    // one more prefix is added so that lookups parse the TLVs. Both
+    // must give the same results.
+
+    const uint32_t kIterations     = 20000;
+    const uint8_t  kNumFitPrefixes = OPENTHREAD_CONFIG_NETDATA_LOOKUP_CACHE_MAX_PREFIXES - kNumLookupPrefixes;
+
+    ot::Instance *instance;
+    LookupResults cached;
+    LookupResults parsed;
+    uint32_t      cachedDuration;
+    uint32_t      parsedDuration;
+
+    printf("\n\n-------------------------------------------------");
+    printf("\nTestLeaderLookupCache()\n");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+    SetLeaderNetworkData(*instance, kNumFitPrefixes, 1);
+    cachedDuration = DoLookups(*instance, cached, kIterations);
+    VerifyOrQuit(LeaderTester::IsLookupCacheUsed(instance->Get<Leader>()), "lookup cache is not used");
+
+    // Context lookups
+
+    VerifyOrQuit(cached.mContextError[0] == kErrorNone && cached.mContextId[0] == 1, "GetContext() failed");
+    VerifyOrQuit(cached.mContextError[1] == kErrorNone && cached.mContextId[1] == 2, "GetContext() failed");
+    VerifyOrQuit(cached.mContextError[2] == kErrorNone && cached.mContextId[2] == 3, "GetContext() failed");
+    VerifyOrQuit(cached.mContextError[3] == kErrorNotFound, "GetContext() failed");
+    VerifyOrQuit(cached.mContextError[4] == kErrorNotFound, "GetContext() failed");
+    VerifyOrQuit(cached.mContextError[5] == kErrorNotFound, "GetContext() failed");
+
+    VerifyOrQuit(cached.mContextByIdError[0] == kErrorNone && cached.mContextByIdLength[0] == 64,
+                 "GetContext() failed");
+    VerifyOrQuit(cached.mContextByIdError[1] == kErrorNone && cached.mContextByIdLength[1] == 64,
+                 "GetContext() failed");
+    VerifyOrQuit(cached.mContextByIdError[3] == kErrorNone && cached.mContextByIdLength[3] == 64,
+                 "GetContext() failed");
+    VerifyOrQuit(cached.mContextByIdError[4] == kErrorNotFound, "GetContext() failed");
+
+    // On-mesh lookups
+
+    VerifyOrQuit(cached.mIsOnMesh[0] && cached.mIsOnMesh[1] && cached.mIsOnMesh[2], "IsOnMesh() failed");
+    VerifyOrQuit(!cached.mIsOnMesh[3] && !cached.mIsOnMesh[4] && !cached.mIsOnMesh[5], "IsOnMesh() failed");
+
+    // Route lookups
+
+    VerifyOrQuit(cached.mRouteError[0] == kErrorNone && cached.mRouteRloc16[0] == 0x1400 &&
+                     cached.mRouteMatchLength[0] == 48,
+                 "RouteLookup() failed");
+    VerifyOrQuit(cached.mRouteError[1] == kErrorNone && cached.mRouteRloc16[1] == 0x0800 &&
+                     cached.mRouteMatchLength[1] == 0,
+                 "RouteLookup() failed");
+    VerifyOrQuit(cached.mRouteError[2] == kErrorNone && cached.mRouteRloc16[2] == 0x1c00, "RouteLookup() failed");
+    VerifyOrQuit(cached.mRouteError[3] == kErrorNoRoute, "RouteLookup() failed");
+
+    SetLeaderNetworkData(*instance, kNumFitPrefixes + 1, 2);
+    parsedDuration = DoLookups(*instance, parsed, kIterations);
+    VerifyOrQuit(!LeaderTester::IsLookupCacheUsed(instance->Get<Leader>()), "lookup cache is used");
+
+    VerifyOrQuit(CompareLookupResults(cached, parsed), "lookup results do not match");
+
+    printf("\nLookups: %u usec with lookup cache, %u usec parsing TLVs", cachedDuration, parsedDuration);
+
+    testFreeInstance(instance);
+}
+
+void TestLeaderLookupCacheFailedRegistration(void)
+{
+    // A registration which does not fit in the Network Data fails
+    // after the previous entries of the router were removed, leaving
+    // the Network Data version unchanged. Lookups must still see the
+    // removal.
+
+    const uint16_t kRloc16              = 0x0400;
+    const uint8_t  kNumPaddingPrefixes  = 3;
+    const uint8_t  kNumPaddingEntries   = 15;
+    const uint8_t  kNumRegisteredRoutes = 3;
+
+    ot::Instance *     instance;
+    NetworkDataBuilder builder;
+    NetworkDataBuilder registration;
+    Message *          message;
+    Ip6::Address       address;
+    uint8_t            removedLength;
+
+    printf("\n\n-------------------------------------------------");
+    printf("\nTestLeaderLookupCacheFailedRegistration()\n");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+    VerifyOrQuit(instance->Get<RouterTable>().Allocate(Mle::Mle::RouterIdFromRloc16(kRloc16)) != nullptr,
+                 "RouterTable::Allocate() failed");
+
+    builder.StartPrefix(0, "fd00:5::", 64);
+    builder.StartSubTlv(NetworkDataTlv::kTypeBorderRouter);
+    builder.AddBorderRouterEntry(kRloc16, 0, /* aOnMesh */ true, /* aDefaultRoute */ false);
+    builder.EndSubTlv();
+    builder.EndPrefix();
+    removedLength = builder.GetLength();
+
+    for (uint8_t i = 0; i < kNumPaddingPrefixes; i++)
+    {
+        char prefix[sizeof("fd00:ffff:ff::")];
+
+        snprintf(prefix, sizeof(prefix), "fd00:ffff:%x::", i);
+        builder.StartPrefix(0, prefix, 48);
+        builder.StartSubTlv(NetworkDataTlv::kTypeBorderRouter);
+
+        for (uint8_t j = 0; j < kNumPaddingEntries; j++)
+        {
+            builder.AddBorderRouterEntry(0x4000 + (i << 8) + j, 0, /* aOnMesh */ true, /* aDefaultRoute */ false);
+        }
+
+        builder.EndSubTlv();
+        builder.EndPrefix();
+    }
+
+    message = builder.NewNetworkDataMessage(*instance);
+    SuccessOrQuit(instance->Get<Leader>().SetNetworkData(1, 1, /* aStableOnly */ false, *message, 0),
+                  "SetNetworkData() failed");
+    message->Free();
+
+    SuccessOrQuit(address.FromString("fd00:5::1"), "Address::FromString() failed");
+    VerifyOrQuit(instance->Get<Leader>().IsOnMesh(address), "IsOnMesh() failed");
+    VerifyOrQuit(LeaderTester::IsLookupCacheUsed(instance->Get<Leader>()), "lookup cache is not used");
+
+    // The registration replaces the on-mesh prefix with external
+    // routes which do not fit in the remaining space.
+
+    for (uint8_t i = 0; i < kNumRegisteredRoutes; i++)
+    {
+        char prefix[sizeof("fd00:6:ff::")];
+
+        snprintf(prefix, sizeof(prefix), "fd00:6:%x::", i);
+        registration.StartPrefix(0, prefix, 64);
+        registration.StartSubTlv(NetworkDataTlv::kTypeHasRoute);
+        registration.AddHasRouteEntry(kRloc16, 0);
+        registration.EndSubTlv();
+        registration.EndPrefix();
+    }
+
+    VerifyOrQuit(builder.GetLength() - removedLength + registration.GetLength() > NetworkData::kMaxSize,
+                 "registration fits in Network Data");
+
+    LeaderTester::RegisterNetworkData(instance->Get<Leader>(), kRloc16, registration);
+
+    VerifyOrQuit(instance->Get<Leader>().GetVersion() == 1, "Network Data version changed");
+    VerifyOrQuit(!instance->Get<Leader>().IsOnMesh(address), "IsOnMesh() returned a removed prefix");
+
+    testFreeInstance(instance);
+}
+
 #if OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
 
 class TestNetworkData : public Local
@@ -318,6 +758,8 @@ void TestNetworkDataFindNextService(void)
 int main(void)
 {
     ot::NetworkData::TestNetworkDataIterator();
+    ot::NetworkData::TestLeaderLookupCache();
+    ot::NetworkData::TestLeaderLookupCacheFailedRegistration();
 #if OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
     ot::NetworkData::TestNetworkDataFindNextService();
 #endif
@@ -0,0 +1,418 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// The asynchronous property sets and the RCP restoration are tested
+// regardless of the build configuration.
+#undef OPENTHREAD_SPINEL_CONFIG_ASYNC_SET_ENABLE
+#define OPENTHREAD_SPINEL_CONFIG_ASYNC_SET_ENABLE 1
+#undef OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT
+#define OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT 2
+
+#include <string.h>
+
+#include <openthread/platform/time.h>
+
+#include "common/code_utils.hpp"
+#include "lib/spinel/radio_spinel.hpp"
+
+#include "test_util.hpp"
+
+static uint64_t sNow = 0;
+
+extern "C" uint64_t otPlatTimeGet(void)
+{
+    return sNow;
+}
+
+namespace ot {
+namespace Spinel {
+
+struct FakeProcessContext
+{
+};
+
+/**
+ * This class emulates an RCP behind a spinel interface.
+ *
+ * Responses are queued when a request is sent, and they are received by the host either while it waits for a frame or
+ * when it calls `Process()`.
+ *
+ */
+class FakeRcpInterface
+{
+public:
+    enum
+    {
+        kRttUs = 300, // Time spent by the RCP to respond to a request (in microseconds).
+    };
+
+    FakeRcpInterface(SpinelInterface::ReceiveFrameCallback aCallback,
+                     void *                                aContext,
+                     SpinelInterface::RxFrameBuffer &      aFrameBuffer)
+        : mFailKey(SPINEL_PROP_LAST_STATUS)
+        , mDropKey(SPINEL_PROP_LAST_STATUS)
+        , mNumResets(0)
+        , mPanId(0xffff)
+        , mShortAddress(0xfffe)
+        , mCallback(aCallback)
+        , mContext(aContext)
+        , mFrameBuffer(aFrameBuffer)
+        , mNumFrames(0)
+    {
+    }
+
+    void Deinit(void) {}
+
+    void OnRcpReset(void) {}
+
+    otError SendFrame(const uint8_t *aFrame, uint16_t aLength);
+
+    otError WaitForFrame(uint64_t aTimeoutUs)
+    {
+        otError error = OT_ERROR_NONE;
+
+        if (mNumFrames == 0)
+        {
+            sNow += aTimeoutUs;
+            ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
+        }
+
+        ReceiveFrame();
+
+    exit:
+        return error;
+    }
+
+    void Process(const FakeProcessContext &)
+    {
+        while (mNumFrames > 0)
+        {
+            ReceiveFrame();
+        }
+    }
+
+    spinel_prop_key_t mFailKey; // The next set of this property fails.
+    spinel_prop_key_t mDropKey; // The next set of this property is not responded.
+    uint8_t           mNumResets;
+    uint16_t          mPanId;
+    uint16_t          mShortAddress;
+
+private:
+    enum
+    {
+        kMaxFrames    = 32,
+        kMaxFrameSize = 128,
+    };
+
+    struct Frame
+    {
+        uint8_t  mData[kMaxFrameSize];
+        uint16_t mLength;
+    };
+
+    void   HandleRequest(uint8_t           aHeader,
+                         uint32_t          aCommand,
+                         spinel_prop_key_t aKey,
+                         const uint8_t *   aData,
+                         uint16_t          aLength);
+    Frame &NewFrame(void);
+    void   ReceiveFrame(void);
+
+    SpinelInterface::ReceiveFrameCallback mCallback;
+    void *                                mContext;
+    SpinelInterface::RxFrameBuffer &      mFrameBuffer;
+    Frame                                 mFrames[kMaxFrames];
+    uint8_t                               mNumFrames;
+};
+
+FakeRcpInterface::Frame &FakeRcpInterface::NewFrame(void)
+{
+    VerifyOrQuit(mNumFrames < kMaxFrames, "Too many queued frames");
+
+    return mFrames[mNumFrames++];
+}
+
+void FakeRcpInterface::ReceiveFrame(void)
+{
+    sNow += kRttUs;
+
+    SuccessOrQuit(mFrameBuffer.WriteBytes(mFrames[0].mData, mFrames[0].mLength), "WriteBytes() failed");
+    memmove(&mFrames[0], &mFrames[1], sizeof(Frame) * (mNumFrames - 1));
+    mNumFrames--;
+
+    mCallback(mContext);
+}
+
+otError FakeRcpInterface::SendFrame(const uint8_t *aFrame, uint16_t aLength)
+{
+    uint8_t           header;
+    unsigned int      command;
+    unsigned int      key;
+    spinel_ssize_t    unpacked;
+    const uint8_t *   data;
+    spinel_prop_key_t propKey;
+
+    unpacked = spinel_datatype_unpack(aFrame, aLength, "Ci", &header, &command);
+    VerifyOrQuit(unpacked > 0, "Failed to parse request");
+
+    if (command == SPINEL_CMD_RESET)
+    {
+        // Pending responses are lost when the RCP resets.
+        mNumFrames = 0;
+        mNumResets++;
+
+        Frame &        frame  = NewFrame();
+        spinel_ssize_t packed = spinel_datatype_pack(frame.mData, sizeof(frame.mData), "Ciii", SPINEL_HEADER_FLAG,
+                                                     SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_LAST_STATUS,
+                                                     SPINEL_STATUS_RESET_POWER_ON);
+
+        VerifyOrQuit(packed > 0, "Failed to pack reset notification");
+        frame.mLength = static_cast<uint16_t>(packed);
+        ExitNow();
+    }
+
+    unpacked = spinel_datatype_unpack(aFrame, aLength, "Cii", &header, &command, &key);
+    VerifyOrQuit(unpacked > 0, "Failed to parse request");
+
+    data    = aFrame + unpacked;
+    propKey = static_cast<spinel_prop_key_t>(key);
+
+    HandleRequest(header, command, propKey, data, aLength - static_cast<uint16_t>(unpacked));
+
+exit:
+    return OT_ERROR_NONE;
+}
+
+void FakeRcpInterface::HandleRequest(uint8_t           aHeader,
+                                     uint32_t          aCommand,
+                                     spinel_prop_key_t aKey,
+                                     const uint8_t *   aData,
+                                     uint16_t          aLength)
+{
+    const uint8_t  kEui64[]   = {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01};
+    const unsigned kRadioCaps = OT_RADIO_CAPS_ACK_TIMEOUT | OT_RADIO_CAPS_TRANSMIT_RETRIES |
+                                OT_RADIO_CAPS_CSMA_BACKOFF | OT_RADIO_CAPS_TRANSMIT_SEC |
+                                OT_RADIO_CAPS_TRANSMIT_TIMING;
+
+    uint8_t        header = SPINEL_HEADER_FLAG | SPINEL_HEADER_GET_TID(aHeader);
+    uint8_t *      buffer;
+    spinel_ssize_t packed = 0;
+
+    if (aCommand == SPINEL_CMD_PROP_VALUE_SET && aKey == mDropKey)
+    {
+        mDropKey = SPINEL_PROP_LAST_STATUS;
+        ExitNow();
+    }
+
+    buffer = NewFrame().mData;
+
+    if (aCommand == SPINEL_CMD_PROP_VALUE_SET && aKey == mFailKey)
+    {
+        mFailKey = SPINEL_PROP_LAST_STATUS;
+        packed   = spinel_datatype_pack(buffer, kMaxFrameSize, "Ciii", header, SPINEL_CMD_PROP_VALUE_IS,
+                                      SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_FAILURE);
+    }
+    else if (aCommand == SPINEL_CMD_PROP_VALUE_GET)
+    {
+        switch (aKey)
+        {
+        case SPINEL_PROP_PROTOCOL_VERSION:
+            packed = spinel_datatype_pack(buffer, kMaxFrameSize, "Ciiii", header, SPINEL_CMD_PROP_VALUE_IS, aKey,
+                                          SPINEL_PROTOCOL_VERSION_THREAD_MAJOR, SPINEL_PROTOCOL_VERSION_THREAD_MINOR);
+            break;
+
+        case SPINEL_PROP_NCP_VERSION:
+            packed =
+                spinel_datatype_pack(buffer, kMaxFrameSize, "CiiU", header, SPINEL_CMD_PROP_VALUE_IS, aKey, "FAKE-RCP");
+            break;
+
+        case SPINEL_PROP_HWADDR:
+            packed =
+                spinel_datatype_pack(buffer, kMaxFrameSize, "CiiE", header, SPINEL_CMD_PROP_VALUE_IS, aKey, kEui64);
+            break;
+
+        case SPINEL_PROP_CAPS:
+            packed = spinel_datatype_pack(buffer, kMaxFrameSize, "Ciiiii", header, SPINEL_CMD_PROP_VALUE_IS, aKey,
+                                          SPINEL_CAP_CONFIG_RADIO, SPINEL_CAP_MAC_RAW, SPINEL_CAP_RCP_API_VERSION);
+            break;
+
+        case SPINEL_PROP_RCP_API_VERSION:
+            packed = spinel_datatype_pack(buffer, kMaxFrameSize, "Ciii", header, SPINEL_CMD_PROP_VALUE_IS, aKey,
+                                          SPINEL_RCP_API_VERSION);
+            break;
+
+        case SPINEL_PROP_RADIO_CAPS:
+            packed =
+                spinel_datatype_pack(buffer, kMaxFrameSize, "Ciii", header, SPINEL_CMD_PROP_VALUE_IS, aKey, kRadioCaps);
+            break;
+
+        default:
+            packed = spinel_datatype_pack(buffer, kMaxFrameSize, "Ciii", header, SPINEL_CMD_PROP_VALUE_IS,
+                                          SPINEL_PROP_LAST_STATUS, SPINEL_STATUS_PROP_NOT_FOUND);
+            break;
+        }
+    }
+    else
+    {
+        uint32_t command = (aCommand == SPINEL_CMD_PROP_VALUE_INSERT)   ? SPINEL_CMD_PROP_VALUE_INSERTED
+                           : (aCommand == SPINEL_CMD_PROP_VALUE_REMOVE) ? SPINEL_CMD_PROP_VALUE_REMOVED
+                                                                        : SPINEL_CMD_PROP_VALUE_IS;
+
+        if (aKey == SPINEL_PROP_MAC_15_4_PANID)
+        {
+            VerifyOrQuit(spinel_datatype_unpack(aData, aLength, SPINEL_DATATYPE_UINT16_S, &mPanId) > 0, "Bad PAN ID");
+        }
+        else if (aKey == SPINEL_PROP_MAC_15_4_SADDR)
+        {
+            VerifyOrQuit(spinel_datatype_unpack(aData, aLength, SPINEL_DATATYPE_UINT16_S, &mShortAddress) > 0,
+                         "Bad short address");
+        }
+
+        // Echo the value of the property.
+        packed = spinel_datatype_pack(buffer, kMaxFrameSize, "Cii", header, command, aKey);
+        VerifyOrQuit(packed > 0 && packed + aLength <= kMaxFrameSize, "Request is too long");
+        memcpy(buffer + packed, aData, aLength);
+        packed += aLength;
+    }
+
+    VerifyOrQuit(packed > 0 && packed <= kMaxFrameSize, "Failed to pack response");
+    mFrames[mNumFrames - 1].mLength = static_cast<uint16_t>(packed);
+
+exit:
+    return;
+}
+
+typedef RadioSpinel<FakeRcpInterface, FakeProcessContext> TestRadioSpinel;
+
+static const TestRadioSpinel::PropertyStats *FindPropertyStats(const TestRadioSpinel &aRadioSpinel,
+                                                               spinel_prop_key_t      aKey)
+{
+    const TestRadioSpinel::RequestStats & stats         = aRadioSpinel.GetRequestStats();
+    const TestRadioSpinel::PropertyStats *propertyStats = nullptr;
+
+    for (uint8_t i = 0; i < stats.mNumProperties; i++)
+    {
+        if (stats.mProperties[i].mKey == aKey)
+        {
+            propertyStats = &stats.mProperties[i];
+        }
+    }
+
+    return propertyStats;
+}
+
+void TestRadioSpinelAsyncSet(void)
+{
+    static TestRadioSpinel radioSpinel;
+
+    FakeRcpInterface &                    rcp = radioSpinel.GetSpinelInterface();
+    FakeProcessContext                    context;
+    const TestRadioSpinel::PropertyStats *panIdStats;
+    uint32_t                              numAsyncRequests;
+
+    radioSpinel.Init(/* aResetRadio */ true, /* aRestoreDatasetFromNcp */ false,
+                     /* aSkipRcpCompatibilityCheck */ false);
+    VerifyOrQuit(rcp.mNumResets == 1, "Init() did not reset the RCP");
+
+    // A set sent without waiting for the response.
+
+    SuccessOrQuit(radioSpinel.SetPanId(0x1234), "SetPanId() failed");
+    VerifyOrQuit(rcp.mPanId == 0x1234, "PAN ID was not sent");
+    VerifyOrQuit(radioSpinel.GetRequestStats().mNumAsyncRequests == 1, "Async request was not counted");
+    VerifyOrQuit(FindPropertyStats(radioSpinel, SPINEL_PROP_MAC_15_4_PANID) == nullptr, "Response was not pending");
+
+    radioSpinel.Process(context);
+
+    panIdStats = FindPropertyStats(radioSpinel, SPINEL_PROP_MAC_15_4_PANID);
+    VerifyOrQuit(panIdStats != nullptr && panIdStats->mNumResponses == 1, "Async response was not handled");
+    VerifyOrQuit(panIdStats->mMaxRtt == FakeRcpInterface::kRttUs, "Round-trip time is incorrect");
+    VerifyOrQuit(panIdStats->mRttHistogram[0] == 1, "Round-trip time histogram is incorrect");
+    VerifyOrQuit(rcp.mNumResets == 1, "RCP was reset after a successful set");
+
+    // More sets than spinel transaction ids, the host waits for a response when all are in use.
+
+    numAsyncRequests = radioSpinel.GetRequestStats().mNumAsyncRequests;
+
+    for (uint16_t panId = 1; panId <= 20; panId++)
+    {
+        SuccessOrQuit(radioSpinel.SetPanId(panId), "SetPanId() failed");
+    }
+
+    radioSpinel.Process(context);
+
+    VerifyOrQuit(rcp.mPanId == 20, "PAN ID was not sent");
+    VerifyOrQuit(radioSpinel.GetRequestStats().mNumAsyncRequests == numAsyncRequests + 20, "Async requests are wrong");
+    VerifyOrQuit(panIdStats->mNumResponses == 21, "Async responses were not handled");
+    VerifyOrQuit(radioSpinel.GetRequestStats().mNumAsyncFailures == 0, "Unexpected async failure");
+    VerifyOrQuit(rcp.mNumResets == 1, "RCP was reset after successful sets");
+
+    // A set which fails is handled as an RCP failure: the RCP is reset and the properties are restored.
+
+    rcp.mFailKey = SPINEL_PROP_MAC_15_4_PANID;
+    SuccessOrQuit(radioSpinel.SetPanId(0x5678), "SetPanId() failed");
+    VerifyOrQuit(rcp.mNumResets == 1, "RCP was reset before the response");
+
+    rcp.mPanId = 0xffff;
+    radioSpinel.Process(context);
+
+    VerifyOrQuit(radioSpinel.GetRequestStats().mNumAsyncFailures == 1, "Async failure was not counted");
+    VerifyOrQuit(panIdStats->mNumAsyncFailures == 1, "Async failure was not counted for the property");
+    VerifyOrQuit(rcp.mNumResets == 2, "RCP was not reset after a failed set");
+    VerifyOrQuit(rcp.mPanId == 0x5678, "PAN ID was not restored");
+
+    // A set without response is handled as an RCP failure once the response timeout expires.
+
+    rcp.mDropKey = SPINEL_PROP_MAC_15_4_SADDR;
+    SuccessOrQuit(radioSpinel.SetShortAddress(0x0400), "SetShortAddress() failed");
+
+    radioSpinel.Process(context);
+    VerifyOrQuit(rcp.mNumResets == 2, "RCP was reset before the response timeout");
+
+    rcp.mShortAddress = 0xfffe;
+    sNow += 2 * US_PER_S;
+    radioSpinel.Process(context);
+
+    VerifyOrQuit(rcp.mNumResets == 3, "RCP was not reset after the response timeout");
+    VerifyOrQuit(rcp.mShortAddress == 0x0400, "Short address was not restored");
+    VerifyOrQuit(rcp.mPanId == 0x5678, "PAN ID was not restored");
+
+    radioSpinel.Deinit();
+
+    printf("TestRadioSpinelAsyncSet passed\n");
+}
+
+} // namespace Spinel
+} // namespace ot
+
+int main(void)
+{
+    ot::Spinel::TestRadioSpinelAsyncSet();
+    printf("All tests passed\n");
+    return 0;
+}
+
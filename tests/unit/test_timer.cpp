@@ -28,6 +28,8 @@
 
 #include "test_platform.h"
 
+#include <chrono>
+
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/instance.hpp"
@@ -573,6 +575,126 @@ template <typename TimerType> int TestTenTimers(void)
     return 0;
 }
 
+/**
+ * Test the TimerScheduler with a large number of timers started in a shuffled order, half of them stopped, and the
+ * remaining ones fired in order. Also reports the time taken to start and stop all the timers (micro-benchmark).
+ */
+template <typename TimerType> int TestManyTimers(void)
+{
+    const uint32_t kNumTimers = 10000;
+    const uint32_t kStride    = 7919; // Prime number used to shuffle the timer delays.
+    const uint32_t kTimeT0    = 1000;
+
+    ot::Instance *                                     instance   = testInitInstance();
+    TestTimer<TimerType> **                            timers     = new TestTimer<TimerType> *[kNumTimers];
+    uint32_t *                                         timerIndex = new uint32_t[kNumTimers];
+    std::chrono::time_point<std::chrono::steady_clock> start;
+    uint32_t                                           startDuration;
+    uint32_t                                           stopDuration;
+    uint32_t                                           handlerCount;
+
+    printf("TestManyTimers() ");
+
+    InitTestTimer();
+    InitCounters();
+
+    for (uint32_t i = 0; i < kNumTimers; i++)
+    {
+        timers[i]                              = new TestTimer<TimerType>(*instance);
+        timerIndex[(i * kStride) % kNumTimers] = i;
+    }
+
+    sNow = kTimeT0;
+
+    // Timer `i` is started with delay `(i * kStride) % kNumTimers + 1`, so all delays are distinct and in the range
+    // `[1, kNumTimers]`.
+
+    start = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < kNumTimers; i++)
+    {
+        timers[i]->Start((i * kStride) % kNumTimers + 1);
+    }
+
+    startDuration = static_cast<uint32_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
+    for (uint32_t i = 0; i < kNumTimers; i++)
+    {
+        VerifyOrQuit(timers[i]->IsRunning(), "TestManyTimers: Timer running Failed.");
+    }
+
+    VerifyOrQuit(sTimerOn, "TestManyTimers: Platform Timer State Failed.");
+    VerifyOrQuit(sPlatT0 + sPlatDt == kTimeT0 + 1, "TestManyTimers: Start params Failed.");
+
+    // Stop every odd timer.
+
+    start = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 1; i < kNumTimers; i += 2)
+    {
+        timers[i]->Stop();
+    }
+
+    stopDuration = static_cast<uint32_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
+    for (uint32_t i = 0; i < kNumTimers; i++)
+    {
+        VerifyOrQuit(timers[i]->IsRunning() == ((i % 2) == 0), "TestManyTimers: Timer running Failed.");
+    }
+
+    // Advance the time one step at a time and verify that timers fire in order.
+
+    handlerCount = 0;
+
+    for (uint32_t delay = 1; delay <= kNumTimers; delay++)
+    {
+        sNow = kTimeT0 + delay;
+
+        do
+        {
+            AlarmFired<TimerType>(instance);
+        } while (sTimerOn && (sPlatDt == 0));
+
+        {
+            uint32_t i = timerIndex[delay - 1];
+
+            if ((i % 2) == 0)
+            {
+                handlerCount++;
+                VerifyOrQuit(timers[i]->GetFiredCounter() == 1, "TestManyTimers: Timer fired counter Failed.");
+            }
+            else
+            {
+                VerifyOrQuit(timers[i]->GetFiredCounter() == 0, "TestManyTimers: Timer fired counter Failed.");
+            }
+
+            VerifyOrQuit(!timers[i]->IsRunning(), "TestManyTimers: Timer running Failed.");
+        }
+
+        VerifyOrQuit(sCallCount[kCallCountIndexTimerHandler] == handlerCount,
+                     "TestManyTimers: Handler CallCount Failed.");
+    }
+
+    VerifyOrQuit(handlerCount == kNumTimers / 2, "TestManyTimers: Handler CallCount Failed.");
+    VerifyOrQuit(!sTimerOn, "TestManyTimers: Platform Timer State Failed.");
+
+    for (uint32_t i = 0; i < kNumTimers; i++)
+    {
+        delete timers[i];
+    }
+
+    delete[] timers;
+    delete[] timerIndex;
+
+    printf("(start: %u usec, stop: %u usec) --> PASSED\n", startDuration, stopDuration);
+
+    testFreeInstance(instance);
+
+    return 0;
+}
+
 /**
  * Test the `Timer::Time` class.
  */
@@ -665,6 +787,7 @@ template <typename TimerType> void RunTimerTests(void)
     TestOneTimer<TimerType>();
     TestTwoTimers<TimerType>();
     TestTenTimers<TimerType>();
+    TestManyTimers<TimerType>();
 }
 
 int main(void)
@@ -0,0 +1,398 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "net/udp6.hpp"
+#include "thread/thread_netif.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+
+enum
+{
+    kMaxSockets       = OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE + 16,
+    kNumLocalAddrs    = 2,
+    kNumPeerAddrs     = 2,
+    kNumPorts         = 6,
+    kNumPeerPorts     = 2,
+    kNumIterations    = 4000,
+    kNumBenchmarkRuns = 100000,
+};
+
+static const uint16_t kPorts[kNumPorts]         = {5683, 19788, 49152, 49184, 61631, 53};
+static const uint16_t kUnknownPort              = 1234;
+static const uint16_t kPeerPorts[kNumPeerPorts] = {5683, 49153};
+static const char *   kLocalAddrs[kNumLocalAddrs] = {"fd00:1234::1", "fe80::1"};
+static const char *   kPeerAddrs[kNumPeerAddrs]   = {"fd00:1234::2", "fe80::2"};
+static const char     kMulticastAddr[]            = "ff03::1";
+
+static Ip6::Udp::Socket *sSockets[kMaxSockets];
+static bool              sIsOpen[kMaxSockets];
+static Ip6::Udp::Socket *sReceivedSocket;
+
+static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    VerifyOrQuit(sReceivedSocket == nullptr, "datagram was delivered to more than one socket");
+    sReceivedSocket = static_cast<Ip6::Udp::Socket *>(aContext);
+}
+
+static Ip6::Address GetAddress(const char *aString)
+{
+    Ip6::Address address;
+
+    SuccessOrQuit(address.FromString(aString), "Address::FromString() failed");
+
+    return address;
+}
+
+static bool MatchesReference(const otUdpSocket &aSocket, const Ip6::MessageInfo &aMessageInfo)
+{
+    // The matching rule of `Udp::SocketHandle::Matches()`.
+
+    const Ip6::SockAddr &sockName = static_cast<const Ip6::SockAddr &>(aSocket.mSockName);
+    const Ip6::SockAddr &peerName = static_cast<const Ip6::SockAddr &>(aSocket.mPeerName);
+
+    return (sockName.mPort == aMessageInfo.GetSockPort()) &&
+           (aMessageInfo.GetSockAddr().IsMulticast() || sockName.GetAddress().IsUnspecified() ||
+            sockName.GetAddress() == aMessageInfo.GetSockAddr()) &&
+           ((peerName.mPort == 0) ||
+            ((peerName.mPort == aMessageInfo.GetPeerPort()) &&
+             (peerName.GetAddress().IsUnspecified() || peerName.GetAddress() == aMessageInfo.GetPeerAddr())));
+}
+
+static const otUdpSocket *FindReference(Instance &aInstance, const Ip6::MessageInfo &aMessageInfo, bool &aIsDrop)
+{
+    // Returns the first matching socket in the socket list. If there is
+    // none, `aIsDrop` indicates whether a socket is bound to the port.
+
+    const otUdpSocket *socket;
+
+    aIsDrop = false;
+
+    for (socket = otUdpGetSockets(&aInstance); socket != nullptr; socket = socket->mNext)
+    {
+        if (MatchesReference(*socket, aMessageInfo))
+        {
+            break;
+        }
+
+        aIsDrop |= (socket->mSockName.mPort == aMessageInfo.GetSockPort());
+    }
+
+    return socket;
+}
+
+static void OpenRandomSocket(Instance &aInstance, uint16_t aIndex)
+{
+    Ip6::Udp::Socket &socket = *sSockets[aIndex];
+    Ip6::SockAddr     sockName;
+
+    SuccessOrQuit(socket.Open(HandleUdpReceive, &socket), "Socket::Open() failed");
+    sIsOpen[aIndex] = true;
+
+    if (rand() % 8 == 0)
+    {
+        // Leave some sockets unbound.
+        return;
+    }
+
+    sockName.mPort = kPorts[rand() % kNumPorts];
+
+    if (rand() % 2 == 0)
+    {
+        sockName.GetAddress() = GetAddress(kLocalAddrs[rand() % kNumLocalAddrs]);
+    }
+
+    SuccessOrQuit(socket.Bind(sockName), "Socket::Bind() failed");
+
+    if (rand() % 3 == 0)
+    {
+        Ip6::SockAddr peerName;
+
+        peerName.mPort = kPeerPorts[rand() % kNumPeerPorts];
+
+        if (rand() % 2 == 0)
+        {
+            peerName.GetAddress() = GetAddress(kPeerAddrs[rand() % kNumPeerAddrs]);
+        }
+
+        SuccessOrQuit(socket.Connect(peerName), "Socket::Connect() failed");
+    }
+
+    OT_UNUSED_VARIABLE(aInstance);
+}
+
+static void VerifyDemux(Instance &aInstance, Message &aMessage)
+{
+    // Sends random datagrams and verifies each is delivered to the
+    // socket which comes first in the socket list among the matching
+    // ones, and that the socket counters are updated.
+
+    for (uint16_t i = 0; i < kNumIterations; i++)
+    {
+        Ip6::MessageInfo    messageInfo;
+        const otUdpSocket * expected;
+        bool                isDrop;
+        otUdpSocket *       dropSocket = nullptr;
+        otUdpSocketCounters counters   = {0, 0};
+        otUdpSocketCounters dropCounters;
+
+        messageInfo.SetSockAddr(GetAddress((rand() % 4 == 0) ? kMulticastAddr : kLocalAddrs[rand() % kNumLocalAddrs]));
+        messageInfo.SetPeerAddr(GetAddress(kPeerAddrs[rand() % kNumPeerAddrs]));
+        messageInfo.SetSockPort((rand() % 16 == 0) ? kUnknownPort : kPorts[rand() % kNumPorts]);
+        messageInfo.SetPeerPort(kPeerPorts[rand() % kNumPeerPorts]);
+
+        expected = FindReference(aInstance, messageInfo, isDrop);
+
+        if (expected != nullptr)
+        {
+            counters = expected->mCounters;
+        }
+        else if (isDrop)
+        {
+            for (dropSocket = otUdpGetSockets(&aInstance); dropSocket->mSockName.mPort != messageInfo.GetSockPort();
+                 dropSocket = dropSocket->mNext)
+            {
+            }
+
+            dropCounters = dropSocket->mCounters;
+        }
+
+        sReceivedSocket = nullptr;
+        aMessage.SetOffset(0);
+        aInstance.Get<Ip6::Udp>().HandlePayload(aMessage, messageInfo);
+
+        VerifyOrQuit(sReceivedSocket == expected, "datagram was delivered to the wrong socket");
+
+        if (expected != nullptr)
+        {
+            VerifyOrQuit(expected->mCounters.mRxDatagrams == counters.mRxDatagrams + 1, "rx counter is incorrect");
+            VerifyOrQuit(expected->mCounters.mRxDropped == counters.mRxDropped, "drop counter is incorrect");
+        }
+        else if (dropSocket != nullptr)
+        {
+            VerifyOrQuit(dropSocket->mCounters.mRxDropped == dropCounters.mRxDropped + 1, "drop counter is incorrect");
+        }
+    }
+}
+
+void TestUdpSocketDemux(void)
+{
+    Instance *               instance = testInitInstance();
+    Ip6::NetifUnicastAddress localAddrs[kNumLocalAddrs];
+    Message *                message;
+
+    VerifyOrQuit(instance != nullptr, "null instance");
+
+    srand(0);
+
+    for (uint16_t i = 0; i < kNumLocalAddrs; i++)
+    {
+        localAddrs[i].InitAsThreadOrigin();
+        localAddrs[i].GetAddress() = GetAddress(kLocalAddrs[i]);
+        instance->Get<ThreadNetif>().AddUnicastAddress(localAddrs[i]);
+    }
+
+    for (uint16_t i = 0; i < kMaxSockets; i++)
+    {
+        sSockets[i] = new Ip6::Udp::Socket(*instance);
+    }
+
+    message = instance->Get<Ip6::Udp>().NewMessage(0);
+    VerifyOrQuit(message != nullptr, "Udp::NewMessage() failed");
+    SuccessOrQuit(message->Append<uint32_t>(0), "Message::Append() failed");
+
+    printf("TestUdpSocketDemux: sockets opened in sequence\n");
+
+    for (uint16_t i = 0; i < OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE / 2; i++)
+    {
+        OpenRandomSocket(*instance, i);
+    }
+
+    VerifyDemux(*instance, *message);
+
+    printf("TestUdpSocketDemux: sockets closed, re-bound and re-opened\n");
+
+    for (uint16_t round = 0; round < 20; round++)
+    {
+        for (uint16_t i = 0; i < OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE / 2; i++)
+        {
+            switch (rand() % 4)
+            {
+            case 0:
+                if (sIsOpen[i])
+                {
+                    SuccessOrQuit(sSockets[i]->Close(), "Socket::Close() failed");
+                    sIsOpen[i] = false;
+                }
+                break;
+
+            case 1:
+                if (sIsOpen[i])
+                {
+                    SuccessOrQuit(sSockets[i]->Bind(kPorts[rand() % kNumPorts]), "Socket::Bind() failed");
+                }
+                break;
+
+            case 2:
+                OpenRandomSocket(*instance, i);
+                break;
+
+            default:
+                break;
+            }
+        }
+
+        VerifyDemux(*instance, *message);
+    }
+
+    printf("TestUdpSocketDemux: more sockets than index slots\n");
+
+    for (uint16_t i = 0; i < kMaxSockets; i++)
+    {
+        if (!sIsOpen[i])
+        {
+            OpenRandomSocket(*instance, i);
+        }
+    }
+
+    VerifyDemux(*instance, *message);
+
+    for (uint16_t i = 0; i < kMaxSockets; i += 2)
+    {
+        SuccessOrQuit(sSockets[i]->Close(), "Socket::Close() failed");
+        sIsOpen[i] = false;
+    }
+
+    VerifyDemux(*instance, *message);
+
+    for (uint16_t i = 0; i < kMaxSockets; i++)
+    {
+        if (sIsOpen[i])
+        {
+            SuccessOrQuit(sSockets[i]->Close(), "Socket::Close() failed");
+        }
+
+        delete sSockets[i];
+    }
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
+void TestUdpSocketDemuxPerformance(void)
+{
+    // Measures the demux of datagrams to the first opened of `numSockets`
+    // sockets bound to distinct ports. It is the last one in the socket
+    // list, i.e., the worst case for a walk of the list.
+
+    const uint16_t   kNumSockets[] = {2, 8, OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE / 2};
+    Instance *       instance      = testInitInstance();
+    Ip6::MessageInfo messageInfo;
+    Message *        message;
+
+    VerifyOrQuit(instance != nullptr, "null instance");
+
+    for (uint16_t i = 0; i < kMaxSockets; i++)
+    {
+        sSockets[i] = new Ip6::Udp::Socket(*instance);
+    }
+
+    message = instance->Get<Ip6::Udp>().NewMessage(0);
+    VerifyOrQuit(message != nullptr, "Udp::NewMessage() failed");
+
+    messageInfo.SetSockAddr(GetAddress(kLocalAddrs[0]));
+    messageInfo.SetPeerAddr(GetAddress(kPeerAddrs[0]));
+    messageInfo.SetPeerPort(kPeerPorts[0]);
+
+    for (uint16_t numSockets : kNumSockets)
+    {
+        std::chrono::time_point<std::chrono::steady_clock> start;
+        std::chrono::nanoseconds                           elapsed;
+
+        for (uint16_t i = 0; i < numSockets; i++)
+        {
+            SuccessOrQuit(sSockets[i]->Open(HandleUdpReceive, sSockets[i]), "Socket::Open() failed");
+            SuccessOrQuit(sSockets[i]->Bind(static_cast<uint16_t>(kPorts[2] + 2 * i)), "Socket::Bind() failed");
+        }
+
+        messageInfo.SetSockPort(sSockets[0]->GetSockName().mPort);
+
+        start = std::chrono::steady_clock::now();
+
+        for (uint32_t run = 0; run < kNumBenchmarkRuns; run++)
+        {
+            sReceivedSocket = nullptr;
+            instance->Get<Ip6::Udp>().HandlePayload(*message, messageInfo);
+        }
+
+        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        printf("TestUdpSocketDemuxPerformance() sockets:%u avg:%lu nsec\n", numSockets,
+               static_cast<unsigned long>(elapsed.count() / kNumBenchmarkRuns));
+
+        VerifyOrQuit(sSockets[0]->GetCounters().mRxDatagrams == kNumBenchmarkRuns, "rx counter is incorrect");
+
+        for (uint16_t i = 0; i < numSockets; i++)
+        {
+            SuccessOrQuit(sSockets[i]->Close(), "Socket::Close() failed");
+        }
+    }
+
+    for (uint16_t i = 0; i < kMaxSockets; i++)
+    {
+        delete sSockets[i];
+    }
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestUdpSocketDemux();
+    ot::TestUdpSocketDemuxPerformance();
+    printf("All tests passed\n");
+    return 0;
+}